@@ -14,9 +14,15 @@
 //      accuracy. Every printed digit is a true digit of √2 —
 //      correctly rounded arithmetic and correctly rounded printing
 //      composing across three orders of magnitude of precision.
+//
+//   4. Streaming: the exact expansion of the smallest float64 — 751
+//      significant digits — walked chunk by chunk without building
+//      it, then its first 20 digits rounded from what the stream
+//      reports about the rest.
 
 #include <cstdio>
 #include <string>
+#include <string_view>
 
 #include <opine/opine.hpp>
 
@@ -64,5 +70,34 @@ int main() {
     auto root = sqrt<f1k>(fromString<f1k>("2"));
     std::printf("  float1024 %s\n", toString<f1k>(root, 100).c_str());
   }
+
+  // ---- 4. Streaming the exact digits ----------------------------
+  std::printf("\nthe smallest float64, streamed:\n");
+  {
+    float64::storage_type tiny{1}; // 2^-1074
+    long shown = 0;
+    auto d = streamDigits<float64>(tiny, [&](std::string_view chunk) {
+      if (shown < 55) // the first three chunks, then just count
+        std::printf("  %.*s\n", int(chunk.size()), chunk.data());
+      shown += long(chunk.size());
+      return true;
+    });
+    std::printf("  ... %ld digits in all, leading digit at 10^%ld\n",
+                d.count, d.k10);
+
+    char head[20];
+    std::size_t n = 0;
+    auto first = streamDigits<float64>(
+        tiny,
+        [&](std::string_view chunk) {
+          chunk.copy(head + n, chunk.size());
+          n += chunk.size();
+          return true;
+        },
+        20);
+    std::printf("  first 20: %.20s, and the rest %s\n", head,
+                first.roundsUp() ? "rounds the last one up"
+                                 : "falls away");
+  }
   return 0;
 }
@@ -20,6 +20,10 @@
 //   4. roundAndPack does the rest: subnormal shift, G/R/S
 //      rounding, overflow, denormal flush, IntegerExtremes
 //      collision, pack.
+//
+// IBM hex floats align with one guard digit instead of a sticky
+// shift, as the hardware does: their add is hfp.hpp's overload.
+// Fixed-point words add as integers: fixed_point.hpp's overload.
 
 #include "opine/core/arith_detail.hpp"
 #include "opine/core/bits.hpp"
@@ -35,10 +39,12 @@ namespace detail {
 // sub is add with b's sign flipped, but the flip must happen on the
 // UNPACKED value: a bit-level negate has no -0 encoding to land on
 // in fnuz formats (the sign-set zero pattern is their NaN), while
-// the unpacked form carries the sign out-of-band.
-template <typename T>
+// the unpacked form carries the sign out-of-band. Op (Add or Sub)
+// says which, for the Exceptions axis as well.
+template <typename T, Operation Op>
 constexpr auto addWithSign(typename T::storage_type a,
-                           typename T::storage_type b, bool negate_b) {
+                           typename T::storage_type b) {
+  constexpr bool negate_b = Op == Operation::Sub;
   using Num = typename T::number;
   using Rnd = typename T::rounding;
   using Storage = typename T::storage_type;
@@ -62,37 +68,39 @@ constexpr auto addWithSign(typename T::storage_type a,
   // ---------- Special value dispatch ----------
 
   if (ua.category == ValueCategory::NaN || ub.category == ValueCategory::NaN)
-    return deliver<T>(packSpecial<T>(ValueCategory::NaN, false), FlagNone);
+    return deliver<T, Op>(packSpecial<T>(ValueCategory::NaN, false), FlagNone);
 
   if (ua.category == ValueCategory::Infinity &&
       ub.category == ValueCategory::Infinity) {
     if (ua.sign == ub.sign)
-      return deliver<T>(packSpecial<T>(ValueCategory::Infinity, ua.sign),
-                        FlagNone);
+      return deliver<T, Op>(packSpecial<T>(ValueCategory::Infinity, ua.sign),
+                            FlagNone);
     // Inf − Inf = NaN: invalid operation (§7.2).
-    return deliver<T>(packSpecial<T>(ValueCategory::NaN, false), FlagInvalid);
+    return deliver<T, Op>(packSpecial<T>(ValueCategory::NaN, false),
+                          FlagInvalid);
   }
   if (ua.category == ValueCategory::Infinity)
-    return deliver<T>(packSpecial<T>(ValueCategory::Infinity, ua.sign),
-                      FlagNone);
+    return deliver<T, Op>(packSpecial<T>(ValueCategory::Infinity, ua.sign),
+                          FlagNone);
   if (ub.category == ValueCategory::Infinity)
-    return deliver<T>(packSpecial<T>(ValueCategory::Infinity, ub.sign),
-                      FlagNone);
+    return deliver<T, Op>(packSpecial<T>(ValueCategory::Infinity, ub.sign),
+                          FlagNone);
 
   if (ua.category == ValueCategory::Zero &&
       ub.category == ValueCategory::Zero) {
     bool sum_sign =
         (ua.sign == ub.sign) ? ua.sign : detail::exactZeroSumSign<Rnd>();
-    return deliver<T>(packSpecial<T>(ValueCategory::Zero, sum_sign), FlagNone);
+    return deliver<T, Op>(packSpecial<T>(ValueCategory::Zero, sum_sign),
+                          FlagNone);
   }
   // Repack rather than return the raw input: unpack canonicalizes
   // non-canonical explicit-J encodings (x87 unnormals and
   // pseudo-denormals), and zero + x must return x's canonical form.
   // For implicit-digit formats pack∘unpack is the identity.
   if (ua.category == ValueCategory::Zero)
-    return deliver<T>(pack<T>(ub), FlagNone);
+    return deliver<T, Op>(pack<T>(ub), FlagNone);
   if (ub.category == ValueCategory::Zero)
-    return deliver<T>(pack<T>(ua), FlagNone);
+    return deliver<T, Op>(pack<T>(ua), FlagNone);
 
   // ---------- Finite + Finite ----------
 
@@ -124,9 +132,9 @@ constexpr auto addWithSign(typename T::storage_type a,
   } else {
     magnitude = subDigits(sa, sb);
     if (isZero(magnitude))
-      return deliver<T>(packSpecial<T>(ValueCategory::Zero,
-                                       detail::exactZeroSumSign<Rnd>()),
-                        FlagNone);
+      return deliver<T, Op>(packSpecial<T>(ValueCategory::Zero,
+                                           detail::exactZeroSumSign<Rnd>()),
+                            FlagNone);
   }
 
   int result_exp = ea;
@@ -147,7 +155,7 @@ constexpr auto addWithSign(typename T::storage_type a,
 
   flags_t flags = FlagNone;
   auto bits = roundAndPack<T>(result_sign, result_exp, magnitude, flags);
-  return deliver<T>(bits, flags);
+  return deliver<T, Op>(bits, flags);
 }
 
 } // namespace detail
@@ -156,8 +164,11 @@ constexpr auto addWithSign(typename T::storage_type a,
 // add
 // -----------------------------------------------------------------
 template <typename T>
+  requires(!detail::is_decimal<typename T::number> &&
+           !detail::is_hex_float<typename T::number> &&
+           !detail::is_fixed_point<typename T::number>)
 constexpr auto add(typename T::storage_type a, typename T::storage_type b) {
-  return detail::addWithSign<T>(a, b, false);
+  return detail::addWithSign<T, Operation::Add>(a, b);
 }
 
 } // namespace opine
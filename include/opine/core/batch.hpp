@@ -0,0 +1,433 @@
+#ifndef OPINE_CORE_BATCH_HPP
+#define OPINE_CORE_BATCH_HPP
+
+// Elementwise batch forms of the rounding operations, keeping each
+// element's flags.
+//
+//   addMany<T>(a, b, out, flags)        out[i] = a[i] + b[i]
+//   subMany, mulMany, divMany           likewise
+//   fmaMany<T>(a, b, c, out, flags)     out[i] = a[i]·b[i] + c[i]
+//   sqrtMany<T>(a, out, flags)
+//   convertMany<Dst, Src>(a, out, flags)
+//   fromIntMany<T, Int>(a, out, flags)  out[i] = fromInt<T>(a[i])
+//   toIntMany<Int, T>(a, out, flags)    out[i] = toInt<Int, T>(a[i])
+//   toIntSaturatingMany<Int, T>(a, out) likewise, no flags
+//
+// Each runs over the shortest of its spans and returns how many
+// elements it wrote. Every element is computed as the scalar
+// operation computes it, and its flags still go through T's
+// Exceptions axis — accumulated, trapped or discarded as T says —
+// but they are also kept per element, in one of two shapes:
+//
+//   - a std::span<flags_t>: flags[i] for each element, one byte
+//     (the scalar flags_t), when the array is long enough — as
+//     parseMany's side array;
+//   - a FlagList: only the indices of elements whose flags meet a
+//     mask, in order, into the caller's index storage, plus the OR
+//     of every element's flags and the count of hits. Finding the
+//     few overflows in a large tensor then takes no second pass and
+//     no per-element storage at all.
+//
+// A flag array from the first shape reduces with anyFlags,
+// countFlags and findFlags below, eight elements per 64-bit word.
+//
+// Decimal Types batch the same way. convertMany between the DPD and
+// BID encodings of one format is the bulk transcode: a table lookup
+// per three digits each way, no rounding, no flags.
+//
+// So do IBM hex floats. convertMany between hfp32 or hfp64 and
+// float32 or float64 is the mainframe-data migration path: each
+// element takes convert's one-word HFP ↔ binary converter, and a
+// FlagList with FlagInexact | FlagOverflow | FlagUnderflow picks out
+// the values that did not carry across exactly.
+//
+// Fixed-point add, sub, mul and div run in blocks of integer
+// kernels with no branch on the data, which the compiler vectorizes:
+// saturating q15 arithmetic is one vector loop per block plus a
+// flag-byte reduction. The flags are still recorded per element;
+// they reach T's Exceptions axis once per call, ORed, which is the
+// same thing for the policies that accumulate or return them. Under
+// a trapping, counting or alternate-handling policy these take the
+// per-element path like everything else.
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <type_traits>
+
+#include "opine/core/add.hpp"
+#include "opine/core/convert.hpp"
+#include "opine/core/decimal.hpp"
+#include "opine/core/div.hpp"
+#include "opine/core/exceptions.hpp"
+#include "opine/core/fixed_point.hpp"
+#include "opine/core/fma.hpp"
+#include "opine/core/hfp.hpp"
+#include "opine/core/integer.hpp"
+#include "opine/core/mul.hpp"
+#include "opine/core/sqrt.hpp"
+#include "opine/core/sub.hpp"
+#include "opine/core/type.hpp"
+
+namespace opine {
+
+// Sparse per-element flags: see the header comment. index is the
+// caller's storage; count keeps counting past its end, so
+// count > index.size() says the list was truncated.
+struct FlagList {
+  std::span<std::size_t> index;
+  flags_t mask = FlagInvalid | FlagDivByZero | FlagOverflow;
+  std::size_t count = 0; // elements whose flags meet mask
+  flags_t any = FlagNone; // OR of every element's flags
+};
+
+namespace detail {
+
+// T's arithmetic, with the flags handed back.
+template <typename T>
+using StatusType = WithExceptions<T, exceptions::ReturnStatus>;
+
+inline void recordFlags(std::span<flags_t> flags, std::size_t i, flags_t f) {
+  if (i < flags.size())
+    flags[i] = f;
+}
+
+inline void recordFlags(FlagList &list, std::size_t i, flags_t f) {
+  list.any = flags_t(list.any | f);
+  if ((f & list.mask) != 0) {
+    if (list.count < list.index.size())
+      list.index[list.count] = i;
+    ++list.count;
+  }
+}
+
+// out[i] = the ReturnStatus result of op(i), delivered through T's
+// own axis and recorded. mul and div pass xor_sign(i), element i's
+// XorSign, which an Alternate axis reads.
+template <typename T, Operation Op, typename Flags, typename F,
+          typename G = std::nullptr_t>
+std::size_t runMany(std::size_t n, std::span<typename T::storage_type> out,
+                    Flags &flags, F op, G xor_sign = nullptr) {
+  if (out.size() < n)
+    n = out.size();
+  for (std::size_t i = 0; i < n; ++i) {
+    const WithStatus<StatusType<T>> r = op(i);
+    XorSign s = XorSign::OfResult;
+    if constexpr (!std::is_null_pointer_v<G> &&
+                  reads_xor_sign<typename T::exceptions>)
+      s = xor_sign(i);
+    const auto d = deliver<T, Op>(r.bits, r.flags, s);
+    if constexpr (std::is_same_v<decltype(d), const WithStatus<T>>)
+      out[i] = d.bits;
+    else
+      out[i] = d;
+    recordFlags(flags, i, r.flags);
+  }
+  return n;
+}
+
+template <typename S>
+std::size_t shortest(std::span<const S> a, std::span<const S> b) {
+  return a.size() < b.size() ? a.size() : b.size();
+}
+
+} // namespace detail
+
+// -----------------------------------------------------------------
+// Flag-array reductions
+// -----------------------------------------------------------------
+// Eight flag bytes per 64-bit word. Flags fit five bits, so adding
+// 0x7F to a masked byte sets its top bit exactly when the byte is
+// nonzero, with no carry into the next: one add and one mask test
+// eight elements. Byte order does not matter to any of them.
+namespace detail {
+
+inline constexpr std::uint64_t FlagBytes = 0x0101010101010101ULL;
+
+inline std::uint64_t loadFlags8(const flags_t *p) {
+  std::uint64_t w;
+  std::memcpy(&w, p, 8);
+  return w;
+}
+
+// Top bit of each byte of w & mask·FlagBytes that is nonzero.
+constexpr std::uint64_t flagHits8(std::uint64_t w, flags_t mask) {
+  return ((w & (FlagBytes * mask)) + FlagBytes * 0x7F) & (FlagBytes * 0x80);
+}
+
+} // namespace detail
+
+// The OR of every element's flags.
+inline flags_t anyFlags(std::span<const flags_t> flags) {
+  std::uint64_t acc = 0;
+  std::size_t i = 0;
+  for (; i + 8 <= flags.size(); i += 8)
+    acc |= detail::loadFlags8(flags.data() + i);
+  flags_t r = FlagNone;
+  for (; i < flags.size(); ++i)
+    r = flags_t(r | flags[i]);
+  for (int k = 0; k < 8; ++k)
+    r = flags_t(r | flags_t(acc >> (8 * k)));
+  return r;
+}
+
+// How many elements raised any flag in mask.
+inline std::size_t countFlags(std::span<const flags_t> flags, flags_t mask) {
+  std::size_t n = 0, i = 0;
+  for (; i + 8 <= flags.size(); i += 8)
+    n += std::size_t(std::popcount(
+        detail::flagHits8(detail::loadFlags8(flags.data() + i), mask)));
+  for (; i < flags.size(); ++i)
+    n += (flags[i] & mask) != 0;
+  return n;
+}
+
+// The indices of elements that raised any flag in mask, in order,
+// into index; returns how many there are (which may exceed
+// index.size() — those past it are counted, not written). Words
+// without a hit are skipped whole.
+inline std::size_t findFlags(std::span<const flags_t> flags, flags_t mask,
+                             std::span<std::size_t> index) {
+  std::size_t n = 0, i = 0;
+  auto hit = [&](std::size_t j) {
+    if (n < index.size())
+      index[n] = j;
+    ++n;
+  };
+  for (; i + 8 <= flags.size(); i += 8) {
+    if (detail::flagHits8(detail::loadFlags8(flags.data() + i), mask) == 0)
+      continue;
+    for (std::size_t j = i; j < i + 8; ++j)
+      if ((flags[j] & mask) != 0)
+        hit(j);
+  }
+  for (; i < flags.size(); ++i)
+    if ((flags[i] & mask) != 0)
+      hit(i);
+  return n;
+}
+
+namespace detail {
+
+// Whether delivering a batch's flags once, ORed, is what delivering
+// each element's would do: true for the policies that only
+// accumulate them, or hand them back.
+template <typename E>
+inline constexpr bool folds_flags =
+    std::is_same_v<E, exceptions::Silent> ||
+    std::is_same_v<E, exceptions::StatusFlags> ||
+    std::is_same_v<E, exceptions::Scoped> ||
+    std::is_same_v<E, exceptions::ReturnStatus>;
+
+template <typename T>
+inline constexpr bool fixed_batch =
+    is_fixed_point<typename T::number> && folds_flags<typename T::exceptions>;
+
+// A block's flags into the caller's shape; base is the block's
+// first element.
+inline void recordBlock(std::span<flags_t> flags, std::size_t base,
+                        std::span<const flags_t> block) {
+  if (base < flags.size()) {
+    const std::size_t k = flags.size() - base < block.size()
+                              ? flags.size() - base
+                              : block.size();
+    std::memcpy(flags.data() + base, block.data(), k);
+  }
+}
+
+inline void recordBlock(FlagList &list, std::size_t base,
+                        std::span<const flags_t> block) {
+  list.any = flags_t(list.any | anyFlags(block));
+  const std::size_t at =
+      list.count < list.index.size() ? list.count : list.index.size();
+  const std::size_t hits =
+      findFlags(block, list.mask, list.index.subspan(at));
+  const std::size_t written =
+      hits < list.index.size() - at ? hits : list.index.size() - at;
+  for (std::size_t k = at; k < at + written; ++k)
+    list.index[k] += base;
+  list.count += hits;
+}
+
+// The fixed-point add, sub, mul and div loops: op(i) is the integer
+// kernel (fixed_point.hpp), which has no branch on the data, so a
+// block of it compiles to vector code. Flags land in a block
+// buffer, are recorded a block at a time, and go through T's
+// Exceptions axis once, ORed.
+template <typename T, Operation Op, typename Flags, typename F>
+std::size_t fixedMany(std::size_t n, std::span<typename T::storage_type> out,
+                      Flags &flags, F op) {
+  constexpr std::size_t Block = 256;
+  if (out.size() < n)
+    n = out.size();
+  flags_t block[Block];
+  flags_t any = FlagNone;
+  for (std::size_t base = 0; base < n; base += Block) {
+    const std::size_t m = n - base < Block ? n - base : Block;
+    for (std::size_t j = 0; j < m; ++j) {
+      const WithStatus<T> r = op(base + j);
+      out[base + j] = r.bits;
+      block[j] = r.flags;
+    }
+    const std::span<const flags_t> got(block, m);
+    any = flags_t(any | anyFlags(got));
+    recordBlock(flags, base, got);
+  }
+  if (any != FlagNone)
+    (void)deliver<T, Op>(typename T::storage_type{}, any);
+  return n;
+}
+
+} // namespace detail
+
+// -----------------------------------------------------------------
+// Batch operations
+// -----------------------------------------------------------------
+template <typename T, typename Flags = std::span<flags_t>>
+std::size_t addMany(std::span<const typename T::storage_type> a,
+                    std::span<const typename T::storage_type> b,
+                    std::span<typename T::storage_type> out,
+                    Flags &&flags = {}) {
+  using S = detail::StatusType<T>;
+  if constexpr (detail::fixed_batch<T>)
+    return detail::fixedMany<T, Operation::Add>(
+        detail::shortest(a, b), out, flags,
+        [&](std::size_t i) { return detail::addFixed<T, Operation::Add>(a[i], b[i]); });
+  else
+    return detail::runMany<T, Operation::Add>(
+        detail::shortest(a, b), out, flags,
+        [&](std::size_t i) { return add<S>(a[i], b[i]); });
+}
+
+template <typename T, typename Flags = std::span<flags_t>>
+std::size_t subMany(std::span<const typename T::storage_type> a,
+                    std::span<const typename T::storage_type> b,
+                    std::span<typename T::storage_type> out,
+                    Flags &&flags = {}) {
+  using S = detail::StatusType<T>;
+  if constexpr (detail::fixed_batch<T>)
+    return detail::fixedMany<T, Operation::Sub>(
+        detail::shortest(a, b), out, flags,
+        [&](std::size_t i) { return detail::addFixed<T, Operation::Sub>(a[i], b[i]); });
+  else
+    return detail::runMany<T, Operation::Sub>(
+        detail::shortest(a, b), out, flags,
+        [&](std::size_t i) { return sub<S>(a[i], b[i]); });
+}
+
+template <typename T, typename Flags = std::span<flags_t>>
+std::size_t mulMany(std::span<const typename T::storage_type> a,
+                    std::span<const typename T::storage_type> b,
+                    std::span<typename T::storage_type> out,
+                    Flags &&flags = {}) {
+  using S = detail::StatusType<T>;
+  if constexpr (detail::fixed_batch<T>)
+    return detail::fixedMany<T, Operation::Mul>(
+        detail::shortest(a, b), out, flags,
+        [&](std::size_t i) { return detail::mulFixed<T>(a[i], b[i]); });
+  else
+    return detail::runMany<T, Operation::Mul>(
+        detail::shortest(a, b), out, flags,
+        [&](std::size_t i) { return mul<S>(a[i], b[i]); },
+        [&](std::size_t i) {
+          return detail::xorSign(detail::unpackOperand<T>(a[i]).sign !=
+                                 detail::unpackOperand<T>(b[i]).sign);
+        });
+}
+
+template <typename T, typename Flags = std::span<flags_t>>
+std::size_t divMany(std::span<const typename T::storage_type> a,
+                    std::span<const typename T::storage_type> b,
+                    std::span<typename T::storage_type> out,
+                    Flags &&flags = {}) {
+  using S = detail::StatusType<T>;
+  if constexpr (detail::fixed_batch<T>)
+    return detail::fixedMany<T, Operation::Div>(
+        detail::shortest(a, b), out, flags,
+        [&](std::size_t i) { return detail::divFixed<T>(a[i], b[i]); });
+  else
+    return detail::runMany<T, Operation::Div>(
+        detail::shortest(a, b), out, flags,
+        [&](std::size_t i) { return div<S>(a[i], b[i]); },
+        [&](std::size_t i) {
+          return detail::xorSign(detail::unpackOperand<T>(a[i]).sign !=
+                                 detail::unpackOperand<T>(b[i]).sign);
+        });
+}
+
+template <typename T, typename Flags = std::span<flags_t>>
+std::size_t fmaMany(std::span<const typename T::storage_type> a,
+                    std::span<const typename T::storage_type> b,
+                    std::span<const typename T::storage_type> c,
+                    std::span<typename T::storage_type> out,
+                    Flags &&flags = {}) {
+  using S = detail::StatusType<T>;
+  const std::size_t ab = detail::shortest(a, b);
+  return detail::runMany<T, Operation::Fma>(
+      ab < c.size() ? ab : c.size(), out, flags,
+      [&](std::size_t i) { return fma<S>(a[i], b[i], c[i]); });
+}
+
+template <typename T, typename Flags = std::span<flags_t>>
+std::size_t sqrtMany(std::span<const typename T::storage_type> a,
+                     std::span<typename T::storage_type> out,
+                     Flags &&flags = {}) {
+  using S = detail::StatusType<T>;
+  return detail::runMany<T, Operation::Sqrt>(
+      a.size(), out, flags, [&](std::size_t i) { return sqrt<S>(a[i]); });
+}
+
+template <typename Dst, typename Src, typename Flags = std::span<flags_t>>
+std::size_t convertMany(std::span<const typename Src::storage_type> a,
+                        std::span<typename Dst::storage_type> out,
+                        Flags &&flags = {}) {
+  using S = detail::StatusType<Dst>;
+  return detail::runMany<Dst, Operation::Convert>(
+      a.size(), out, flags,
+      [&](std::size_t i) { return convert<S, Src>(a[i]); });
+}
+
+template <typename T, typename Int, typename Flags = std::span<flags_t>>
+  requires detail::IntegerValue<Int>
+std::size_t fromIntMany(std::span<const Int> a,
+                        std::span<typename T::storage_type> out,
+                        Flags &&flags = {}) {
+  using S = detail::StatusType<T>;
+  return detail::runMany<T, Operation::Convert>(
+      a.size(), out, flags, [&](std::size_t i) { return fromInt<S>(a[i]); });
+}
+
+template <typename Int, typename T, typename Rnd = typename T::rounding,
+          typename Flags = std::span<flags_t>>
+  requires detail::IntegerValue<Int>
+std::size_t toIntMany(std::span<const typename T::storage_type> a,
+                      std::span<Int> out, Flags &&flags = {}) {
+  using S = detail::StatusType<T>;
+  const std::size_t n = a.size() < out.size() ? a.size() : out.size();
+  for (std::size_t i = 0; i < n; ++i) {
+    const IntWithStatus<Int> r = toInt<Int, S, Rnd>(a[i]);
+    const auto d = detail::deliverInt<T, Int>(r.value, r.flags);
+    if constexpr (std::is_same_v<decltype(d), const IntWithStatus<Int>>)
+      out[i] = d.value;
+    else
+      out[i] = d;
+    detail::recordFlags(flags, i, r.flags);
+  }
+  return n;
+}
+
+template <typename Int, typename T, typename Rnd = typename T::rounding>
+  requires detail::IntegerValue<Int>
+std::size_t toIntSaturatingMany(std::span<const typename T::storage_type> a,
+                                std::span<Int> out) {
+  const std::size_t n = a.size() < out.size() ? a.size() : out.size();
+  for (std::size_t i = 0; i < n; ++i)
+    out[i] = toIntSaturating<Int, T, Rnd>(a[i]);
+  return n;
+}
+
+} // namespace opine
+
+#endif // OPINE_CORE_BATCH_HPP
@@ -10,7 +10,8 @@
 //
 // isSignMinus inspects the RAW sign (it is defined on bit patterns,
 // including NaNs and unflushed encodings): the dedicated sign bit
-// for Explicit formats, the word MSB for the complement encodings.
+// for Explicit formats, the word MSB for the complement encodings,
+// never for unsigned ones.
 
 #include "opine/core/digits.hpp"
 #include "opine/core/round_pack.hpp"
@@ -38,11 +39,17 @@ template <typename T> constexpr bool isFinite(typename T::storage_type bits) {
 template <typename T>
 constexpr bool isSubnormal(typename T::storage_type bits) {
   const auto u = detail::unpackOperand<T>(bits);
+  if constexpr (detail::is_decimal<typename T::number>)
+    return u.category == ValueCategory::Finite &&
+           detail::decimalIsSubnormal<T>(u);
   return u.category == ValueCategory::Finite && u.biased_exp == 0;
 }
 
 template <typename T> constexpr bool isNormal(typename T::storage_type bits) {
   const auto u = detail::unpackOperand<T>(bits);
+  if constexpr (detail::is_decimal<typename T::number>)
+    return u.category == ValueCategory::Finite &&
+           !detail::decimalIsSubnormal<T>(u);
   return u.category == ValueCategory::Finite && u.biased_exp != 0;
 }
 
@@ -52,6 +59,8 @@ constexpr bool isSignMinus(typename T::storage_type bits) {
   using Fmt = typename T::layout;
   if constexpr (Num::value_sign == SignMethod::Explicit)
     return detail::testWordBit(bits, Fmt::sign_offset);
+  else if constexpr (Num::value_sign == SignMethod::Unsigned)
+    return false;
   else
     return detail::testWordBit(bits, Fmt::total_bits - 1);
 }
@@ -9,7 +9,8 @@
 // unpacked form. All format knowledge — NaN encodings, trap
 // values, two's-complement negation, redundant zero encodings, x87
 // unnormal canonicalization — lives in unpack; nothing here
-// inspects bits.
+// inspects bits. Decimal cohorts are the one addition: compareOperand
+// scales equal values to equal unpacked forms.
 //
 // The rbj two's-complement selling point (float comparison equals
 // signed-integer comparison) is therefore a THEOREM about this
@@ -75,6 +76,27 @@ constexpr int compareUnpacked(const UnpackedFloat<Storage> &a,
   return 0;
 }
 
+// The prologue for comparison: unpackOperand, plus — for decimal,
+// whose values have cohorts (1.0 and 1.00) — each finite coefficient
+// scaled up to P digits with its exponent lowered to match, which
+// makes (biased_exp, significand) order value order as it is for
+// binary.
+template <typename T>
+constexpr UnpackedFloat<typename T::storage_type>
+compareOperand(typename T::storage_type bits) {
+  auto u = unpackOperand<T>(bits);
+  if constexpr (is_decimal<typename T::number>) {
+    using Storage = typename T::storage_type;
+    constexpr int P = T::number::significand::digit_count;
+    if (u.category == ValueCategory::Finite) {
+      const int pad = P - decimalDigitCount(u.significand);
+      u.significand *= decimalPow10<Storage>(pad);
+      u.biased_exp -= pad;
+    }
+  }
+  return u;
+}
+
 } // namespace detail
 
 // -----------------------------------------------------------------
@@ -82,8 +104,8 @@ constexpr int compareUnpacked(const UnpackedFloat<Storage> &a,
 // -----------------------------------------------------------------
 template <typename T>
 constexpr bool eq(typename T::storage_type a, typename T::storage_type b) {
-  const auto ua = detail::unpackOperand<T>(a);
-  const auto ub = detail::unpackOperand<T>(b);
+  const auto ua = detail::compareOperand<T>(a);
+  const auto ub = detail::compareOperand<T>(b);
   if (ua.category == ValueCategory::NaN || ub.category == ValueCategory::NaN)
     return false;
   return detail::compareUnpacked(ua, ub) == 0;
@@ -94,8 +116,8 @@ constexpr bool eq(typename T::storage_type a, typename T::storage_type b) {
 // -----------------------------------------------------------------
 template <typename T>
 constexpr bool lt(typename T::storage_type a, typename T::storage_type b) {
-  const auto ua = detail::unpackOperand<T>(a);
-  const auto ub = detail::unpackOperand<T>(b);
+  const auto ua = detail::compareOperand<T>(a);
+  const auto ub = detail::compareOperand<T>(b);
   if (ua.category == ValueCategory::NaN || ub.category == ValueCategory::NaN)
     return false;
   return detail::compareUnpacked(ua, ub) < 0;
@@ -106,8 +128,8 @@ constexpr bool lt(typename T::storage_type a, typename T::storage_type b) {
 // -----------------------------------------------------------------
 template <typename T>
 constexpr bool le(typename T::storage_type a, typename T::storage_type b) {
-  const auto ua = detail::unpackOperand<T>(a);
-  const auto ub = detail::unpackOperand<T>(b);
+  const auto ua = detail::compareOperand<T>(a);
+  const auto ub = detail::compareOperand<T>(b);
   if (ua.category == ValueCategory::NaN || ub.category == ValueCategory::NaN)
     return false;
   return detail::compareUnpacked(ua, ub) <= 0;
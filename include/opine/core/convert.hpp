@@ -23,7 +23,8 @@
 //     unlike neg/abs: the result is canonical. convert<T, T> of an
 //     x87 unnormal or pseudo-denormal yields the canonical
 //     encoding, matching the oracle. There is deliberately no
-//     bit-copy fast path.
+//     bit-copy fast path; the exact-pair fast path (below) moves
+//     unpacked fields and repacks, so it canonicalizes too.
 //
 //   - NaN → Dst's canonical quiet NaN. Payloads are not
 //     propagated, matching arithmetic.
@@ -48,19 +49,21 @@
 //
 // Chained conversions are NOT equivalent to direct ones
 // (convert<FP8>(convert<FP16>(x)) may double-round versus
-// convert<FP8>(x)); a correctly-rounded via-format chain is future
-// work for rounding::ToOdd.
+// convert<FP8>(x)); convertVia<Dst, Mid, Src> (below) is the
+// chain that is, rounding to odd at Mid.
 //
 // This is the generic implementation. Platforms may later provide
 // specializations (hardware cvt instructions); per design.md they
 // must produce results identical to this form.
 
 #include <bit>
+#include <cstddef>
 #include <cstdint>
 #include <limits>
 
 #include "opine/core/arith_detail.hpp"
 #include "opine/core/bits.hpp"
+#include "opine/core/hfp.hpp"
 #include "opine/core/pack_unpack.hpp"
 #include "opine/core/round_pack.hpp"
 #include "opine/core/type.hpp"
@@ -74,12 +77,36 @@ template <typename T>
 inline constexpr int max_unbiased_exp =
     max_biased_exp<T> - T::number::exponent_bias;
 
+// Significand bits every normal value carries: an IBM hex float's
+// leading hex digit may hold a single bit, leaving it three short of
+// its envelope.
+template <typename T>
+inline constexpr int min_precision =
+    T::number::significand::digit_count -
+    (is_hex_float<typename T::number> ? 3 : 0);
+
+// Unbiased exponent of the smallest normal (16^−65 for hex floats;
+// the ulp for fixed point, which has no subnormals).
+template <typename T>
+inline constexpr int min_normal_exp = [] {
+  if constexpr (is_hex_float<typename T::number>)
+    return -4 * (T::number::characteristic_bias + 1);
+  else if constexpr (is_fixed_point<typename T::number>)
+    return -T::number::fraction_digits;
+  else
+    return 1 - T::number::exponent_bias;
+}();
+
 // Weight (unbiased power of two) of the smallest positive value —
 // the bottom subnormal's ulp.
 template <typename T>
-inline constexpr int min_value_weight =
-    (1 - T::number::exponent_bias) -
-    (T::number::significand::digit_count - 1);
+inline constexpr int min_value_weight = [] {
+  if constexpr (is_fixed_point<typename T::number>)
+    return -T::number::fraction_digits;
+  else
+    return (1 - T::number::exponent_bias) -
+           (T::number::significand::digit_count - 1);
+}();
 
 } // namespace detail
 
@@ -97,20 +124,35 @@ inline constexpr int min_value_weight =
 // canonicalized regardless, and −0 converts to +0 when Dst has no
 // −0. Round-trip identity on bit patterns additionally requires
 // canonical inputs (x87) and holds for non-NaN patterns only.
+//
+// A posit Dst carries its full precision only near 1, so no source
+// converts into one exactly by this measure; a posit Src counts at
+// its envelope (most digits, widest scale) and is exact into any
+// float covering it — posit16 → float64. A hex float Dst counts at
+// its narrowest, a leading digit of 1 (float32 → hfp64 is exact,
+// float32 → hfp32 is not), and has no subnormal range: it flushes
+// below 16^−65. A fixed-point Src counts at its word (q15 → float32
+// is exact); only another fixed-point Type of the same or no sign
+// receives one exactly, and no floating-point Src converts into
+// fixed point exactly (a NaN has nowhere to go).
 template <typename Src, typename Dst>
 inline constexpr bool exact_conversion =
-    Dst::number::significand::digit_count >=
-        Src::number::significand::digit_count &&
+    !detail::is_posit<typename Dst::number> &&
+    (!detail::is_fixed_point<typename Dst::number> ||
+     (detail::is_fixed_point<typename Src::number> &&
+      (Src::number::value_sign == SignMethod::Unsigned ||
+       Dst::number::value_sign == SignMethod::RadixComplement))) &&
+    detail::min_precision<Dst> >= Src::number::significand::digit_count &&
     detail::max_unbiased_exp<Dst> >= detail::max_unbiased_exp<Src> &&
     detail::min_value_weight<Dst> <= detail::min_value_weight<Src> &&
     (Dst::number::denormal_mode == DenormalMode::Full ||
-     detail::min_value_weight<Src> >= 1 - Dst::number::exponent_bias);
+     detail::min_value_weight<Src> >= detail::min_normal_exp<Dst>);
 
-// -----------------------------------------------------------------
-// convert
-// -----------------------------------------------------------------
+namespace detail {
+
+// The general conversion kernel: any pair, rounding per Dst.
 template <typename Dst, typename Src>
-constexpr auto convert(typename Src::storage_type bits) {
+constexpr auto convertRounded(typename Src::storage_type bits) {
   using SrcNum = typename Src::number;
   using DstNum = typename Dst::number;
   using SrcStorage = typename Src::storage_type;
@@ -133,21 +175,30 @@ constexpr auto convert(typename Src::storage_type bits) {
 
   // ---------- Special value dispatch ----------
 
-  if (u.category == ValueCategory::NaN)
-    return detail::deliver<Dst>(
-        detail::packSpecial<Dst>(ValueCategory::NaN, false), FlagNone);
+  if (u.category == ValueCategory::NaN) {
+    // A hex float or fixed-point word has no NaN and no saturating
+    // reading of one: +0, invalid.
+    constexpr flags_t NanFlags =
+        detail::is_hex_float<DstNum> || detail::is_fixed_point<DstNum>
+            ? FlagInvalid
+            : FlagNone;
+    return detail::deliver<Dst, Operation::Convert>(
+        detail::packSpecial<Dst>(ValueCategory::NaN, false), NanFlags);
+  }
   if (u.category == ValueCategory::Infinity) {
     // Inf into a format with no Inf encoding saturates: the value
-    // exceeded every finite — overflow + inexact.
+    // exceeded every finite — overflow + inexact. A posit has no
+    // value for it at all: NaR, invalid.
     constexpr flags_t InfFlags =
-        DstNum::inf_encoding == InfEncoding::None
+        detail::is_posit<DstNum> ? FlagInvalid
+        : DstNum::inf_encoding == InfEncoding::None
             ? flags_t(FlagOverflow | FlagInexact)
             : FlagNone;
-    return detail::deliver<Dst>(detail::packInfOrSaturate<Dst>(u.sign),
-                                InfFlags);
+    return detail::deliver<Dst, Operation::Convert>(
+        detail::packInfOrSaturate<Dst>(u.sign), InfFlags);
   }
   if (u.category == ValueCategory::Zero)
-    return detail::deliver<Dst>(
+    return detail::deliver<Dst, Operation::Convert>(
         detail::packSpecial<Dst>(ValueCategory::Zero, u.sign), FlagNone);
 
   // ---------- Finite ----------
@@ -175,7 +226,144 @@ constexpr auto convert(typename Src::storage_type bits) {
 
   flags_t flags = FlagNone;
   auto out = detail::roundAndPack<Dst>(u.sign, result_exp, magnitude, flags);
-  return detail::deliver<Dst>(out, flags);
+  return detail::deliver<Dst, Operation::Convert>(out, flags);
+}
+
+// Pairs whose finite values convert by moving fields: the
+// conversion is exact, both storages are scalar words and both
+// layouts keep the leading digit implicit (so a Src normal is
+// normalized as unpacked — no x87 unnormals; a fixed-point Src
+// unpacks normalized too). Dst must not encode
+// Inf at the integer extremes: there the top finite pattern can
+// collide with Inf, which only roundAndPack resolves.
+template <typename Src, typename Dst>
+inline constexpr bool field_copy_conversion =
+    exact_conversion<Src, Dst> &&
+    !is_digit_vector<typename Src::storage_type> &&
+    !is_digit_vector<typename Dst::storage_type> &&
+    (Src::layout::implicit_digit || is_fixed_point<typename Src::number>) &&
+    Dst::layout::implicit_digit &&
+    Dst::number::inf_encoding != InfEncoding::IntegerExtremes;
+
+// A finite Src value as Dst, exactly: the exponent rebased and the
+// significand moved up to Dst's width. A Src subnormal normalizes
+// with one leading-bit search; a value below Dst's normal range
+// shifts back down, losing nothing (the pair is exact).
+template <typename Dst, typename Src>
+constexpr UnpackedFloat<typename Dst::storage_type>
+rebaseExact(const UnpackedFloat<typename Src::storage_type> &u) {
+  using DstStorage = typename Dst::storage_type;
+  constexpr int SrcSigBits = Src::number::significand::digit_count;
+  constexpr int DstSigBits = Dst::number::significand::digit_count;
+  constexpr int Rebias =
+      Dst::number::exponent_bias - Src::number::exponent_bias;
+
+  DstStorage sig = shiftWordLeft(DstStorage(u.significand),
+                                 DstSigBits - SrcSigBits);
+  int e = u.biased_exp + Rebias;
+  if (u.biased_exp == 0) [[unlikely]] {
+    const int up = (SrcSigBits - 1) - wordTopBit(u.significand);
+    sig = shiftWordLeft(sig, up);
+    e = 1 + Rebias - up;
+  }
+  if (e < 1) {
+    sig = shiftWordRight(sig, 1 - e);
+    e = 0;
+  }
+  return {ValueCategory::Finite, u.sign, e, sig};
+}
+
+} // namespace detail
+
+// -----------------------------------------------------------------
+// convert
+// -----------------------------------------------------------------
+// Exact pairs (field_copy_conversion: float16 → float32, FP8 →
+// bfloat16, ...) take finite values through rebaseExact and pack —
+// no working integer, no rounding; everything else, and their
+// specials, through convertRounded. Both give the same bits and
+// flags. HFP short and long against an IEEE binary word
+// (hex_binary_pair) convert in one 64-bit word through hfp.hpp's
+// hexToBinary and binaryToHex, again to the same bits and flags.
+// Pairs with a decimal side are decimal.hpp's.
+template <typename Dst, typename Src>
+  requires(!detail::is_decimal<typename Dst::number> &&
+           !detail::is_decimal<typename Src::number>)
+constexpr auto convert(typename Src::storage_type bits) {
+  if constexpr (detail::hex_binary_pair<Src, Dst>) {
+    if constexpr (detail::is_hex_float<typename Src::number>)
+      return detail::hexToBinary<Dst, Src>(bits);
+    else
+      return detail::binaryToHex<Dst, Src>(bits);
+  } else if constexpr (detail::field_copy_conversion<Src, Dst>) {
+    const auto u = detail::unpackOperand<Src>(bits);
+    if (u.category == ValueCategory::Finite) [[likely]]
+      return detail::deliver<Dst, Operation::Convert>(
+          pack<Dst>(detail::rebaseExact<Dst, Src>(u)), FlagNone);
+  }
+  return detail::convertRounded<Dst, Src>(bits);
+}
+
+// -----------------------------------------------------------------
+// convertVia
+// -----------------------------------------------------------------
+// Conversion through an intermediate format with the direct
+// conversion's result:
+//
+//   auto q = convertVia<fp8_e4m3, float32, float64>(x);
+//   // == convert<fp8_e4m3, float64>(x), bits and flags
+//
+// The first step rounds to odd at Mid (an inexact result keeps a 1
+// in its last place, so "something was lost" survives); the second
+// rounds to Dst under Dst's own Rounding. With Mid at least two
+// bits more precise than Dst wherever Dst rounds, the odd last
+// place sits strictly below Dst's round bit and acts as its sticky
+// bit: every mode — directed, to-nearest (ties included) and to
+// odd — then decides exactly as it would on the source value. So
+// a Src → Mid step that is cheap (a hardware convert, a table) can
+// stand in for the generic kernel at the full width.
+//
+// via_correctly_rounded<Mid, Dst> is the compile-time condition:
+//
+//   - precision: Mid has at least p_Dst + 2 significand digits;
+//   - range: Mid's top binade reaches Dst's; and Mid's smallest
+//     weight is at least two binades below Dst's, so Dst's
+//     subnormals keep two extra bits as well;
+//   - Mid keeps its subnormals (DenormalMode::Full): a flushed
+//     tiny value would lose its sticky bit.
+//
+// NaN, infinities and zeros take the direct conversion (they do
+// not round, and Mid may not encode them), and so does a value
+// beyond Mid: to odd saturates it to Mid's max finite, which need
+// not overflow a Dst sharing Mid's top binade (float32 → bfloat16
+// truncating). Otherwise the flags are the second step's — the only
+// rounding Dst sees. Mid's own Rounding and Exceptions axes are not
+// used.
+template <typename Mid, typename Dst>
+inline constexpr bool via_correctly_rounded =
+    Mid::number::significand::digit_count >=
+        Dst::number::significand::digit_count + 2 &&
+    detail::max_unbiased_exp<Mid> >= detail::max_unbiased_exp<Dst> &&
+    detail::min_value_weight<Mid> <= detail::min_value_weight<Dst> - 2 &&
+    Mid::number::denormal_mode == DenormalMode::Full;
+
+template <typename Dst, typename Mid, typename Src>
+constexpr auto convertVia(typename Src::storage_type bits) {
+  static_assert(via_correctly_rounded<Mid, Dst>,
+                "convertVia needs Mid at least two bits wider than Dst "
+                "over Dst's whole range, with subnormals "
+                "(via_correctly_rounded)");
+  using MidOdd = WithExceptions<WithRounding<Mid, rounding::ToOdd>,
+                                exceptions::ReturnStatus>;
+  using DstS = WithExceptions<Dst, exceptions::ReturnStatus>;
+
+  if (detail::unpackOperand<Src>(bits).category != ValueCategory::Finite)
+    return convert<Dst, Src>(bits);
+  const auto m = convert<MidOdd, Src>(bits);
+  if (m.flags & FlagOverflow) [[unlikely]]
+    return convert<Dst, Src>(bits);
+  const auto r = convert<DstS, MidOdd>(m.bits);
+  return detail::deliver<Dst, Operation::Convert>(r.bits, r.flags);
 }
 
 // -----------------------------------------------------------------
@@ -184,9 +372,10 @@ constexpr auto convert(typename Src::storage_type bits) {
 // fromNative / toFloat / toDouble connect OPINE Types to the
 // platform's IEEE 754 binary32/binary64 via bit_cast + convert.
 // These are the intended way to construct OPINE values from
-// numeric literals.
+// numeric literals. Decimal Types have their own (decimal.hpp).
 
 template <typename T>
+  requires(!detail::is_decimal<typename T::number>)
 constexpr auto fromNative(float v) {
   static_assert(std::numeric_limits<float>::is_iec559 &&
                     sizeof(float) == 4,
@@ -196,6 +385,7 @@ constexpr auto fromNative(float v) {
 }
 
 template <typename T>
+  requires(!detail::is_decimal<typename T::number>)
 constexpr auto fromNative(double v) {
   static_assert(std::numeric_limits<double>::is_iec559 &&
                     sizeof(double) == 8,
@@ -205,6 +395,7 @@ constexpr auto fromNative(double v) {
 }
 
 template <typename T>
+  requires(!detail::is_decimal<typename T::number>)
 constexpr float toFloat(typename T::storage_type bits) {
   static_assert(std::numeric_limits<float>::is_iec559 &&
                     sizeof(float) == 4,
@@ -214,6 +405,7 @@ constexpr float toFloat(typename T::storage_type bits) {
 }
 
 template <typename T>
+  requires(!detail::is_decimal<typename T::number>)
 constexpr double toDouble(typename T::storage_type bits) {
   static_assert(std::numeric_limits<double>::is_iec559 &&
                     sizeof(double) == 8,
@@ -222,6 +414,79 @@ constexpr double toDouble(typename T::storage_type bits) {
       std::uint64_t(convert<float64, T>(bits)));
 }
 
+// -----------------------------------------------------------------
+// Table conversion for small sources
+// -----------------------------------------------------------------
+// A Src of at most 16 bits has at most 65,536 patterns, so every
+// conversion out of it can be computed once and then looked up:
+//
+//   auto y = convertByTable<float32, fp8_e4m3>(x); // one load
+//
+// gives exactly convert<Dst, Src>(x) — bits from the table, flags
+// from a parallel one, delivered per Dst's Exceptions axis. The
+// table is filled by the generic kernel: at compile time for 8-bit
+// sources (a constant, usable in constant expressions too), on
+// first use for wider ones (thread-safe, 65,536 conversions, then
+// kept for the program's life — for float32 that is 320 KiB).
+// Types differing only in Exceptions share one table.
+template <typename Dst, typename Src> struct ConversionTable {
+  static_assert(Src::layout::total_bits <= 16,
+                "conversion tables are for sources of at most 16 bits");
+  static constexpr std::size_t size = std::size_t{1}
+                                      << Src::layout::total_bits;
+
+  constexpr ConversionTable() : bits{}, flags{} {
+    using S = WithExceptions<Dst, exceptions::ReturnStatus>;
+    for (std::size_t i = 0; i < size; ++i) {
+      const auto r = convert<S, Src>(typename Src::storage_type(i));
+      bits[i] = r.bits;
+      flags[i] = r.flags;
+    }
+  }
+
+  typename Dst::storage_type bits[size];
+  flags_t flags[size];
+};
+
+namespace detail {
+
+template <typename Dst, typename Src>
+using TableFor =
+    ConversionTable<WithExceptions<Dst, exceptions::ReturnStatus>, Src>;
+
+template <typename Dst, typename Src>
+inline constexpr TableFor<Dst, Src> constant_conversion_table{};
+
+template <typename Table> const Table &lazyConversionTable() {
+  static const Table table;
+  return table;
+}
+
+} // namespace detail
+
+template <typename Dst, typename Src>
+  requires(Src::layout::total_bits <= 8)
+constexpr const detail::TableFor<Dst, Src> &conversionTable() {
+  return detail::constant_conversion_table<Dst, Src>;
+}
+
+template <typename Dst, typename Src>
+  requires(Src::layout::total_bits > 8 && Src::layout::total_bits <= 16)
+const detail::TableFor<Dst, Src> &conversionTable() {
+  return detail::lazyConversionTable<detail::TableFor<Dst, Src>>();
+}
+
+template <typename Dst, typename Src>
+constexpr auto convertByTable(typename Src::storage_type bits) {
+  const auto &table = conversionTable<Dst, Src>();
+  // Bits above the Layout's word are not part of the value (unpack
+  // masks them off too); they must not reach the index.
+  const std::size_t i =
+      std::size_t(bits) & (ConversionTable<Dst, Src>::size - 1);
+  return detail::deliver<Dst, Operation::Convert>(table.bits[i],
+                                                  table.flags[i]);
+}
+
 } // namespace opine
 
 #endif // OPINE_CORE_CONVERT_HPP
@@ -0,0 +1,172 @@
+#ifndef OPINE_CORE_COUNTING_HPP
+#define OPINE_CORE_COUNTING_HPP
+
+// Exception counters for the Counting policy: numeric-health
+// telemetry from running code, no debugger and no second run.
+//
+//   using T = Type<..., exceptions::Counting<>>;
+//   ... run the workload ...
+//   FlagCounts c = flagCounts<T>();
+//   c.calls[int(Operation::Mul)];                    // muls so far
+//   c.count(Operation::Mul, FlagOverflow);           // ... overflowed
+//   std::puts(toJson(c).c_str());
+//
+// Every thread counts into a shard of its own — one row per
+// Operation, a call counter and one counter per flag — so an
+// operation adds one to its call counter and one per flag raised,
+// with no lock and no contended cache line. flagCounts<T> sums the
+// shards of every live thread plus what exited threads left behind;
+// it is a snapshot, so counts still being added while it runs land
+// in it or in the next one. Counts are per Type: give a call site a
+// Type of its own to count it apart.
+
+#include <atomic>
+#include <bit>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "opine/core/exceptions.hpp"
+
+namespace opine {
+
+// A snapshot of one Type's counters.
+struct FlagCounts {
+  std::uint64_t calls[OperationCount] = {};
+  std::uint64_t raised[OperationCount][5] = {}; // by flag bit
+
+  // How many op results raised flag (one flag).
+  std::uint64_t count(Operation op, flags_t flag) const {
+    return raised[int(op)][std::countr_zero(unsigned(flag))];
+  }
+};
+
+namespace detail {
+
+struct CounterShard;
+
+struct CounterRegistry {
+  std::mutex lock;
+  std::vector<const CounterShard *> live;
+  FlagCounts retired; // left by exited threads
+};
+
+template <typename T> CounterRegistry &counterRegistry() {
+  static CounterRegistry registry;
+  return registry;
+}
+
+// One thread's counters for one Type. Only the owning thread writes
+// them; the atomics (relaxed loads and stores, plain moves on every
+// mainstream target) are there so a snapshot may read them.
+struct CounterShard {
+  explicit CounterShard(CounterRegistry &r) : registry(r) {
+    std::lock_guard<std::mutex> g(registry.lock);
+    registry.live.push_back(this);
+  }
+  ~CounterShard() {
+    std::lock_guard<std::mutex> g(registry.lock);
+    addTo(registry.retired);
+    std::erase(registry.live, this);
+  }
+
+  CounterShard(const CounterShard &) = delete;
+  CounterShard &operator=(const CounterShard &) = delete;
+
+  void record(Operation op, flags_t flags) {
+    std::atomic<std::uint64_t> *row = n[int(op)];
+    bump(row[5]);
+    for (unsigned f = flags & 0x1F; f != 0; f &= f - 1)
+      bump(row[std::countr_zero(f)]);
+  }
+
+  void addTo(FlagCounts &c) const {
+    for (int op = 0; op < OperationCount; ++op) {
+      c.calls[op] += n[op][5].load(std::memory_order_relaxed);
+      for (int k = 0; k < 5; ++k)
+        c.raised[op][k] += n[op][k].load(std::memory_order_relaxed);
+    }
+  }
+
+  static void bump(std::atomic<std::uint64_t> &c) {
+    c.store(c.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+  }
+
+  std::atomic<std::uint64_t> n[OperationCount][6] = {}; // 5 flags, calls
+  CounterRegistry &registry;
+};
+
+template <typename T> CounterShard &counterShard() {
+  thread_local CounterShard shard(counterRegistry<T>());
+  return shard;
+}
+
+// deliver's hook (round_pack.hpp).
+template <typename T> struct OperationCounter {
+  static void record(Operation op, flags_t flags) {
+    counterShard<T>().record(op, flags);
+  }
+};
+
+} // namespace detail
+
+// The counts of every thread that has run a Counting operation of
+// T, the live ones and the exited ones.
+template <typename T> FlagCounts flagCounts() {
+  detail::CounterRegistry &r = detail::counterRegistry<T>();
+  std::lock_guard<std::mutex> g(r.lock);
+  FlagCounts c = r.retired;
+  for (const detail::CounterShard *s : r.live)
+    s->addTo(c);
+  return c;
+}
+
+namespace detail {
+
+inline constexpr const char *FlagNames[5] = {"invalid", "divByZero",
+                                             "overflow", "underflow",
+                                             "inexact"};
+
+} // namespace detail
+
+// One line per operation that ran:
+//   mul calls=1000 invalid=0 divByZero=0 overflow=3 underflow=0 inexact=412
+inline std::string toText(const FlagCounts &c) {
+  std::string s;
+  for (int op = 0; op < OperationCount; ++op) {
+    if (c.calls[op] == 0)
+      continue;
+    s += operationName(Operation(op));
+    s += " calls=" + std::to_string(c.calls[op]);
+    for (int k = 0; k < 5; ++k)
+      s += std::string(" ") + detail::FlagNames[k] + "=" +
+           std::to_string(c.raised[op][k]);
+    s += '\n';
+  }
+  return s;
+}
+
+// One object, keyed by operation (those that ran), each with calls
+// and a count per flag:
+//   {"mul": {"calls": 1000, "invalid": 0, ..., "inexact": 412}}
+inline std::string toJson(const FlagCounts &c) {
+  std::string s = "{";
+  for (int op = 0; op < OperationCount; ++op) {
+    if (c.calls[op] == 0)
+      continue;
+    if (s.size() > 1)
+      s += ", ";
+    s += std::string("\"") + operationName(Operation(op)) +
+         "\": {\"calls\": " + std::to_string(c.calls[op]);
+    for (int k = 0; k < 5; ++k)
+      s += std::string(", \"") + detail::FlagNames[k] +
+           "\": " + std::to_string(c.raised[op][k]);
+    s += '}';
+  }
+  return s + "}";
+}
+
+} // namespace opine
+
+#endif // OPINE_CORE_COUNTING_HPP
@@ -0,0 +1,727 @@
+#ifndef OPINE_CORE_DECIMAL_HPP
+#define OPINE_CORE_DECIMAL_HPP
+
+// Arithmetic for IEEE 754 decimal Types (decimal32/64/128, BID or
+// DPD).
+//
+//   add<decimal64>(a, b), sub, mul, div, fma   — correctly rounded
+//   convert<decimal64, float64>(x) and back    — any pair with a
+//                                                decimal side
+//   fromInt, toInt, toIntSaturating            — as integer.hpp's
+//   fromNative, toFloat, toDouble              — as convert.hpp's
+//
+// Comparison, classification, neg/abs/copySign and the codec need
+// nothing here: compare.hpp orders decimal cohorts, classify.hpp
+// knows decimal subnormals, and unpack/pack (pack_unpack.hpp) speak
+// both encodings. These overloads take over from the binary kernels by
+// constraint, so call sites read the same for every Type.
+//
+// The pipeline is the binary one's shape with radix 10:
+//
+//   prologue : unpack — the integer coefficient C and quantum
+//              exponent q of C · 10^q;
+//   kernel   : an exact (or sticky-jammed) coefficient m at some
+//              exponent, in radix-10^19 limbs (decimal_digits.hpp);
+//   epilogue : roundDecimal — the P-digit coefficient nearest the
+//              preferred exponent, rounded per the Type's Rounding.
+//
+// What differs from binary is the epilogue's target. A decimal
+// result is a member of a cohort, and IEEE 754 (§5.2) fixes which:
+// an exact result takes the representable exponent closest to the
+// operation's preferred exponent (min(qa, qb) for add, qa + qb for
+// mul, qa − qb for div) — so 2.40 / 2 is 1.20, not 1.2 — and an
+// inexact one the full P digits. Tininess is detected before
+// rounding, the decimal rule (§7.5).
+//
+// Kernels keep everything they drop in a sticky flag below at least
+// one round digit, so the epilogue decides exactly as it would on
+// the infinitely precise value:
+//
+//   add/sub: operands within reach of each other align exactly
+//            (2P + 3 digits); past that the smaller one is wholly
+//            below the larger one's scaled last digit and only jams
+//            the sticky (a borrow of one for subtraction).
+//   mul:     the exact 2P-digit product.
+//   div:     C_a · 10^k / C_b with k chosen so the quotient has at
+//            least P + 1 digits; the remainder is the sticky.
+//   fma:     the exact product into add's kernel at 4P + 1 digits.
+//
+// Conversions reuse the string kernels: decimal → binary is the
+// correctly rounded parse of "C e q"; binary → decimal streams
+// P + 1 digits of the exact expansion (its tail is the sticky) into
+// roundDecimal, with preferred exponent 0. Decimal → decimal is
+// roundDecimal alone, or between the BID and DPD encodings of one
+// format, unpack and pack alone: the same value, no flags.
+//
+// NaN results are the canonical quiet NaN; NaN operands raise no
+// flag (no signaling NaN is modelled, as for binary). The Alternate
+// exception policy rewrites results with binary packing and is
+// rejected on decimal Types (a static_assert in deliver); every other
+// Exceptions axis is supported.
+//
+// Not implemented: sqrt, quantize/sameQuantum, and the string API
+// (string.hpp), whose kernels assume a binary significand and which
+// is constrained to non-decimal Types.
+
+#include <bit>
+#include <charconv>
+#include <cstdint>
+#include <limits>
+#include <string_view>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+
+#include "opine/core/arith_detail.hpp"
+#include "opine/core/decimal_digits.hpp"
+#include "opine/core/exceptions.hpp"
+#include "opine/core/integer.hpp"
+#include "opine/core/pack_unpack.hpp"
+#include "opine/core/round_pack.hpp"
+#include "opine/core/string.hpp"
+#include "opine/core/type.hpp"
+
+namespace opine {
+namespace detail {
+
+// Working geometry of a decimal Type; exponents here are quantum
+// exponents q (value = C · 10^q), unbiased.
+template <typename T> struct DecimalGeometry {
+  static constexpr int P = T::number::significand::digit_count;
+  static constexpr int Bias = T::number::exponent_bias;
+  static constexpr int Qmin = -Bias;
+  static constexpr int Qmax = max_biased_exp<T> - Bias;
+
+  static constexpr int limbsFor(int digits) {
+    return (digits + DecimalLimbDigits - 1) / DecimalLimbDigits;
+  }
+  static constexpr int CoefficientLimbs = limbsFor(P);
+  static constexpr int AddLimbs = limbsFor(2 * P + 3);
+  static constexpr int MulLimbs = 2 * CoefficientLimbs;
+  static constexpr int DivLimbs = limbsFor(2 * P + 1);
+  static constexpr int FmaLimbs = limbsFor(4 * P + 1);
+};
+
+template <typename T, int Count>
+constexpr DecimalVector<Count>
+decimalCoefficient(const UnpackedFloat<typename T::storage_type> &u) {
+  return resizeDigits<Count>(
+      decimalFromWord<DecimalGeometry<T>::CoefficientLimbs>(u.significand));
+}
+
+template <typename T>
+constexpr int decimalExponent(const UnpackedFloat<typename T::storage_type> &u) {
+  return u.biased_exp - DecimalGeometry<T>::Bias;
+}
+
+template <typename T>
+constexpr typename T::storage_type packDecimalZero(bool sign, int q) {
+  using G = DecimalGeometry<T>;
+  UnpackedFloat<typename T::storage_type> u{};
+  u.category = ValueCategory::Zero;
+  u.sign = sign;
+  u.biased_exp = (q < G::Qmin ? G::Qmin : q > G::Qmax ? G::Qmax : q) + G::Bias;
+  return pack<T>(u);
+}
+
+// -----------------------------------------------------------------
+// Epilogue: roundDecimal
+// -----------------------------------------------------------------
+// The value is (m + δ) · 10^q with 0 < δ < 1 when sticky, δ = 0
+// otherwise. A sticky kernel leaves m at least P + 1 digits long (or
+// below the subnormal boundary by at least one digit), so the round
+// digit is always one of m's own.
+template <typename T, int Count>
+constexpr typename T::storage_type
+roundDecimal(bool sign, int q, const DecimalVector<Count> &m, bool sticky,
+             int preferred, flags_t &flags) {
+  using G = DecimalGeometry<T>;
+  using Rnd = typename T::rounding;
+  using Storage = typename T::storage_type;
+  using Limbs = DecimalVector<Count>;
+
+  const int top = topDigitPos(m);
+  if (top < 0 && !sticky)
+    return packDecimalZero<T>(sign, preferred);
+
+  auto finite = [&](const Limbs &c, int e) {
+    UnpackedFloat<Storage> u{};
+    u.category = ValueCategory::Finite;
+    u.sign = sign;
+    u.biased_exp = e + G::Bias;
+    u.significand = wordFromDecimal<Storage>(
+        resizeDigits<G::CoefficientLimbs>(c));
+    return isZero(c) ? packDecimalZero<T>(sign, e) : pack<T>(u);
+  };
+  auto overflow = [&] {
+    flags |= FlagOverflow | FlagInexact;
+    return overflowRoundsToInf<Rnd>(sign)
+               ? packSpecial<T>(ValueCategory::Infinity, sign)
+               : packMaxFinite<T>(sign);
+  };
+
+  // The smallest exponent at which m fits P digits.
+  const int n = top + 1;
+  const int e_min = q + n - G::P > G::Qmin ? q + n - G::P : G::Qmin;
+
+  if (!sticky) {
+    // Exact when some exponent in [e_min, q + trailing zeros] holds
+    // m: take the one nearest the preferred exponent, clamping (with
+    // no flag) below an overflow the cohort can dodge.
+    const int e_max = q + trailingZeroDigits(m);
+    if (e_min <= e_max) {
+      int e = preferred < e_min ? e_min : preferred > e_max ? e_max : preferred;
+      if (e > G::Qmax) {
+        if (e_min > G::Qmax)
+          return overflow();
+        e = G::Qmax;
+      }
+      return finite(e >= q ? shiftRightDigits(m, e - q)
+                           : shiftLeftDigits(m, q - e),
+                    e);
+    }
+  }
+
+  // Inexact: P digits (fewer below the subnormal boundary) at e_min.
+  int e = e_min;
+  const int k = e - q;
+  int round_digit = 0;
+  bool rest = sticky;
+  Limbs c;
+  if (k > 0) {
+    round_digit = digitAt(m, k - 1);
+    rest = rest || anyDigitsBelow(m, k - 1);
+    c = shiftRightDigits(m, k);
+  } else {
+    c = shiftLeftDigits(m, -k);
+  }
+  if (shouldRoundUp<Rnd>((c.d[0] & 1) != 0, round_digit >= 5, false,
+                         (round_digit != 0 && round_digit != 5) || rest,
+                         sign)) {
+    c = addSmallDigits(c, 1);
+    if (topDigitPos(c) == G::P) { // 10^P: one digit fewer, one place up
+      c = shiftRightDigits(c, 1);
+      ++e;
+    }
+  }
+  flags |= FlagInexact;
+  if (q + n - 1 < G::Qmin + G::P - 1) // below 10^emin before rounding
+    flags |= FlagUnderflow;
+  if (e > G::Qmax)
+    return overflow();
+  return finite(c, e);
+}
+
+// -----------------------------------------------------------------
+// Kernels
+// -----------------------------------------------------------------
+
+// (sa, ca · 10^qa) + (sb, cb · 10^qb), rounded. Count must hold the
+// aligned sum: max(na, P + 2) + nb + 1 digits for na- and nb-digit
+// coefficients.
+template <typename T, int Count>
+constexpr typename T::storage_type
+addDecimalCore(bool sa, DecimalVector<Count> ca, int qa, bool sb,
+               DecimalVector<Count> cb, int qb, flags_t &flags) {
+  using G = DecimalGeometry<T>;
+  using Rnd = typename T::rounding;
+  using Limbs = DecimalVector<Count>;
+
+  const int preferred = qa < qb ? qa : qb;
+  const bool za = isZero(ca), zb = isZero(cb);
+  if (za && zb)
+    return packDecimalZero<T>(sa == sb ? sa : exactZeroSumSign<Rnd>(),
+                              preferred);
+  if (za)
+    return roundDecimal<T>(sb, qb, cb, false, preferred, flags);
+  if (zb)
+    return roundDecimal<T>(sa, qa, ca, false, preferred, flags);
+
+  if (qa < qb) {
+    std::swap(sa, sb);
+    std::swap(ca, cb);
+    std::swap(qa, qb);
+  }
+  const int s = qa - qb;
+  const int na = topDigitPos(ca) + 1, nb = topDigitPos(cb) + 1;
+  const int t = G::P + 2 - na > 0 ? G::P + 2 - na : 0;
+
+  if (s >= nb + t + 1) {
+    // b < 10^(qa − t − 1): below the last digit of a scaled to at
+    // least P + 3 digits, it only decides the sticky. Subtracting
+    // it borrows one from that digit and leaves a nonzero fraction.
+    Limbs m = shiftLeftDigits(ca, t + 1);
+    if (sa != sb)
+      m = subDigits(m, decimalFrom<Count>(1));
+    return roundDecimal<T>(sa, qa - t - 1, m, true, preferred, flags);
+  }
+
+  const Limbs a = shiftLeftDigits(ca, s);
+  if (sa == sb)
+    return roundDecimal<T>(sa, qb, addDigits(a, cb), false, preferred, flags);
+  const int c = compareDigits(a, cb);
+  if (c == 0)
+    return packDecimalZero<T>(exactZeroSumSign<Rnd>(), preferred);
+  return c > 0 ? roundDecimal<T>(sa, qb, subDigits(a, cb), false, preferred,
+                                 flags)
+               : roundDecimal<T>(sb, qb, subDigits(cb, a), false, preferred,
+                                 flags);
+}
+
+template <typename T, Operation Op>
+constexpr auto addDecimal(typename T::storage_type a,
+                          typename T::storage_type b) {
+  using G = DecimalGeometry<T>;
+  const auto ua = unpackOperand<T>(a);
+  const auto ub = unpackOperand<T>(b);
+  const bool sb = ub.sign != (Op == Operation::Sub);
+
+  if (ua.category == ValueCategory::NaN || ub.category == ValueCategory::NaN)
+    return deliver<T, Op>(packSpecial<T>(ValueCategory::NaN, false),
+                          FlagNone);
+  const bool ia = ua.category == ValueCategory::Infinity;
+  const bool ib = ub.category == ValueCategory::Infinity;
+  if (ia && ib && ua.sign != sb)
+    return deliver<T, Op>(packSpecial<T>(ValueCategory::NaN, false),
+                          FlagInvalid);
+  if (ia || ib)
+    return deliver<T, Op>(
+        packSpecial<T>(ValueCategory::Infinity, ia ? ua.sign : sb), FlagNone);
+
+  flags_t flags = FlagNone;
+  const auto bits = addDecimalCore<T, G::AddLimbs>(
+      ua.sign, decimalCoefficient<T, G::AddLimbs>(ua), decimalExponent<T>(ua),
+      sb, decimalCoefficient<T, G::AddLimbs>(ub), decimalExponent<T>(ub),
+      flags);
+  return deliver<T, Op>(bits, flags);
+}
+
+} // namespace detail
+
+// -----------------------------------------------------------------
+// add / sub
+// -----------------------------------------------------------------
+template <typename T>
+  requires detail::is_decimal<typename T::number>
+constexpr auto add(typename T::storage_type a, typename T::storage_type b) {
+  return detail::addDecimal<T, Operation::Add>(a, b);
+}
+
+template <typename T>
+  requires detail::is_decimal<typename T::number>
+constexpr auto sub(typename T::storage_type a, typename T::storage_type b) {
+  return detail::addDecimal<T, Operation::Sub>(a, b);
+}
+
+// -----------------------------------------------------------------
+// mul
+// -----------------------------------------------------------------
+template <typename T>
+  requires detail::is_decimal<typename T::number>
+constexpr auto mul(typename T::storage_type a, typename T::storage_type b) {
+  using G = detail::DecimalGeometry<T>;
+  constexpr int N = G::CoefficientLimbs;
+  const auto ua = detail::unpackOperand<T>(a);
+  const auto ub = detail::unpackOperand<T>(b);
+  const bool sign = ua.sign != ub.sign;
+
+  if (ua.category == ValueCategory::NaN || ub.category == ValueCategory::NaN)
+    return detail::deliver<T, Operation::Mul>(
+        detail::packSpecial<T>(ValueCategory::NaN, false), FlagNone);
+  const bool ia = ua.category == ValueCategory::Infinity;
+  const bool ib = ub.category == ValueCategory::Infinity;
+  if (ia || ib) {
+    if (ua.category == ValueCategory::Zero ||
+        ub.category == ValueCategory::Zero)
+      return detail::deliver<T, Operation::Mul>(
+          detail::packSpecial<T>(ValueCategory::NaN, false), FlagInvalid);
+    return detail::deliver<T, Operation::Mul>(
+        detail::packSpecial<T>(ValueCategory::Infinity, sign), FlagNone);
+  }
+
+  const int q = detail::decimalExponent<T>(ua) + detail::decimalExponent<T>(ub);
+  flags_t flags = FlagNone;
+  const auto product =
+      detail::mulDigits(detail::decimalCoefficient<T, N>(ua),
+                        detail::decimalCoefficient<T, N>(ub));
+  const auto bits = detail::roundDecimal<T>(sign, q, product, false, q, flags);
+  return detail::deliver<T, Operation::Mul>(bits, flags);
+}
+
+// -----------------------------------------------------------------
+// div
+// -----------------------------------------------------------------
+// x / ±Inf is a zero at the smallest exponent (the quotient is below
+// every representable magnitude); 0 / y has the preferred qa − qb.
+template <typename T>
+  requires detail::is_decimal<typename T::number>
+constexpr auto div(typename T::storage_type a, typename T::storage_type b) {
+  using G = detail::DecimalGeometry<T>;
+  constexpr int N = G::DivLimbs;
+  const auto ua = detail::unpackOperand<T>(a);
+  const auto ub = detail::unpackOperand<T>(b);
+  const bool sign = ua.sign != ub.sign;
+
+  if (ua.category == ValueCategory::NaN || ub.category == ValueCategory::NaN)
+    return detail::deliver<T, Operation::Div>(
+        detail::packSpecial<T>(ValueCategory::NaN, false), FlagNone);
+  if (ua.category == ValueCategory::Infinity) {
+    if (ub.category == ValueCategory::Infinity)
+      return detail::deliver<T, Operation::Div>(
+          detail::packSpecial<T>(ValueCategory::NaN, false), FlagInvalid);
+    return detail::deliver<T, Operation::Div>(
+        detail::packSpecial<T>(ValueCategory::Infinity, sign), FlagNone);
+  }
+  if (ub.category == ValueCategory::Infinity)
+    return detail::deliver<T, Operation::Div>(
+        detail::packDecimalZero<T>(sign, G::Qmin), FlagNone);
+  if (ub.category == ValueCategory::Zero) {
+    if (ua.category == ValueCategory::Zero)
+      return detail::deliver<T, Operation::Div>(
+          detail::packSpecial<T>(ValueCategory::NaN, false), FlagInvalid);
+    return detail::deliver<T, Operation::Div>(
+        detail::packSpecial<T>(ValueCategory::Infinity, sign),
+        FlagDivByZero);
+  }
+
+  const int preferred =
+      detail::decimalExponent<T>(ua) - detail::decimalExponent<T>(ub);
+  if (ua.category == ValueCategory::Zero)
+    return detail::deliver<T, Operation::Div>(
+        detail::packDecimalZero<T>(sign, preferred), FlagNone);
+
+  // Scale the dividend so the quotient has at least P + 1 digits.
+  auto num = detail::decimalCoefficient<T, N>(ua);
+  auto den = detail::decimalCoefficient<T, N>(ub);
+  const int k = G::P + 1 - (detail::topDigitPos(num) + 1) +
+                (detail::topDigitPos(den) + 1);
+  num = detail::shiftLeftDigits(num, k);
+  detail::DecimalVector<N> quot;
+  detail::divModLongDigitsInPlace(num, den, quot);
+
+  flags_t flags = FlagNone;
+  const auto bits = detail::roundDecimal<T>(
+      sign, preferred - k, quot, !detail::isZero(num), preferred, flags);
+  return detail::deliver<T, Operation::Div>(bits, flags);
+}
+
+// -----------------------------------------------------------------
+// fma
+// -----------------------------------------------------------------
+// a×b + c with one rounding; specials as for binary fma (a NaN
+// operand is quiet even beside Inf × 0). The preferred exponent is
+// min(qa + qb, qc).
+template <typename T>
+  requires detail::is_decimal<typename T::number>
+constexpr auto fma(typename T::storage_type a, typename T::storage_type b,
+                   typename T::storage_type c) {
+  using G = detail::DecimalGeometry<T>;
+  constexpr int N = G::FmaLimbs;
+  constexpr int C = G::CoefficientLimbs;
+  const auto ua = detail::unpackOperand<T>(a);
+  const auto ub = detail::unpackOperand<T>(b);
+  const auto uc = detail::unpackOperand<T>(c);
+  const bool ps = ua.sign != ub.sign;
+
+  if (ua.category == ValueCategory::NaN || ub.category == ValueCategory::NaN ||
+      uc.category == ValueCategory::NaN)
+    return detail::deliver<T, Operation::Fma>(
+        detail::packSpecial<T>(ValueCategory::NaN, false), FlagNone);
+  const bool pinf = ua.category == ValueCategory::Infinity ||
+                    ub.category == ValueCategory::Infinity;
+  const bool pzero = ua.category == ValueCategory::Zero ||
+                     ub.category == ValueCategory::Zero;
+  if (pinf && pzero)
+    return detail::deliver<T, Operation::Fma>(
+        detail::packSpecial<T>(ValueCategory::NaN, false), FlagInvalid);
+  if (pinf) {
+    if (uc.category == ValueCategory::Infinity && uc.sign != ps)
+      return detail::deliver<T, Operation::Fma>(
+          detail::packSpecial<T>(ValueCategory::NaN, false), FlagInvalid);
+    return detail::deliver<T, Operation::Fma>(
+        detail::packSpecial<T>(ValueCategory::Infinity, ps), FlagNone);
+  }
+  if (uc.category == ValueCategory::Infinity)
+    return detail::deliver<T, Operation::Fma>(
+        detail::packSpecial<T>(ValueCategory::Infinity, uc.sign), FlagNone);
+
+  const auto product = detail::resizeDigits<N>(
+      detail::mulDigits(detail::decimalCoefficient<T, C>(ua),
+                        detail::decimalCoefficient<T, C>(ub)));
+  flags_t flags = FlagNone;
+  const auto bits = detail::addDecimalCore<T, N>(
+      ps, product,
+      detail::decimalExponent<T>(ua) + detail::decimalExponent<T>(ub),
+      uc.sign, detail::decimalCoefficient<T, N>(uc),
+      detail::decimalExponent<T>(uc), flags);
+  return detail::deliver<T, Operation::Fma>(bits, flags);
+}
+
+// -----------------------------------------------------------------
+// convert
+// -----------------------------------------------------------------
+namespace detail {
+
+template <typename Dst, typename Src>
+constexpr auto convertDecimalToDecimal(typename Src::storage_type bits) {
+  constexpr int N = DecimalGeometry<Src>::CoefficientLimbs;
+  const auto u = unpackOperand<Src>(bits);
+  if constexpr (std::is_same_v<typename Dst::number, typename Src::number>)
+    return deliver<Dst, Operation::Convert>(pack<Dst>(u), FlagNone);
+  if (u.category == ValueCategory::NaN)
+    return deliver<Dst, Operation::Convert>(
+        packSpecial<Dst>(ValueCategory::NaN, false), FlagNone);
+  if (u.category == ValueCategory::Infinity)
+    return deliver<Dst, Operation::Convert>(
+        packSpecial<Dst>(ValueCategory::Infinity, u.sign), FlagNone);
+  const int q = decimalExponent<Src>(u);
+  if (u.category == ValueCategory::Zero)
+    return deliver<Dst, Operation::Convert>(packDecimalZero<Dst>(u.sign, q),
+                                            FlagNone);
+  flags_t flags = FlagNone;
+  const auto out = roundDecimal<Dst>(u.sign, q, decimalCoefficient<Src, N>(u),
+                                     false, q, flags);
+  return deliver<Dst, Operation::Convert>(out, flags);
+}
+
+// Decimal → binary: the correctly rounded parse of "±C e q".
+template <typename Dst, typename Src>
+auto convertDecimalToBinary(typename Src::storage_type bits) {
+  using DstNum = typename Dst::number;
+  constexpr int N = DecimalGeometry<Src>::CoefficientLimbs;
+  const auto u = unpackOperand<Src>(bits);
+  if (u.category == ValueCategory::NaN)
+    // As convertRounded: a fixed-point word has no NaN; 0, invalid.
+    return deliver<Dst, Operation::Convert>(
+        packSpecial<Dst>(ValueCategory::NaN, false),
+        is_fixed_point<DstNum> ? FlagInvalid : FlagNone);
+  if (u.category == ValueCategory::Infinity) {
+    // As convertRounded: saturating with overflow, or NaR.
+    constexpr flags_t InfFlags =
+        is_posit<DstNum> ? FlagInvalid
+        : DstNum::inf_encoding == InfEncoding::None
+            ? flags_t(FlagOverflow | FlagInexact)
+            : FlagNone;
+    return deliver<Dst, Operation::Convert>(packInfOrSaturate<Dst>(u.sign),
+                                            InfFlags);
+  }
+  if (u.category == ValueCategory::Zero)
+    return deliver<Dst, Operation::Convert>(
+        packSpecial<Dst>(ValueCategory::Zero, u.sign), FlagNone);
+
+  char text[N * DecimalLimbDigits + 16];
+  char *p = text;
+  if (u.sign)
+    *p++ = '-';
+  const auto c = decimalCoefficient<Src, N>(u);
+  bool leading = true;
+  for (int i = N - 1; i >= 0; --i) {
+    if (leading && c.d[i] == 0)
+      continue;
+    const int width = leading ? limbDigitCount(c.d[i]) : DecimalLimbDigits;
+    std::uint64_t x = c.d[i];
+    for (int j = width - 1; j >= 0; --j, x /= 10)
+      p[j] = char('0' + x % 10);
+    p += width;
+    leading = false;
+  }
+  *p++ = 'e';
+  p = std::to_chars(p, text + sizeof text, decimalExponent<Src>(u)).ptr;
+
+  typename Dst::storage_type out{};
+  flags_t flags = FlagNone;
+  parseChars<Dst>(text, p, out, flags); // always within the window
+  return deliver<Dst, Operation::Convert>(out, flags);
+}
+
+// Binary → decimal: P + 1 digits of the exact expansion, the rest
+// as sticky. A value outside the string kernels' window is far past
+// either end of every decimal range.
+template <typename Dst, typename Src>
+auto convertBinaryToDecimal(typename Src::storage_type bits) {
+  using G = DecimalGeometry<Dst>;
+  using Limbs = DecimalVector<G::limbsFor(G::P + 2)>;
+  const auto u = unpackOperand<Src>(bits);
+  if (u.category == ValueCategory::NaN)
+    return deliver<Dst, Operation::Convert>(
+        packSpecial<Dst>(ValueCategory::NaN, false), FlagNone);
+  if (u.category == ValueCategory::Infinity)
+    return deliver<Dst, Operation::Convert>(
+        packSpecial<Dst>(ValueCategory::Infinity, u.sign), FlagNone);
+  if (u.category == ValueCategory::Zero)
+    return deliver<Dst, Operation::Convert>(packDecimalZero<Dst>(u.sign, 0),
+                                            FlagNone);
+
+  Limbs m{};
+  auto sink = [&](std::string_view digits) {
+    for (const char ch : digits)
+      mulAddSmallDigitsInPlace(m, 10, std::uint64_t(ch - '0'));
+    return true;
+  };
+  const DigitStream ds = streamDecimalDigits<Src>(bits, G::P + 1, sink);
+  flags_t flags = FlagNone;
+  typename Dst::storage_type out;
+  if (ds.ok) {
+    out = roundDecimal<Dst>(ds.neg, int(ds.k10 - (ds.count - 1)), m,
+                            ds.inexact, 0, flags);
+  } else if (u.biased_exp >= Src::number::exponent_bias) {
+    out = roundDecimal<Dst>(u.sign, G::Qmax + 1,
+                            shiftLeftDigits(decimalFrom<Limbs::limb_count>(1),
+                                            G::P + 1),
+                            true, 0, flags);
+  } else {
+    out = roundDecimal<Dst>(u.sign, G::Qmin - 2, decimalFrom<Limbs::limb_count>(1),
+                            true, 0, flags);
+  }
+  return deliver<Dst, Operation::Convert>(out, flags);
+}
+
+} // namespace detail
+
+// Any pair with a decimal side; binary pairs keep convert.hpp's.
+// Conversions touching binary go through the string kernels and are
+// not constant-evaluable.
+template <typename Dst, typename Src>
+  requires(detail::is_decimal<typename Dst::number> ||
+           detail::is_decimal<typename Src::number>)
+constexpr auto convert(typename Src::storage_type bits) {
+  if constexpr (detail::is_decimal<typename Dst::number> &&
+                detail::is_decimal<typename Src::number>)
+    return detail::convertDecimalToDecimal<Dst, Src>(bits);
+  else if constexpr (detail::is_decimal<typename Src::number>)
+    return detail::convertDecimalToBinary<Dst, Src>(bits);
+  else
+    return detail::convertBinaryToDecimal<Dst, Src>(bits);
+}
+
+// -----------------------------------------------------------------
+// Integer conversion and the native bridges
+// -----------------------------------------------------------------
+// As integer.hpp's and convert.hpp's, on the coefficient: fromInt
+// is i · 10^0 through roundDecimal (exact up to P digits, preferred
+// exponent 0), and toInt shifts the coefficient to 10^0, the
+// dropped digits deciding the round. Same flags, same saturation.
+namespace detail {
+
+template <typename Int, typename T, typename Rnd>
+constexpr IntWithStatus<Int> roundDecimalToInt(typename T::storage_type bits) {
+  using G = DecimalGeometry<T>;
+  using U = IntMagnitude<Int>;
+  constexpr int N = int_bits<Int>;
+  // Every in-range magnitude is below 2^128 < 10^39.
+  constexpr int MaxDigits = 39;
+  constexpr int Count = G::limbsFor(G::P > MaxDigits ? G::P : MaxDigits);
+  using Limbs = DecimalVector<Count>;
+
+  const auto u = unpackOperand<T>(bits);
+  if (u.category == ValueCategory::NaN)
+    return {Int(0), FlagInvalid};
+  if (u.category == ValueCategory::Infinity)
+    return {saturatedInt<Int>(u.sign), FlagInvalid};
+  if (u.category == ValueCategory::Zero)
+    return {Int(0), FlagNone};
+
+  Limbs m = decimalCoefficient<T, Count>(u);
+  const int q = decimalExponent<T>(u);
+  bool up = false, inexact = false;
+  if (q >= 0) {
+    if (topDigitPos(m) + q >= MaxDigits) // no Int holds 10^39
+      return {saturatedInt<Int>(u.sign), FlagInvalid};
+    m = shiftLeftDigits(m, q);
+  } else {
+    const int k = -q;
+    const int round_digit = digitAt(m, k - 1);
+    const bool rest = anyDigitsBelow(m, k - 1);
+    m = shiftRightDigits(m, k);
+    inexact = round_digit != 0 || rest;
+    up = shouldRoundUp<Rnd>((m.d[0] & 1) != 0, round_digit >= 5, false,
+                            (round_digit != 0 && round_digit != 5) || rest,
+                            u.sign);
+  }
+  if (up)
+    m = addSmallDigits(m, 1);
+
+  const flags_t flags = inexact ? FlagInexact : FlagNone;
+  if (isZero(m))
+    return {Int(0), flags};
+  if constexpr (!int_signed<Int>) {
+    if (u.sign)
+      return {Int(0), FlagInvalid};
+  }
+  // |Int's extreme on this side|: 2^(N−1) − 1 or 2^(N−1), 2^N − 1.
+  U limit = U(~U{0});
+  if constexpr (int_signed<Int>)
+    limit = U((U{1} << (N - 1)) - U{1} + U(u.sign));
+  if (compareDigits(m, decimalFromWord<Count>(limit)) > 0)
+    return {saturatedInt<Int>(u.sign), FlagInvalid};
+  const U mag = wordFromDecimal<U>(m);
+  return {u.sign ? Int(U(U{0} - mag)) : Int(mag), flags};
+}
+
+} // namespace detail
+
+template <typename T, typename Int>
+  requires(detail::IntegerValue<Int> && detail::is_decimal<typename T::number>)
+constexpr auto fromInt(Int v) {
+  using G = detail::DecimalGeometry<T>;
+  using U = detail::IntMagnitude<Int>;
+  constexpr int Count = G::limbsFor(G::P > 39 ? G::P : 39);
+
+  bool neg = false;
+  if constexpr (detail::int_signed<Int>)
+    neg = v < Int(0);
+  const U mag = neg ? U(U{0} - U(v)) : U(v);
+  flags_t flags = FlagNone;
+  const auto bits = detail::roundDecimal<T>(
+      neg, 0, detail::decimalFromWord<Count>(mag), false, 0, flags);
+  return detail::deliver<T, Operation::Convert>(bits, flags);
+}
+
+template <typename Int, typename T, typename Rnd = typename T::rounding>
+  requires(detail::IntegerValue<Int> && detail::is_decimal<typename T::number>)
+constexpr auto toInt(typename T::storage_type bits) {
+  const IntWithStatus<Int> r = detail::roundDecimalToInt<Int, T, Rnd>(bits);
+  return detail::deliverInt<T, Int>(r.value, r.flags);
+}
+
+template <typename Int, typename T, typename Rnd = typename T::rounding>
+  requires(detail::IntegerValue<Int> && detail::is_decimal<typename T::number>)
+constexpr Int toIntSaturating(typename T::storage_type bits) {
+  return detail::roundDecimalToInt<Int, T, Rnd>(bits).value;
+}
+
+template <typename T>
+  requires detail::is_decimal<typename T::number>
+constexpr auto fromNative(float v) {
+  static_assert(std::numeric_limits<float>::is_iec559 &&
+                    sizeof(float) == 4,
+                "fromNative(float) requires IEEE 754 binary32");
+  return convert<T, float32>(
+      typename float32::storage_type(std::bit_cast<std::uint32_t>(v)));
+}
+
+template <typename T>
+  requires detail::is_decimal<typename T::number>
+constexpr auto fromNative(double v) {
+  static_assert(std::numeric_limits<double>::is_iec559 &&
+                    sizeof(double) == 8,
+                "fromNative(double) requires IEEE 754 binary64");
+  return convert<T, float64>(
+      typename float64::storage_type(std::bit_cast<std::uint64_t>(v)));
+}
+
+template <typename T>
+  requires detail::is_decimal<typename T::number>
+constexpr float toFloat(typename T::storage_type bits) {
+  return std::bit_cast<float>(std::uint32_t(convert<float32, T>(bits)));
+}
+
+template <typename T>
+  requires detail::is_decimal<typename T::number>
+constexpr double toDouble(typename T::storage_type bits) {
+  return std::bit_cast<double>(std::uint64_t(convert<float64, T>(bits)));
+}
+
+} // namespace opine
+
+#endif // OPINE_CORE_DECIMAL_HPP
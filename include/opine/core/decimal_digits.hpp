@@ -0,0 +1,551 @@
+#ifndef OPINE_CORE_DECIMAL_DIGITS_HPP
+#define OPINE_CORE_DECIMAL_DIGITS_HPP
+
+// DecimalVector: the radix-10^19 instantiation of digits.hpp.
+//
+// A decimal coefficient is a digit sequence of radix 10, and 10^19
+// is the largest power of ten a 64-bit limb holds — so nineteen
+// decimal digits chunk into one compute digit exactly as sixty-four
+// binary digits do in DigitVector. Decimal digit positions are then
+// addressable inside a limb the way bit positions are there: the
+// round digit, the any-digit-below sticky test and the top-digit
+// position are the same digit-boundary statements roundAndPack
+// makes, which is what lets decimal.hpp's epilogue keep its shape.
+//
+// The algorithms are the named ones of digits.hpp, overloaded on
+// the limb vector: addDigits, subDigits, compareDigits, mulDigits,
+// shiftLeftDigits / shiftRightDigits (by decimal digits),
+// topDigitPos, digitAt, anyDigitsBelow, divModLongDigitsInPlace.
+// Only the per-digit arithmetic differs from the binary ones:
+//
+//   - a carry or borrow is a compare against 10^19, not a wrap;
+//   - a double-width partial (< 10^38) splits into limb and carry by
+//     division by 10^19 — by reciprocal multiplication (Möller and
+//     Granlund's 2-by-1 division with a precomputed inverse; 10^19
+//     is above 2^63, so the divisor is already normalized), never a
+//     hardware divide;
+//   - a shift by r < 19 decimal digits splits each limb at 10^r,
+//     again by a reciprocal (one multiply-high, one correction step)
+//     rather than by repeated division by 10;
+//   - Algorithm D normalizes multiplicatively (Knuth's d = b/(v+1))
+//     instead of by a left shift, and estimates its quotient digit
+//     from the top two limbs as the binary one does.
+//
+// Conventions as in digits.hpp: d[0] is the least significant limb,
+// digit positions are absolute (digit p lives in limb p / 19),
+// arithmetic is modulo 10^(19·Count), and shift counts past the
+// vector empty it.
+
+#include <array>
+#include <bit>
+#include <cstdint>
+
+#include "opine/core/bits.hpp"
+#include "opine/core/digits.hpp"
+
+namespace opine {
+namespace detail {
+
+inline constexpr int DecimalLimbDigits = 19;
+inline constexpr std::uint64_t DecimalLimbRadix = 10000000000000000000ULL;
+
+template <int Count>
+  requires(Count > 0)
+struct DecimalVector {
+  static constexpr int limb_count = Count;
+  static constexpr int digit_count = DecimalLimbDigits * Count;
+
+  std::uint64_t d[Count]; // d[0] = least significant, each < 10^19
+
+  friend constexpr bool operator==(const DecimalVector &,
+                                   const DecimalVector &) = default;
+};
+
+// 10^0 … 10^19.
+inline constexpr std::array<std::uint64_t, 20> pow10Limb = [] {
+  std::array<std::uint64_t, 20> t{};
+  t[0] = 1;
+  for (int i = 1; i < 20; ++i)
+    t[i] = t[i - 1] * 10;
+  return t;
+}();
+
+// -----------------------------------------------------------------
+// Per-limb arithmetic
+// -----------------------------------------------------------------
+
+// A 64-bit divisor shifted up to its top bit, with its reciprocal
+// v = floor((2^128 − 1) / d) − 2^64: one 128-bit division per
+// divisor, then two multiplies per 2-by-1 step.
+struct LimbReciprocal {
+  std::uint64_t d;
+  std::uint64_t v;
+  int shift;
+};
+
+constexpr LimbReciprocal limbReciprocal(std::uint64_t den) {
+  using Double = bits_t<128>;
+  const int s = std::countl_zero(den);
+  const std::uint64_t d = den << s;
+  return {d, std::uint64_t(Double(~Double(0)) / d), s};
+}
+
+// (u1·2^64 + u0) / den and the remainder, for a quotient below
+// 2^64 (Möller & Granlund, "Improved division by invariant
+// integers", Algorithm 4, on the operands shifted with den).
+constexpr std::uint64_t divModLimb(std::uint64_t u1, std::uint64_t u0,
+                                   const LimbReciprocal &c,
+                                   std::uint64_t &rem) {
+  using Double = bits_t<128>;
+  if (c.shift != 0) {
+    u1 = (u1 << c.shift) | (u0 >> (64 - c.shift));
+    u0 <<= c.shift;
+  }
+  const Double q = Double(c.v) * u1 + ((Double(u1) << 64) | u0);
+  std::uint64_t q1 = std::uint64_t(q >> 64) + 1;
+  const std::uint64_t q0 = std::uint64_t(q);
+  std::uint64_t r = u0 - q1 * c.d;
+  if (r > q0) {
+    --q1;
+    r += c.d;
+  }
+  if (r >= c.d) {
+    ++q1;
+    r -= c.d;
+  }
+  rem = r >> c.shift;
+  return q1;
+}
+
+// (u1·2^64 + u0) / 10^19 and the remainder, for u1 < 10^19. 10^19
+// is already normalized, so its reciprocal is a constant.
+constexpr std::uint64_t divModRadix(std::uint64_t u1, std::uint64_t u0,
+                                    std::uint64_t &rem) {
+  constexpr LimbReciprocal Radix = limbReciprocal(DecimalLimbRadix);
+  static_assert(Radix.shift == 0);
+  return divModLimb(u1, u0, Radix, rem);
+}
+
+// A double-width partial below 10^38 as (carry, limb).
+constexpr std::uint64_t splitRadix(bits_t<128> p, std::uint64_t &limb) {
+  return divModRadix(std::uint64_t(p >> 64), std::uint64_t(p), limb);
+}
+
+// x / 10^r and x % 10^r for r in [1, 19]: the quotient estimate
+// floor(x · m / 2^(64+l)), m = floor(2^(64+l) / 10^r) with 2^l the
+// power of two at or below 10^r, is low by at most one.
+struct Pow10Reciprocal {
+  std::uint64_t m;
+  int l;
+};
+
+inline constexpr std::array<Pow10Reciprocal, 20> pow10Reciprocal = [] {
+  using Double = bits_t<128>;
+  std::array<Pow10Reciprocal, 20> t{};
+  for (int r = 1; r < 20; ++r) {
+    const int l = std::bit_width(pow10Limb[r]) - 1;
+    t[r] = {std::uint64_t((Double(1) << (64 + l)) / pow10Limb[r]), l};
+  }
+  return t;
+}();
+
+constexpr std::uint64_t divPow10(std::uint64_t x, int r, std::uint64_t &rem) {
+  using Double = bits_t<128>;
+  const Pow10Reciprocal c = pow10Reciprocal[r];
+  std::uint64_t q = std::uint64_t((Double(x) * c.m) >> 64) >> c.l;
+  std::uint64_t rm = x - q * pow10Limb[r];
+  if (rm >= pow10Limb[r]) {
+    ++q;
+    rm -= pow10Limb[r];
+  }
+  rem = rm;
+  return q;
+}
+
+// Decimal digits in a limb value (0 for zero).
+constexpr int limbDigitCount(std::uint64_t x) {
+  const int guess = (std::bit_width(x) * 1233) >> 12; // · log10(2)
+  return guess + (guess < 20 && x >= pow10Limb[guess] ? 1 : 0);
+}
+
+// -----------------------------------------------------------------
+// Construction / conversion
+// -----------------------------------------------------------------
+
+// An unsigned integer word (up to 128 bits) as decimal limbs, by
+// short division of its 64-bit halves by 10^19. Precondition: the
+// value fits Count limbs.
+template <int Count, typename Word>
+constexpr DecimalVector<Count> decimalFromWord(Word w) {
+  DecimalVector<Count> r{};
+  if constexpr (sizeof(Word) <= 8) {
+    const std::uint64_t x = std::uint64_t(w);
+    if constexpr (Count == 1) {
+      r.d[0] = x; // every caller's single-limb value is below 10^19
+    } else {
+      r.d[0] = x % DecimalLimbRadix;
+      r.d[1] = x / DecimalLimbRadix;
+    }
+  } else {
+    std::uint64_t hi = std::uint64_t(w >> 64), lo = std::uint64_t(w);
+    for (int i = 0; i < Count && (hi | lo) != 0; ++i) {
+      std::uint64_t top_rem = hi % DecimalLimbRadix;
+      const std::uint64_t top = hi / DecimalLimbRadix;
+      std::uint64_t limb = 0;
+      lo = divModRadix(top_rem, lo, limb);
+      hi = top;
+      r.d[i] = limb;
+    }
+  }
+  return r;
+}
+
+// The reverse: Horner over the limbs. Precondition: the value fits
+// Word.
+template <typename Word, int Count>
+constexpr Word wordFromDecimal(const DecimalVector<Count> &v) {
+  Word w = 0;
+  for (int i = Count - 1; i >= 0; --i)
+    w = Word(w * Word(DecimalLimbRadix) + Word(v.d[i]));
+  return w;
+}
+
+template <int Count>
+constexpr DecimalVector<Count> decimalFrom(std::uint64_t v) {
+  return decimalFromWord<Count>(v);
+}
+
+template <int NewCount, int Count>
+constexpr DecimalVector<NewCount> resizeDigits(const DecimalVector<Count> &v) {
+  DecimalVector<NewCount> r{};
+  constexpr int N = NewCount < Count ? NewCount : Count;
+  for (int i = 0; i < N; ++i)
+    r.d[i] = v.d[i];
+  return r;
+}
+
+// -----------------------------------------------------------------
+// Queries
+// -----------------------------------------------------------------
+
+template <int Count> constexpr bool isZero(const DecimalVector<Count> &v) {
+  for (int i = 0; i < Count; ++i)
+    if (v.d[i] != 0)
+      return false;
+  return true;
+}
+
+template <int Count>
+constexpr int compareDigits(const DecimalVector<Count> &a,
+                            const DecimalVector<Count> &b) {
+  for (int i = Count - 1; i >= 0; --i) {
+    if (a.d[i] != b.d[i])
+      return a.d[i] < b.d[i] ? -1 : 1;
+  }
+  return 0;
+}
+
+// Position of the most significant nonzero digit, or -1 if zero.
+template <int Count> constexpr int topDigitPos(const DecimalVector<Count> &v) {
+  for (int i = Count - 1; i >= 0; --i) {
+    if (v.d[i] != 0)
+      return i * DecimalLimbDigits + limbDigitCount(v.d[i]) - 1;
+  }
+  return -1;
+}
+
+template <int Count>
+constexpr int digitAt(const DecimalVector<Count> &v, int pos) {
+  if (pos < 0 || pos >= DecimalVector<Count>::digit_count)
+    return 0;
+  const int r = pos % DecimalLimbDigits;
+  std::uint64_t x = v.d[pos / DecimalLimbDigits], rem = 0;
+  if (r != 0)
+    x = divPow10(x, r, rem);
+  return int(x % 10);
+}
+
+// Any nonzero digit strictly below position pos — the sticky test.
+template <int Count>
+constexpr bool anyDigitsBelow(const DecimalVector<Count> &v, int pos) {
+  if (pos <= 0)
+    return false;
+  if (pos >= DecimalVector<Count>::digit_count)
+    return !isZero(v);
+  const int full = pos / DecimalLimbDigits;
+  for (int i = 0; i < full; ++i)
+    if (v.d[i] != 0)
+      return true;
+  std::uint64_t rem = 0;
+  if (const int r = pos % DecimalLimbDigits; r != 0)
+    divPow10(v.d[full], r, rem);
+  return rem != 0;
+}
+
+// Trailing zero digits of a nonzero value.
+template <int Count>
+constexpr int trailingZeroDigits(const DecimalVector<Count> &v) {
+  int i = 0;
+  while (v.d[i] == 0)
+    ++i;
+  int n = i * DecimalLimbDigits;
+  std::uint64_t x = v.d[i], rem = 0;
+  for (int step : {16, 8, 4, 2, 1}) {
+    const std::uint64_t q = divPow10(x, step, rem);
+    if (rem == 0) {
+      x = q;
+      n += step;
+    }
+  }
+  return n;
+}
+
+// -----------------------------------------------------------------
+// Addition / subtraction (mod 10^(19·Count))
+// -----------------------------------------------------------------
+
+template <int Count>
+constexpr DecimalVector<Count> addDigits(const DecimalVector<Count> &a,
+                                        const DecimalVector<Count> &b) {
+  DecimalVector<Count> r{};
+  std::uint64_t carry = 0;
+  for (int i = 0; i < Count; ++i) {
+    // a + b can reach 2 · 10^19 − 1 > 2^64: compare against the
+    // room left below the radix instead of forming the sum.
+    const std::uint64_t t = a.d[i] + carry; // <= 10^19
+    carry = b.d[i] >= DecimalLimbRadix - t;
+    r.d[i] = carry ? b.d[i] - (DecimalLimbRadix - t) : t + b.d[i];
+  }
+  return r;
+}
+
+template <int Count>
+constexpr DecimalVector<Count> subDigits(const DecimalVector<Count> &a,
+                                        const DecimalVector<Count> &b) {
+  DecimalVector<Count> r{};
+  std::uint64_t borrow = 0;
+  for (int i = 0; i < Count; ++i) {
+    const std::uint64_t sub = b.d[i] + borrow;
+    borrow = a.d[i] < sub;
+    r.d[i] = borrow ? a.d[i] + (DecimalLimbRadix - sub) : a.d[i] - sub;
+  }
+  return r;
+}
+
+template <int Count>
+constexpr DecimalVector<Count> addSmallDigits(DecimalVector<Count> v,
+                                             std::uint64_t a) {
+  for (int i = 0; i < Count && a != 0; ++i) {
+    const std::uint64_t s = v.d[i] + a;
+    a = s >= DecimalLimbRadix;
+    v.d[i] = a ? s - DecimalLimbRadix : s;
+  }
+  return v;
+}
+
+// -----------------------------------------------------------------
+// Shifts by decimal digits
+// -----------------------------------------------------------------
+
+// v · 10^k, modulo the vector.
+template <int Count>
+constexpr DecimalVector<Count> shiftLeftDigits(const DecimalVector<Count> &v,
+                                              int k) {
+  if (k <= 0)
+    return v;
+  DecimalVector<Count> r{};
+  if (k >= DecimalVector<Count>::digit_count)
+    return r;
+  const int limbs = k / DecimalLimbDigits, s = k % DecimalLimbDigits;
+  if (s == 0) {
+    for (int i = Count - 1; i >= limbs; --i)
+      r.d[i] = v.d[i - limbs];
+    return r;
+  }
+  // Each limb splits at 10^(19−s): its low part moves up s digits
+  // in place, its high part carries into the next limb.
+  std::uint64_t carry = 0;
+  for (int i = 0; i + limbs < Count; ++i) {
+    std::uint64_t lo = 0;
+    const std::uint64_t hi = divPow10(v.d[i], DecimalLimbDigits - s, lo);
+    r.d[i + limbs] = lo * pow10Limb[s] + carry;
+    carry = hi;
+  }
+  return r;
+}
+
+// floor(v / 10^k).
+template <int Count>
+constexpr DecimalVector<Count> shiftRightDigits(const DecimalVector<Count> &v,
+                                               int k) {
+  if (k <= 0)
+    return v;
+  DecimalVector<Count> r{};
+  if (k >= DecimalVector<Count>::digit_count)
+    return r;
+  const int limbs = k / DecimalLimbDigits, s = k % DecimalLimbDigits;
+  if (s == 0) {
+    for (int i = 0; i + limbs < Count; ++i)
+      r.d[i] = v.d[i + limbs];
+    return r;
+  }
+  // Each limb splits at 10^s: its high part moves down s digits,
+  // its low part becomes the top of the limb below.
+  std::uint64_t carry = 0;
+  for (int i = Count - 1; i >= limbs; --i) {
+    std::uint64_t lo = 0;
+    const std::uint64_t hi = divPow10(v.d[i], s, lo);
+    r.d[i - limbs] = hi + carry;
+    carry = lo * pow10Limb[DecimalLimbDigits - s];
+  }
+  return r;
+}
+
+// -----------------------------------------------------------------
+// Multiplication
+// -----------------------------------------------------------------
+
+// v · m + a for a one-limb m, a < 10^19; returns the limb carried
+// out of the top.
+template <int Count>
+constexpr std::uint64_t mulAddSmallDigitsInPlace(DecimalVector<Count> &v,
+                                                 std::uint64_t m,
+                                                 std::uint64_t a) {
+  using Double = bits_t<128>;
+  std::uint64_t carry = a;
+  for (int i = 0; i < Count; ++i)
+    carry = splitRadix(Double(v.d[i]) * m + carry, v.d[i]);
+  return carry;
+}
+
+// The exact (CountA + CountB)-limb product, schoolbook; each partial
+// (< 10^38) splits at 10^19 by reciprocal.
+template <int CountA, int CountB>
+constexpr DecimalVector<CountA + CountB>
+mulDigits(const DecimalVector<CountA> &a, const DecimalVector<CountB> &b) {
+  using Double = bits_t<128>;
+  DecimalVector<CountA + CountB> r{};
+  int na = CountA, nb = CountB;
+  while (na > 0 && a.d[na - 1] == 0)
+    --na;
+  while (nb > 0 && b.d[nb - 1] == 0)
+    --nb;
+  for (int i = 0; i < na; ++i) {
+    std::uint64_t carry = 0;
+    for (int j = 0; j < nb; ++j)
+      carry = splitRadix(Double(a.d[i]) * b.d[j] + r.d[i + j] + carry,
+                         r.d[i + j]);
+    r.d[i + nb] = carry;
+  }
+  return r;
+}
+
+// -----------------------------------------------------------------
+// Division with remainder
+// -----------------------------------------------------------------
+
+// v = v / den in place; returns the remainder. Precondition:
+// 0 < den < 10^19. Each step divides rem·10^19 + v.d[i], which is
+// below den·2^64, through den's reciprocal.
+template <int Count>
+constexpr std::uint64_t divModSmallDigitsInPlace(DecimalVector<Count> &v,
+                                                 std::uint64_t den) {
+  using Double = bits_t<128>;
+  const LimbReciprocal c = limbReciprocal(den);
+  std::uint64_t rem = 0;
+  for (int i = Count - 1; i >= 0; --i) {
+    const Double cur = Double(rem) * DecimalLimbRadix + v.d[i];
+    v.d[i] = divModLimb(std::uint64_t(cur >> 64), std::uint64_t(cur), c, rem);
+  }
+  return rem;
+}
+
+// Schoolbook long division in radix 10^19 (TAOCP vol. 2, §4.3.1,
+// Algorithm D), the decimal twin of digits.hpp's: num becomes the
+// remainder and quot the quotient; den is normalized in place and
+// restored. Normalization multiplies both by f = 10^19 / (top + 1),
+// which puts the divisor's top limb at or above 10^19 / 2 without
+// changing the quotient. Precondition: den != 0.
+template <int Count>
+constexpr void divModLongDigitsInPlace(DecimalVector<Count> &num,
+                                       DecimalVector<Count> &den,
+                                       DecimalVector<Count> &quot) {
+  using Double = bits_t<128>;
+  constexpr std::uint64_t B = DecimalLimbRadix;
+  for (int i = 0; i < Count; ++i)
+    quot.d[i] = 0;
+  int n = Count;
+  while (den.d[n - 1] == 0)
+    --n;
+  int m = Count;
+  while (m > 0 && num.d[m - 1] == 0)
+    --m;
+  if (m < n)
+    return;
+  if (n == 1) {
+    quot = num;
+    const std::uint64_t rem = divModSmallDigitsInPlace(quot, den.d[0]);
+    num = DecimalVector<Count>{};
+    num.d[0] = rem;
+    return;
+  }
+
+  // Count == 1 always takes the short division above; the normalized
+  // long division reads den.d[n - 2].
+  if constexpr (Count > 1) {
+    const std::uint64_t f = B / (den.d[n - 1] + 1);
+    std::uint64_t ext = 0; // the dividend's extra top limb
+    if (f > 1) {
+      ext = mulAddSmallDigitsInPlace(num, f, 0);
+      mulAddSmallDigitsInPlace(den, f, 0);
+    }
+    auto u = [&](int i) -> std::uint64_t & {
+      return i == Count ? ext : num.d[i];
+    };
+    const std::uint64_t v1 = den.d[n - 1], v2 = den.d[n - 2];
+
+    for (int j = m - n; j >= 0; --j) {
+      const Double top2 = Double(u(j + n)) * B + u(j + n - 1);
+      Double qhat = top2 / v1;
+      Double rhat = top2 % v1;
+      while (qhat >= B || qhat * v2 > rhat * B + u(j + n - 2)) {
+        --qhat;
+        rhat += v1;
+        if (rhat >= B)
+          break;
+      }
+
+      // u[j .. j+n] -= qhat · v
+      std::uint64_t mul_carry = 0, borrow = 0;
+      for (int i = 0; i <= n; ++i) {
+        std::uint64_t lo = mul_carry;
+        if (i < n)
+          mul_carry = splitRadix(qhat * den.d[i] + mul_carry, lo);
+        const std::uint64_t sub = lo + borrow;
+        std::uint64_t &ui = u(i + j);
+        borrow = ui < sub;
+        ui = borrow ? ui + (B - sub) : ui - sub;
+      }
+      if (borrow) { // qhat was one too large: add v back
+        --qhat;
+        std::uint64_t carry = 0;
+        for (int i = 0; i < n; ++i) {
+          const std::uint64_t t = u(i + j) + carry;
+          carry = den.d[i] >= B - t;
+          u(i + j) = carry ? den.d[i] - (B - t) : t + den.d[i];
+        }
+        u(j + n) = u(j + n) + carry - B; // the borrow out cancels
+      }
+      quot.d[j] = std::uint64_t(qhat);
+    }
+    if (f > 1) {
+      divModSmallDigitsInPlace(num, f);
+      divModSmallDigitsInPlace(den, f);
+    }
+  }
+}
+
+} // namespace detail
+} // namespace opine
+
+#endif // OPINE_CORE_DECIMAL_DIGITS_HPP
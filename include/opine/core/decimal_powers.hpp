@@ -0,0 +1,194 @@
+#ifndef OPINE_CORE_DECIMAL_POWERS_HPP
+#define OPINE_CORE_DECIMAL_POWERS_HPP
+
+// Compile-time powers of five for decimal conversion.
+//
+// Two families. pow5Table (below) serves the fast paths with rounded
+// 128-bit significands; the exact tables at the end serve the
+// big-integer path, which needs 5^n itself. (Powers of ten are these
+// shifted: 10^n = 5^n · 2^n.)
+//
+// pow5Table holds, for every j in [Pow5TableMin, Pow5TableMax], a
+// 128-bit normalized approximation of 5^j:
+//
+//   5^j ≈ sig · 2^exp2,   2^127 ≤ sig < 2^128,   sig = floor(5^j · 2^-exp2)
+//
+// so the error is below one unit of sig's last place (relative
+// error < 2^-127) in every entry, and zero for 0 ≤ j ≤ 55, where
+// 5^j itself fits 128 bits. That one-sided, bounded error is all
+// the fast paths rely on: each decision they take from a table
+// product carries an explicit uncertainty band, and any decision
+// that lands inside its band falls back to the exact big-integer
+// path (string.hpp). No correctness-by-benchmark — a wrong table
+// could only make the fast path give up, never give a wrong digit,
+// and the table is itself generated by exact DigitVector
+// arithmetic in the compiler, not pasted in.
+//
+// Generation: non-negative j by repeated exact ×5; negative j as
+// floor(2^B / 5^|j|) by repeated short division, which is exact
+// because floor(floor(x / a) / b) == floor(x / (a·b)). Both walks
+// run in a fixed DigitVector wide enough for the largest entry.
+//
+// The range covers every decimal exponent binary64 (and anything
+// narrower) can reach in either direction, with slack: the fast
+// paths test a Type's own exponent range against it at compile
+// time, and wider formats simply never take them.
+
+#include <array>
+#include <cstdint>
+
+#include "opine/core/digits.hpp"
+
+namespace opine {
+namespace detail {
+
+inline constexpr int Pow5TableMin = -350;
+inline constexpr int Pow5TableMax = 350;
+
+struct Pow5Entry {
+  DigitVector<std::uint64_t, 2> sig; // in [2^127, 2^128)
+  int exp2;                          // 5^j ≈ sig · 2^exp2
+};
+
+namespace pow5_gen {
+
+// Wide enough for 5^350 itself (813 bits), with B chosen so that
+// floor(2^B / 5^350) still carries well over 128 significant bits.
+inline constexpr int GenLimbs = 17;
+using GenDV = DigitVector<std::uint64_t, GenLimbs>;
+inline constexpr int GenB = GenLimbs * 64 - 2;
+
+// The top 128 bits of a nonzero v, and the weight of their LSB.
+constexpr Pow5Entry top128(const GenDV &v, int weight_offset) {
+  const int top = topBitPos(v);
+  const int sh = top - 127;
+  const GenDV t = sh >= 0 ? shiftRightDigits(v, sh) : shiftLeftDigits(v, -sh);
+  Pow5Entry e{};
+  e.sig.d[0] = t.d[0];
+  e.sig.d[1] = t.d[1];
+  e.exp2 = sh + weight_offset;
+  return e;
+}
+
+constexpr std::array<Pow5Entry, Pow5TableMax - Pow5TableMin + 1> make() {
+  std::array<Pow5Entry, Pow5TableMax - Pow5TableMin + 1> t{};
+  GenDV p = digitsFrom<std::uint64_t, GenLimbs>(1);
+  for (int j = 0; j <= Pow5TableMax; ++j) {
+    t[j - Pow5TableMin] = top128(p, 0);
+    p = mulSmallDigits(p, std::uint64_t{5});
+  }
+  GenDV r = withBit(GenDV{}, GenB); // floor(2^B / 5^|j|), walked down
+  for (int j = 1; j <= -Pow5TableMin; ++j) {
+    r = divModSmallDigits(r, std::uint64_t{5}).quot;
+    t[-j - Pow5TableMin] = top128(r, -GenB);
+  }
+  return t;
+}
+
+} // namespace pow5_gen
+
+inline constexpr std::array<Pow5Entry, Pow5TableMax - Pow5TableMin + 1>
+    pow5Table = pow5_gen::make();
+
+constexpr const Pow5Entry &pow5Entry(int j) {
+  return pow5Table[std::size_t(j - Pow5TableMin)];
+}
+
+// Exact entries: 5^j fits the 128-bit significand unrounded.
+constexpr bool pow5EntryExact(int j) { return j >= 0 && j <= 55; }
+
+// floor(log10(2^q)) and floor(log10(3/4 · 2^q)), exact for
+// |q| ≤ 17000 (verified against exact integer comparisons; the
+// constants are Giulietti's, from the Schubfach paper).
+constexpr int floorLog10Pow2Exact(int q) {
+  return int((std::int64_t(q) * 661971961083LL) >> 41);
+}
+constexpr int floorLog10ThreeQuartersPow2(int q) {
+  return int((std::int64_t(q) * 661971961083LL - 274743187321LL) >> 41);
+}
+
+// -----------------------------------------------------------------
+// Exact powers, three granularities
+// -----------------------------------------------------------------
+// Any 0 ≤ n < Pow5ExactTableLimit splits as
+//
+//   n = Pow5BigStep·a + Pow5MidStep·b + c
+//
+// and 5^n = pow5Big(a) · pow5Mid(b) · pow5Small(c): one short
+// multiply and at most one 49×17-limb product, instead of the
+// repeated squaring at the working width that the exact path used to
+// do per call. The limit clears every power a 32-limb (2048-bit)
+// working integer can hold, so through binary64 a conversion never
+// leaves the tables; wider working integers combine the top entry
+// (string.hpp). Entries are built by exact ×5 in the compiler.
+inline constexpr int Pow5SmallMax = 27; // 5^27 < 2^64
+inline constexpr int Pow5MidStep = Pow5SmallMax + 1;
+inline constexpr int Pow5MidCount = 16;
+inline constexpr int Pow5BigStep = Pow5MidStep * Pow5MidCount; // 448
+inline constexpr int Pow5BigCount = 4;
+inline constexpr long Pow5ExactTableLimit = long(Pow5BigStep) * Pow5BigCount;
+
+// Widths: 5^447 (a Mid entry times a Small one) is 1038 bits; 5^1344
+// is 3121.
+inline constexpr int Pow5MidLimbs = 17;
+inline constexpr int Pow5BigLimbs = 49;
+using Pow5Mid = DigitVector<std::uint64_t, Pow5MidLimbs>;
+using Pow5Big = DigitVector<std::uint64_t, Pow5BigLimbs>;
+
+namespace pow5_gen {
+
+constexpr std::array<std::uint64_t, Pow5SmallMax + 1> makeSmall() {
+  std::array<std::uint64_t, Pow5SmallMax + 1> t{};
+  std::uint64_t p = 1;
+  for (int j = 0; j <= Pow5SmallMax; ++j, p *= 5)
+    t[j] = p;
+  return t;
+}
+
+// 5^(step·j) for j < N, in Limbs limbs.
+template <int Limbs, int N>
+constexpr std::array<DigitVector<std::uint64_t, Limbs>, N> makeSteps(int step) {
+  std::array<DigitVector<std::uint64_t, Limbs>, N> t{};
+  DigitVector<std::uint64_t, Limbs> p = digitsFrom<std::uint64_t, Limbs>(1);
+  for (int j = 0; j < N; ++j) {
+    t[j] = p;
+    if (j + 1 < N)
+      for (int k = 0; k < step; ++k)
+        p = mulSmallDigits(p, std::uint64_t{5});
+  }
+  return t;
+}
+
+} // namespace pow5_gen
+
+inline constexpr std::array<std::uint64_t, Pow5SmallMax + 1> pow5SmallTable =
+    pow5_gen::makeSmall();
+inline constexpr std::array<Pow5Mid, Pow5MidCount> pow5MidTable =
+    pow5_gen::makeSteps<Pow5MidLimbs, Pow5MidCount>(Pow5MidStep);
+inline constexpr std::array<Pow5Big, Pow5BigCount> pow5BigTable =
+    pow5_gen::makeSteps<Pow5BigLimbs, Pow5BigCount>(Pow5BigStep);
+
+constexpr std::uint64_t pow5Small(int c) { return pow5SmallTable[c]; }
+constexpr const Pow5Mid &pow5Mid(int b) { return pow5MidTable[b]; }
+constexpr const Pow5Big &pow5Big(int a) { return pow5BigTable[a]; }
+
+// 5^n for 0 ≤ n < Pow5BigStep, exact.
+constexpr Pow5Mid pow5BelowBigStep(int n) {
+  return mulSmallDigits(pow5Mid(n / Pow5MidStep),
+                        pow5Small(n % Pow5MidStep));
+}
+
+static_assert(pow5Small(Pow5SmallMax) == 7450580596923828125ULL);
+static_assert(topBitPos(pow5BelowBigStep(Pow5BigStep - 1)) ==
+              1037); // 5^447: 1038 bits, fits 17 limbs
+static_assert(topBitPos(pow5Big(Pow5BigCount - 1)) == 3120);
+
+static_assert(pow5Entry(0).exp2 == -127 && pow5Entry(0).sig.d[1] ==
+                                               (std::uint64_t{1} << 63));
+static_assert(pow5Entry(1).exp2 == -125); // 5 = 0b101 · 2^0
+static_assert(pow5Entry(-1).exp2 == -130); // 1/5 = 0.0011…
+
+} // namespace detail
+} // namespace opine
+
+#endif // OPINE_CORE_DECIMAL_POWERS_HPP
@@ -15,11 +15,12 @@
 // DigitVector is deliberately NOT an integer type. There are no
 // operator overloads; each primitive is a named digit-sequence
 // algorithm (TAOCP vol. 2, §4.3, stated there for arbitrary radix).
-// The names describe algorithmic roles so that a future non-binary
-// instantiation (e.g. radix-10^19 decimal limbs) swaps the
-// per-digit carry/estimation arithmetic without changing the
-// algorithm shapes — the seam a pretend-integer type would weld
-// shut. This slice implements the full-width binary instantiation:
+// The names describe algorithmic roles so that a non-binary
+// instantiation swaps the per-digit carry/estimation arithmetic
+// without changing the algorithm shapes — the seam a
+// pretend-integer type would weld shut. decimal_digits.hpp is that
+// instantiation for radix-10^19 decimal limbs. This header
+// implements the full-width binary one:
 // limbs are standard unsigned integers, the limb radix is
 // 2^limb_bits, and value semantics are mod 2^total_bits (identical
 // to unsigned _BitInt of the same width, which is what the
@@ -423,6 +424,118 @@ shiftRightStickyDigits(const DigitVector<Limb, Count> &v, int shift) {
   return r;
 }
 
+// -----------------------------------------------------------------
+// In-place forms
+// -----------------------------------------------------------------
+// The same algorithms updating a vector where it lies instead of
+// returning a new one. A wide working integer (the decimal
+// conversions' 1024-limb tier is 8 KiB) then costs no temporary and
+// no copy per step: the caller keeps a fixed set of vectors — in a
+// ScratchArena, say (scratch.hpp) — and every step runs inside them.
+// Same digits as the value forms.
+
+// Left shift in place: limbs move up, so walk down.
+template <typename Limb, int Count>
+constexpr void shiftLeftDigitsInPlace(DigitVector<Limb, Count> &v, int shift) {
+  constexpr int LB = DigitVector<Limb, Count>::limb_bits;
+  if (shift <= 0)
+    return;
+  const int off = shift >= Count * LB ? Count : shift / LB;
+  const int sh = shift % LB;
+  for (int i = Count - 1; i >= off; --i) {
+    Limb hi = Limb(sh == 0 ? v.d[i - off] : Limb(v.d[i - off] << sh));
+    Limb lo = Limb((sh != 0 && i - off - 1 >= 0)
+                       ? Limb(v.d[i - off - 1] >> (LB - sh))
+                       : Limb{0});
+    v.d[i] = Limb(hi | lo);
+  }
+  for (int i = 0; i < off; ++i)
+    v.d[i] = 0;
+}
+
+// Right shift in place: limbs move down, so walk up.
+template <typename Limb, int Count>
+constexpr void shiftRightDigitsInPlace(DigitVector<Limb, Count> &v, int shift) {
+  constexpr int LB = DigitVector<Limb, Count>::limb_bits;
+  if (shift <= 0)
+    return;
+  const int off = shift >= Count * LB ? Count : shift / LB;
+  const int sh = shift % LB;
+  for (int i = 0; i + off < Count; ++i) {
+    Limb lo = Limb(sh == 0 ? v.d[i + off] : Limb(v.d[i + off] >> sh));
+    Limb hi = Limb((sh != 0 && i + off + 1 < Count)
+                       ? Limb(v.d[i + off + 1] << (LB - sh))
+                       : Limb{0});
+    v.d[i] = Limb(hi | lo);
+  }
+  for (int i = Count - off; i < Count; ++i)
+    v.d[i] = 0;
+}
+
+// Right shift in place with lost bits OR'd into bit 0, as
+// shiftRightStickyDigits.
+template <typename Limb, int Count>
+constexpr void shiftRightStickyDigitsInPlace(DigitVector<Limb, Count> &v,
+                                             int shift) {
+  if (shift <= 0)
+    return;
+  const bool lost = anyBitsBelow(v, shift);
+  shiftRightDigitsInPlace(v, shift);
+  if (lost)
+    v.d[0] = Limb(v.d[0] | Limb{1});
+}
+
+// dst = src, zero-extended or truncated to dst's width.
+template <typename Limb, int Count, int SCount>
+constexpr void resizeDigitsInto(DigitVector<Limb, Count> &dst,
+                                const DigitVector<Limb, SCount> &src) {
+  for (int i = 0; i < Count; ++i)
+    dst.d[i] = i < SCount ? src.d[i] : Limb{0};
+}
+
+// a += b, mod 2^total_bits; returns the carry out.
+template <typename Limb, int Count>
+constexpr bool addDigitsInPlace(DigitVector<Limb, Count> &a,
+                                const DigitVector<Limb, Count> &b) {
+  Limb carry = 0;
+  for (int i = 0; i < Count; ++i) {
+    Limb s = Limb(a.d[i] + b.d[i]);
+    bool c1 = s < a.d[i];
+    Limb s2 = Limb(s + carry);
+    bool c2 = s2 < s;
+    a.d[i] = s2;
+    carry = Limb(c1 || c2);
+  }
+  return carry != 0;
+}
+
+// a -= b, wrapping like subDigits; returns the borrow out.
+template <typename Limb, int Count>
+constexpr bool subDigitsInPlace(DigitVector<Limb, Count> &a,
+                                const DigitVector<Limb, Count> &b) {
+  Limb borrow = 0;
+  for (int i = 0; i < Count; ++i) {
+    Limb t = Limb(a.d[i] - b.d[i]);
+    bool b1 = a.d[i] < b.d[i];
+    Limb t2 = Limb(t - borrow);
+    bool b2 = t < borrow;
+    a.d[i] = t2;
+    borrow = Limb(b1 || b2);
+  }
+  return borrow != 0;
+}
+
+// a += v for a single limb v, stopping where the carry does;
+// returns the carry out.
+template <typename Limb, int Count>
+constexpr bool addSmallDigitsInPlace(DigitVector<Limb, Count> &a, Limb v) {
+  for (int i = 0; i < Count && v != 0; ++i) {
+    a.d[i] = Limb(a.d[i] + v);
+    v = Limb(a.d[i] < v);
+  }
+  return v != 0;
+}
+
 // -----------------------------------------------------------------
 // Storage-word operations
 // -----------------------------------------------------------------
@@ -505,6 +618,12 @@ template <typename S> constexpr bool wordLess(const S &a, const S &b) {
 template <typename S> constexpr int wordTopBit(const S &s) {
   if constexpr (is_digit_vector<S>) {
     return topBitPos(s);
+  } else if constexpr (sizeof(S) <= 8) {
+    return int(std::bit_width(std::uint64_t(s))) - 1;
+  } else if constexpr (sizeof(S) <= 16) {
+    const std::uint64_t hi = std::uint64_t(s >> 64);
+    return hi != 0 ? 64 + int(std::bit_width(hi)) - 1
+                   : int(std::bit_width(std::uint64_t(s))) - 1;
   } else {
     int pos = -1;
     S v = s;
@@ -613,34 +732,140 @@ constexpr std::uint64_t extractIntField(const S &s, int offset, int width) {
 // Multiplication
 // -----------------------------------------------------------------
 
-// Schoolbook over limbs: the exact (CountA + CountB)-limb product,
-// no information lost. The row accumulation cannot overflow the
-// double-width partial: (R-1)^2 + (R-1) + (R-1) == R^2 - 1. This is
-// the generic tier; Karatsuba or hardware wide-multiply chains are
-// Platform specializations that must produce identical digits.
-template <typename Limb, int CountA, int CountB>
-constexpr DigitVector<Limb, CountA + CountB>
-mulDigits(const DigitVector<Limb, CountA> &a,
-          const DigitVector<Limb, CountB> &b) {
+// Schoolbook over limbs into r: the low Count limbs of a · b — all
+// of it, no information lost, when Count ≥ CountA + CountB. The row
+// accumulation cannot overflow the double-width partial: (R-1)^2 +
+// (R-1) + (R-1) == R^2 - 1. This is the generic tier; Karatsuba or
+// hardware wide-multiply chains are Platform specializations that
+// must produce identical digits. Rows and columns stop at each
+// operand's top nonzero limb (and at r's top), so a wide vector
+// holding a narrow value (the decimal conversions' usual case)
+// costs what its value's width does. r must not alias a or b.
+template <typename Limb, int Count, int CountA, int CountB>
+constexpr void mulDigitsInto(DigitVector<Limb, Count> &r,
+                             const DigitVector<Limb, CountA> &a,
+                             const DigitVector<Limb, CountB> &b) {
   constexpr int LB = int(sizeof(Limb)) * 8;
   using Double = bits_t<2 * LB>;
-  DigitVector<Limb, CountA + CountB> r{};
-  for (int i = 0; i < CountA; ++i) {
+  for (int i = 0; i < Count; ++i)
+    r.d[i] = 0;
+  int na = CountA, nb = CountB;
+  while (na > 0 && a.d[na - 1] == 0)
+    --na;
+  while (nb > 0 && b.d[nb - 1] == 0)
+    --nb;
+  for (int i = 0; i < na && i < Count; ++i) {
     Limb carry = 0;
-    for (int j = 0; j < CountB; ++j) {
+    for (int j = 0; j < nb && i + j < Count; ++j) {
       Double t = Double(a.d[i]) * Double(b.d[j]) + Double(r.d[i + j]) +
                  Double(carry);
       r.d[i + j] = Limb(t);
       carry = Limb(t >> LB);
     }
-    // Position i + CountB is untouched before row i finishes (rows
-    // i' < i reach at most i' + CountB - 1... + 1 = i + CountB - 1),
-    // so a plain store is correct.
-    r.d[i + CountB] = carry;
+    // Position i + nb is untouched before row i finishes (rows
+    // i' < i reach at most i' + nb - 1... + 1 = i + nb - 1), so a
+    // plain store is correct.
+    if (i + nb < Count)
+      r.d[i + nb] = carry;
   }
+}
+
+// The exact (CountA + CountB)-limb product.
+template <typename Limb, int CountA, int CountB>
+constexpr DigitVector<Limb, CountA + CountB>
+mulDigits(const DigitVector<Limb, CountA> &a,
+          const DigitVector<Limb, CountB> &b) {
+  DigitVector<Limb, CountA + CountB> r{};
+  mulDigitsInto(r, a, b);
+  return r;
+}
+
+// -----------------------------------------------------------------
+// Short multiplication / division (one-limb operand)
+// -----------------------------------------------------------------
+// The single-digit forms of the schoolbook algorithms (TAOCP vol. 2,
+// §4.3.1, exercise 16): one pass over the limbs, one double-width
+// partial per limb. They are what decimal conversion runs on — ×10
+// per digit, ÷5 per table step — where a full mulDigits or the
+// bit-serial divModDigits would do Count (or total_bits) times the
+// work for the same digits.
+
+// v · m + a, mod 2^total_bits.
+template <typename Limb, int Count>
+constexpr DigitVector<Limb, Count>
+mulAddSmallDigits(const DigitVector<Limb, Count> &v, Limb m, Limb a) {
+  constexpr int LB = int(sizeof(Limb)) * 8;
+  using Double = bits_t<2 * LB>;
+  DigitVector<Limb, Count> r{};
+  Limb carry = a;
+  for (int i = 0; i < Count; ++i) {
+    Double t = Double(v.d[i]) * Double(m) + Double(carry);
+    r.d[i] = Limb(t);
+    carry = Limb(t >> LB);
+  }
+  return r;
+}
+
+template <typename Limb, int Count>
+constexpr DigitVector<Limb, Count>
+mulSmallDigits(const DigitVector<Limb, Count> &v, Limb m) {
+  return mulAddSmallDigits(v, m, Limb{0});
+}
+
+// v = v · m + a in place; returns the limb carried out of the top.
+template <typename Limb, int Count>
+constexpr Limb mulAddSmallDigitsInPlace(DigitVector<Limb, Count> &v, Limb m,
+                                        Limb a) {
+  constexpr int LB = int(sizeof(Limb)) * 8;
+  using Double = bits_t<2 * LB>;
+  Limb carry = a;
+  for (int i = 0; i < Count; ++i) {
+    Double t = Double(v.d[i]) * Double(m) + Double(carry);
+    v.d[i] = Limb(t);
+    carry = Limb(t >> LB);
+  }
+  return carry;
+}
+
+template <typename Limb, int Count> struct DivModSmallResult {
+  DigitVector<Limb, Count> quot;
+  Limb rem;
+};
+
+// Top-down short division. Precondition: den != 0. Each partial
+// remainder is below den, so (rem · R + limb) / den fits one limb.
+template <typename Limb, int Count>
+constexpr DivModSmallResult<Limb, Count>
+divModSmallDigits(const DigitVector<Limb, Count> &num, Limb den) {
+  constexpr int LB = int(sizeof(Limb)) * 8;
+  using Double = bits_t<2 * LB>;
+  DivModSmallResult<Limb, Count> r{};
+  Double rem = 0;
+  for (int i = Count - 1; i >= 0; --i) {
+    const Double cur = (rem << LB) | Double(num.d[i]);
+    r.quot.d[i] = Limb(cur / den);
+    rem = cur % den;
+  }
+  r.rem = Limb(rem);
   return r;
 }
 
+// v = v / den in place; returns the remainder. Precondition:
+// den != 0.
+template <typename Limb, int Count>
+constexpr Limb divModSmallDigitsInPlace(DigitVector<Limb, Count> &v,
+                                        Limb den) {
+  constexpr int LB = int(sizeof(Limb)) * 8;
+  using Double = bits_t<2 * LB>;
+  Double rem = 0;
+  for (int i = Count - 1; i >= 0; --i) {
+    const Double cur = (rem << LB) | Double(v.d[i]);
+    v.d[i] = Limb(cur / den);
+    rem = cur % den;
+  }
+  return Limb(rem);
+}
+
 // -----------------------------------------------------------------
 // Division with remainder
 // -----------------------------------------------------------------
@@ -676,6 +901,111 @@ divModDigits(const DigitVector<Limb, Count> &num,
   return r;
 }
 
+// Schoolbook long division over limbs (TAOCP vol. 2, §4.3.1,
+// Algorithm D): one quotient limb per step, estimated from the top
+// two remainder limbs against a normalized divisor and corrected at
+// most twice, then once more by add-back in the rare case the
+// estimate still overshoots. Identical quotient and remainder to
+// divModDigits at roughly limb_bits times fewer passes, and each pass
+// runs over the divisor's significant limbs only — this is the tier
+// the wide decimal conversions divide on. Precondition: den != 0.
+//
+// In place: num becomes the remainder and quot the quotient; den is
+// normalized where it lies and shifted back before returning, so
+// the only storage is the caller's three vectors (the dividend's
+// extra normalization limb is a local). quot must not alias either.
+template <typename Limb, int Count>
+constexpr void divModLongDigitsInPlace(DigitVector<Limb, Count> &num,
+                                       DigitVector<Limb, Count> &den,
+                                       DigitVector<Limb, Count> &quot) {
+  constexpr int LB = DigitVector<Limb, Count>::limb_bits;
+  using Double = bits_t<2 * LB>;
+  for (int i = 0; i < Count; ++i)
+    quot.d[i] = 0;
+  const int n = topBitPos(den) / LB + 1; // significant divisor limbs
+  const int top = topBitPos(num);
+  const int m = top < 0 ? 0 : top / LB + 1;
+  if (m < n)
+    return; // num is already the remainder
+  if (n == 1) {
+    const Double d = den.d[0];
+    Double rem = 0;
+    for (int i = m - 1; i >= 0; --i) {
+      const Double cur = (rem << LB) | Double(num.d[i]);
+      quot.d[i] = Limb(cur / d);
+      rem = cur % d;
+      num.d[i] = 0;
+    }
+    num.d[0] = Limb(rem);
+    return;
+  }
+
+  // Normalize so the divisor's top limb has its high bit set; the
+  // dividend gets one extra limb, ext, for the bits shifted up.
+  const int sh = LB - 1 - topBitPos(den) % LB;
+  Limb ext = sh == 0 ? Limb{0} : Limb(num.d[Count - 1] >> (LB - sh));
+  shiftLeftDigitsInPlace(den, sh);
+  shiftLeftDigitsInPlace(num, sh);
+  auto u = [&](int i) -> Limb & { return i == Count ? ext : num.d[i]; };
+  const Double B = Double(1) << LB;
+  const Double v1 = den.d[n - 1], v2 = den.d[n - 2];
+
+  for (int j = m - n; j >= 0; --j) {
+    const Double top2 = (Double(u(j + n)) << LB) | Double(u(j + n - 1));
+    Double qhat = top2 / v1;
+    Double rhat = top2 % v1;
+    while (qhat >= B ||
+           qhat * v2 > ((rhat << LB) | Double(u(j + n - 2)))) {
+      --qhat;
+      rhat += v1;
+      if (rhat >= B)
+        break;
+    }
+
+    // u[j .. j+n] -= qhat · v
+    Limb mul_carry = 0;
+    Limb borrow = 0;
+    for (int i = 0; i <= n; ++i) {
+      Limb lo = mul_carry;
+      if (i < n) {
+        const Double p = qhat * Double(den.d[i]) + Double(mul_carry);
+        lo = Limb(p);
+        mul_carry = Limb(p >> LB);
+      }
+      const Limb ui = u(i + j);
+      const Limb d1 = Limb(ui - lo);
+      const Limb d2 = Limb(d1 - borrow);
+      borrow = Limb((ui < lo) || (d1 < borrow));
+      u(i + j) = d2;
+    }
+    if (borrow) { // qhat was one too large: add v back
+      --qhat;
+      Limb carry = 0;
+      for (int i = 0; i < n; ++i) {
+        const Double t = Double(u(i + j)) + Double(den.d[i]) + Double(carry);
+        u(i + j) = Limb(t);
+        carry = Limb(t >> LB);
+      }
+      u(j + n) = Limb(u(j + n) + carry);
+    }
+    quot.d[j] = Limb(qhat);
+  }
+  // The remainder is below the normalized divisor, so ext is zero.
+  shiftRightDigitsInPlace(num, sh);
+  shiftRightDigitsInPlace(den, sh);
+}
+
+template <typename Limb, int Count>
+constexpr DivModResult<Limb, Count>
+divModLongDigits(const DigitVector<Limb, Count> &num,
+                 const DigitVector<Limb, Count> &den) {
+  DivModResult<Limb, Count> r{};
+  r.rem = num;
+  DigitVector<Limb, Count> v = den;
+  divModLongDigitsInPlace(r.rem, v, r.quot);
+  return r;
+}
+
 // -----------------------------------------------------------------
 // Square root with remainder
 // -----------------------------------------------------------------
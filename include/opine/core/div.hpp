@@ -33,6 +33,8 @@
 // the restoring bit-serial tier — slow and obviously correct;
 // faster division is a Platform specialization that must produce
 // identical digits.
+//
+// Fixed-point words take fixed_point.hpp's integer overload instead.
 
 #include "opine/core/arith_detail.hpp"
 #include "opine/core/digits.hpp"
@@ -44,6 +46,8 @@ namespace opine {
 // div
 // -----------------------------------------------------------------
 template <typename T>
+  requires(!detail::is_decimal<typename T::number> &&
+           !detail::is_fixed_point<typename T::number>)
 constexpr auto div(typename T::storage_type a, typename T::storage_type b) {
   using Num = typename T::number;
   using Storage = typename T::storage_type;
@@ -64,40 +68,43 @@ constexpr auto div(typename T::storage_type a, typename T::storage_type b) {
   // ---------- Special value dispatch ----------
 
   if (ua.category == ValueCategory::NaN || ub.category == ValueCategory::NaN)
-    return detail::deliver<T>(detail::packSpecial<T>(ValueCategory::NaN, false),
-                              FlagNone);
+    return detail::deliver<T, Operation::Div>(
+        detail::packSpecial<T>(ValueCategory::NaN, false), FlagNone);
 
   if (ua.category == ValueCategory::Infinity) {
     if (ub.category == ValueCategory::Infinity)
       // Inf ÷ Inf = NaN: invalid operation (§7.2).
-      return detail::deliver<T>(
-          detail::packSpecial<T>(ValueCategory::NaN, false), FlagInvalid);
-    return detail::deliver<T>(
+      return detail::deliver<T, Operation::Div>(
+          detail::packSpecial<T>(ValueCategory::NaN, false), FlagInvalid,
+          detail::xorSign(result_sign));
+    return detail::deliver<T, Operation::Div>(
         detail::packSpecial<T>(ValueCategory::Infinity, result_sign), FlagNone);
   }
   if (ub.category == ValueCategory::Infinity)
-    return detail::deliver<T>(
+    return detail::deliver<T, Operation::Div>(
         detail::packSpecial<T>(ValueCategory::Zero, result_sign), FlagNone);
 
   if (ua.category == ValueCategory::Zero) {
     if (ub.category == ValueCategory::Zero)
       // 0 ÷ 0 = NaN: invalid operation (§7.2).
-      return detail::deliver<T>(
-          detail::packSpecial<T>(ValueCategory::NaN, false), FlagInvalid);
-    return detail::deliver<T>(
+      return detail::deliver<T, Operation::Div>(
+          detail::packSpecial<T>(ValueCategory::NaN, false), FlagInvalid,
+          detail::xorSign(result_sign));
+    return detail::deliver<T, Operation::Div>(
         detail::packSpecial<T>(ValueCategory::Zero, result_sign), FlagNone);
   }
   if (ub.category == ValueCategory::Zero) {
     // x ÷ 0: division by zero (§7.3). When the format has no Inf
     // encoding the exact infinite result saturates to max finite —
     // a delivered value that differs from the defined result, so
-    // inexact is raised too.
+    // inexact is raised too. A posit's defined result is NaR.
     constexpr flags_t DivZeroFlags =
-        Num::inf_encoding == InfEncoding::None
+        Num::inf_encoding == InfEncoding::None && !detail::is_posit<Num>
             ? flags_t(FlagDivByZero | FlagInexact)
             : FlagDivByZero;
-    return detail::deliver<T>(detail::packInfOrSaturate<T>(result_sign),
-                              DivZeroFlags);
+    return detail::deliver<T, Operation::Div>(
+        detail::packInfOrSaturate<T>(result_sign), DivZeroFlags,
+        detail::xorSign(result_sign));
   }
 
   // ---------- Finite ÷ Finite ----------
@@ -145,7 +152,8 @@ constexpr auto div(typename T::storage_type a, typename T::storage_type b) {
 
   flags_t flags = FlagNone;
   auto bits = detail::roundAndPack<T>(result_sign, result_exp, magnitude, flags);
-  return detail::deliver<T>(bits, flags);
+  return detail::deliver<T, Operation::Div>(bits, flags,
+                                            detail::xorSign(result_sign));
 }
 
 } // namespace opine
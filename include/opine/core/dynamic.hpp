@@ -0,0 +1,821 @@
+#ifndef OPINE_CORE_DYNAMIC_HPP
+#define OPINE_CORE_DYNAMIC_HPP
+
+// Formats chosen at run time: a DynamicFormat descriptor names the
+// axes a Type fixes at compile time, and a DynamicType runs the
+// arithmetic on it.
+//
+//   DynamicFormat f = DynamicFormat::ieee(5, 6);     // e5m6
+//   f.rounding = RoundingMode::TowardZero;
+//   auto t = dynamicType(f);                          // std::optional
+//   DynamicResult r = t->add(a, b);                   // bits + flags
+//
+// Two tiers sit behind one kernel table, resolved once per format:
+//
+//   - Precompiled. A descriptor that matches a Type in the format
+//     list (PrecompiledFormats by default: the named FP8, 16-, 32-
+//     and 64-bit Types) runs that Type's own kernels, instantiated
+//     for each of the six rounding modes.
+//   - Generic. Any other format runs the operation in a carrier —
+//     float128 rounding to odd — and rounds the carrier's result to
+//     the descriptor at run time. The carrier holds every operand
+//     exactly and keeps p + 2 digits over the whole range, so, as in
+//     convertVia, its odd last place stands in for the sticky bit
+//     and the second rounding decides as the first would have on the
+//     exact result. That second rounding is roundAndPack and pack
+//     (round_pack.hpp, pack_unpack.hpp) step for step, with the
+//     geometry read from the descriptor: the same G/R/S working
+//     form, shouldRoundUp and overflowRoundsToInf, tininess after
+//     rounding, output flush and IntegerExtremes collision.
+//
+// Either way the bits and flags are the static Type's: the generic
+// tier is tested against it exhaustively on FP8. Invalid and
+// division by zero come from the carrier's operation; overflow,
+// underflow and inexact from the final rounding. Two rules need the
+// descriptor as well: an exact zero sum is −0 under TowardNegative
+// (recomputed from negated operands, since the carrier rounds to
+// odd), and x ÷ 0 saturating where there is no Inf is inexact.
+//
+// Descriptors cover implicit-digit binary formats in the IEEE field
+// order, [S][E][M], up to 64 bits, with Explicit or RadixComplement
+// value_sign — every Type the named bundles spell except extFloat80
+// — within the carrier's range (valid() says which). Bits travel as
+// std::uint64_t in the low totalBits(). Results are always
+// DynamicResult: a runtime format has no Exceptions axis, so the
+// caller accumulates the flags.
+
+#include <bit>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <type_traits>
+
+#include "opine/core/add.hpp"
+#include "opine/core/arith_detail.hpp"
+#include "opine/core/convert.hpp"
+#include "opine/core/digits.hpp"
+#include "opine/core/div.hpp"
+#include "opine/core/fma.hpp"
+#include "opine/core/mul.hpp"
+#include "opine/core/neg_abs.hpp"
+#include "opine/core/pack_unpack.hpp"
+#include "opine/core/round_pack.hpp"
+#include "opine/core/sqrt.hpp"
+#include "opine/core/sub.hpp"
+#include "opine/core/type.hpp"
+
+namespace opine {
+
+// The Rounding axis as a value.
+enum class RoundingMode {
+  TowardZero,
+  ToNearestTiesToEven,
+  ToNearestTiesAway,
+  TowardPositive,
+  TowardNegative,
+  ToOdd,
+};
+
+template <typename R> constexpr RoundingMode roundingModeOf() {
+  if constexpr (std::is_same_v<R, rounding::TowardZero>)
+    return RoundingMode::TowardZero;
+  else if constexpr (std::is_same_v<R, rounding::ToNearestTiesAway>)
+    return RoundingMode::ToNearestTiesAway;
+  else if constexpr (std::is_same_v<R, rounding::TowardPositive>)
+    return RoundingMode::TowardPositive;
+  else if constexpr (std::is_same_v<R, rounding::TowardNegative>)
+    return RoundingMode::TowardNegative;
+  else if constexpr (std::is_same_v<R, rounding::ToOdd>)
+    return RoundingMode::ToOdd;
+  else
+    return RoundingMode::ToNearestTiesToEven;
+}
+
+// -----------------------------------------------------------------
+// DynamicFormat
+// -----------------------------------------------------------------
+// sig_bits counts the STORED significand bits (the leading digit is
+// implicit), as Layout does. The factories spell the named Number
+// bundles.
+struct DynamicFormat {
+  int exp_bits = 5;
+  int sig_bits = 10;
+  int exponent_bias = 15;
+  SignMethod value_sign = SignMethod::Explicit;
+  NegativeZero negative_zero = NegativeZero::Exists;
+  NanEncoding nan_encoding = NanEncoding::ReservedExponent;
+  InfEncoding inf_encoding = InfEncoding::ReservedExponent;
+  DenormalMode denormal_mode = DenormalMode::Full;
+  RoundingMode rounding = RoundingMode::ToNearestTiesToEven;
+
+  constexpr int totalBits() const { return 1 + exp_bits + sig_bits; }
+
+  constexpr bool operator==(const DynamicFormat &) const = default;
+
+  // numbers::IEEE754<E, M>.
+  static constexpr DynamicFormat ieee(int e, int m) {
+    return {e, m, (1 << (e - 1)) - 1};
+  }
+
+  // numbers::GPUStyle<E, M>: IEEE specials, both denormal flushes.
+  static constexpr DynamicFormat gpu(int e, int m) {
+    DynamicFormat f = ieee(e, m);
+    f.denormal_mode = DenormalMode::FlushBoth;
+    return f;
+  }
+
+  // numbers::Relaxed<E, M>: no NaN, Inf or −0; both flushes.
+  static constexpr DynamicFormat relaxed(int e, int m) {
+    DynamicFormat f = ieee(e, m);
+    f.negative_zero = NegativeZero::DoesNotExist;
+    f.nan_encoding = NanEncoding::None;
+    f.inf_encoding = InfEncoding::None;
+    f.denormal_mode = DenormalMode::FlushBoth;
+    return f;
+  }
+
+  // The fnuz shape of numbers::E4M3FNUZ at any width: bias 2^(E−1),
+  // NaN at the −0 pattern, no Inf.
+  static constexpr DynamicFormat fnuz(int e, int m) {
+    DynamicFormat f{e, m, 1 << (e - 1)};
+    f.negative_zero = NegativeZero::DoesNotExist;
+    f.nan_encoding = NanEncoding::NegativeZeroBitPattern;
+    f.inf_encoding = InfEncoding::None;
+    return f;
+  }
+
+  // numbers::RbjTwosComplement<E, M>.
+  static constexpr DynamicFormat rbj(int e, int m) {
+    DynamicFormat f{e, m, 1 << (e - 1), SignMethod::RadixComplement};
+    f.negative_zero = NegativeZero::DoesNotExist;
+    f.nan_encoding = NanEncoding::TrapValue;
+    f.inf_encoding = InfEncoding::IntegerExtremes;
+    return f;
+  }
+
+  // T's descriptor, rounding included.
+  template <typename T> static constexpr DynamicFormat of() {
+    using Num = typename T::number;
+    using Lay = typename T::layout;
+    static_assert(Lay::implicit_digit && Lay::is_standard() &&
+                      Lay::total_bits <= 64 && Num::exponent_base == 2,
+                  "DynamicFormat describes implicit-digit [S][E][M] "
+                  "binary layouts of at most 64 bits");
+    static_assert(Num::value_sign == SignMethod::Explicit ||
+                      Num::value_sign == SignMethod::RadixComplement,
+                  "DynamicFormat covers Explicit and RadixComplement "
+                  "value_sign");
+    return {Lay::exp_bits,        Lay::sig_bits,
+            Num::exponent_bias,   Num::value_sign,
+            Num::negative_zero,   Num::nan_encoding,
+            Num::inf_encoding,    Num::denormal_mode,
+            roundingModeOf<typename T::rounding>()};
+  }
+
+  // The descriptor is one the generic tier computes exactly: the
+  // FloatingPoint consistency rules hold, it fits 64 bits, and the
+  // carrier (float128) is via_correctly_rounded for it — its range
+  // covers the top binade and reaches two binades below the
+  // smallest weight (so at most 15 exponent bits).
+  constexpr bool valid() const {
+    if (exp_bits < 1 || exp_bits > 15 || sig_bits < 1 || totalBits() > 64)
+      return false;
+    if (nan_encoding == NanEncoding::NegativeZeroBitPattern &&
+        negative_zero != NegativeZero::DoesNotExist)
+      return false;
+    if (value_sign == SignMethod::RadixComplement &&
+        ((nan_encoding != NanEncoding::TrapValue &&
+          nan_encoding != NanEncoding::None) ||
+         (inf_encoding != InfEncoding::IntegerExtremes &&
+          inf_encoding != InfEncoding::None) ||
+         negative_zero != NegativeZero::DoesNotExist))
+      return false;
+    if (value_sign != SignMethod::Explicit &&
+        value_sign != SignMethod::RadixComplement)
+      return false;
+    const int max_unbiased = maxBiasedExp() - exponent_bias;
+    const int min_weight = (1 - exponent_bias) - sig_bits;
+    return max_unbiased <= 16383 && min_weight >= -16494 + 2;
+  }
+
+  // max_biased_exp<T>.
+  constexpr int maxBiasedExp() const {
+    const int exp_max = (1 << exp_bits) - 1;
+    return (nan_encoding == NanEncoding::ReservedExponent ||
+            inf_encoding == InfEncoding::ReservedExponent)
+               ? exp_max - 1
+               : exp_max;
+  }
+};
+
+// An operation's result: the bits and the flags it raised.
+struct DynamicResult {
+  std::uint64_t bits;
+  flags_t flags;
+};
+
+// A list of Types to precompile; see PrecompiledFormats.
+template <typename... Ts> struct FormatList {};
+
+// The Types DynamicType runs natively, each under all six rounding
+// modes. Add to it (or pass another list) for formats a sweep
+// visits often.
+using PrecompiledFormats =
+    FormatList<fp8_e5m2, fp8_e4m3, fp8_e4m3fnuz, RbjType<5, 2>, RbjType<4, 3>,
+               float16, bfloat16, float32, float64>;
+
+namespace detail {
+
+// Calls f.template operator()<R>() with the policy for m.
+template <typename F> constexpr decltype(auto) withRoundingMode(RoundingMode m,
+                                                                F &&f) {
+  switch (m) {
+  case RoundingMode::TowardZero:
+    return f.template operator()<rounding::TowardZero>();
+  case RoundingMode::ToNearestTiesAway:
+    return f.template operator()<rounding::ToNearestTiesAway>();
+  case RoundingMode::TowardPositive:
+    return f.template operator()<rounding::TowardPositive>();
+  case RoundingMode::TowardNegative:
+    return f.template operator()<rounding::TowardNegative>();
+  case RoundingMode::ToOdd:
+    return f.template operator()<rounding::ToOdd>();
+  case RoundingMode::ToNearestTiesToEven:
+    break;
+  }
+  return f.template operator()<rounding::ToNearestTiesToEven>();
+}
+
+// The generic tier's carrier: see the header comment.
+using DynamicCarrier = WithExceptions<WithRounding<float128, rounding::ToOdd>,
+                                      exceptions::ReturnStatus>;
+using CarrierBits = DynamicCarrier::storage_type;
+
+inline constexpr int CarrierSigBits =
+    DynamicCarrier::number::significand::digit_count;
+inline constexpr int CarrierBias = DynamicCarrier::number::exponent_bias;
+
+// The working magnitude: p + GuardBits ≤ 65 bits.
+using DynamicDigits = DigitVector<std::uint64_t, 2>;
+
+// -----------------------------------------------------------------
+// Runtime codec — pack_unpack.hpp for a descriptor
+// -----------------------------------------------------------------
+// unpack, then flushInputDenormal.
+constexpr UnpackedFloat<std::uint64_t>
+unpackDynamic(const DynamicFormat &f, std::uint64_t bits) {
+  using S = std::uint64_t;
+  const int total = f.totalBits();
+  const std::uint64_t exp_max = (std::uint64_t{1} << f.exp_bits) - 1;
+
+  bits = andWords(bits, wordOnes<S>(total));
+  UnpackedFloat<S> u{};
+
+  // Whole-word special values.
+  if (f.nan_encoding == NanEncoding::TrapValue &&
+      bits == wordBit<S>(total - 1)) {
+    u.category = ValueCategory::NaN;
+    return u;
+  }
+  if (f.inf_encoding == InfEncoding::IntegerExtremes) {
+    const S pos_inf = wordOnes<S>(total - 1);
+    if (bits == pos_inf || bits == negateWordBits(pos_inf, total)) {
+      u.category = ValueCategory::Infinity;
+      u.sign = bits != pos_inf;
+      return u;
+    }
+  }
+
+  // Sign and positive-magnitude fields.
+  bool sign;
+  S mag_bits = bits;
+  if (f.value_sign == SignMethod::Explicit) {
+    sign = testWordBit(bits, f.exp_bits + f.sig_bits);
+  } else {
+    sign = testWordBit(bits, total - 1);
+    if (sign)
+      mag_bits = negateWordBits(bits, total);
+  }
+  const std::uint64_t raw_exp =
+      extractIntField(mag_bits, f.sig_bits, f.exp_bits);
+  const S raw_sig = extractWordField(mag_bits, 0, f.sig_bits);
+
+  // Field-based special values.
+  if (f.nan_encoding == NanEncoding::NegativeZeroBitPattern && sign &&
+      raw_exp == 0 && raw_sig == 0) {
+    u.category = ValueCategory::NaN;
+    return u;
+  }
+  if (raw_exp == exp_max) {
+    if (f.inf_encoding == InfEncoding::ReservedExponent && raw_sig == 0) {
+      u.category = ValueCategory::Infinity;
+      u.sign = sign;
+      return u;
+    }
+    if (f.nan_encoding == NanEncoding::ReservedExponent && raw_sig != 0) {
+      u.category = ValueCategory::NaN;
+      return u;
+    }
+  }
+
+  const bool neg_zero = f.negative_zero == NegativeZero::Exists;
+  if (raw_sig == 0 && raw_exp == 0) {
+    u.category = ValueCategory::Zero;
+    u.sign = sign && neg_zero;
+    return u;
+  }
+
+  u.category = ValueCategory::Finite;
+  u.sign = sign;
+  u.biased_exp = int(raw_exp);
+  u.significand = raw_exp == 0 ? raw_sig : orWords(raw_sig, wordBit<S>(f.sig_bits));
+
+  if ((f.denormal_mode == DenormalMode::FlushInputs ||
+       f.denormal_mode == DenormalMode::FlushBoth) &&
+      u.biased_exp == 0) {
+    u.category = ValueCategory::Zero;
+    if (!neg_zero)
+      u.sign = false;
+  }
+  return u;
+}
+
+constexpr std::uint64_t packDynamic(const DynamicFormat &f,
+                                    const UnpackedFloat<std::uint64_t> &u) {
+  using S = std::uint64_t;
+  const int total = f.totalBits();
+  const int sign_offset = f.exp_bits + f.sig_bits;
+  const S exp_field = shiftWordLeft(wordOnes<S>(f.exp_bits), f.sig_bits);
+
+  if (u.category == ValueCategory::NaN) {
+    switch (f.nan_encoding) {
+    case NanEncoding::TrapValue:
+      return wordBit<S>(total - 1);
+    case NanEncoding::NegativeZeroBitPattern:
+      return wordBit<S>(sign_offset);
+    case NanEncoding::ReservedExponent:
+      return orWords(exp_field, wordBit<S>(f.sig_bits - 1));
+    case NanEncoding::None:
+      break;
+    }
+    return S{};
+  }
+
+  if (u.category == ValueCategory::Infinity) {
+    if (f.inf_encoding == InfEncoding::IntegerExtremes) {
+      const S pos_inf = wordOnes<S>(total - 1);
+      return u.sign ? negateWordBits(pos_inf, total) : pos_inf;
+    }
+    if (f.inf_encoding == InfEncoding::ReservedExponent)
+      return u.sign ? orWords(exp_field, wordBit<S>(sign_offset)) : exp_field;
+    return S{};
+  }
+
+  if (u.category == ValueCategory::Zero) {
+    if (u.sign && f.negative_zero == NegativeZero::Exists &&
+        f.value_sign == SignMethod::Explicit)
+      return wordBit<S>(sign_offset);
+    return S{};
+  }
+
+  S bits = orWords(shiftWordLeft(S(u.biased_exp), f.sig_bits),
+                   andWords(u.significand, wordOnes<S>(f.sig_bits)));
+  if (f.value_sign == SignMethod::Explicit) {
+    if (u.sign)
+      bits = orWords(bits, wordBit<S>(sign_offset));
+    return bits;
+  }
+  if (u.sign)
+    bits = negateWordBits(bits, total);
+  return andWords(bits, wordOnes<S>(total));
+}
+
+constexpr std::uint64_t packSpecialDynamic(const DynamicFormat &f,
+                                           ValueCategory c, bool sign) {
+  UnpackedFloat<std::uint64_t> u{};
+  u.category = c;
+  u.sign = sign;
+  return packDynamic(f, u);
+}
+
+// packMaxFinite / packInfOrSaturate.
+constexpr std::uint64_t packMaxFiniteDynamic(const DynamicFormat &f,
+                                             bool sign) {
+  UnpackedFloat<std::uint64_t> u{ValueCategory::Finite, sign, f.maxBiasedExp(),
+                                 wordOnes<std::uint64_t>(f.sig_bits + 1)};
+  if (f.inf_encoding == InfEncoding::IntegerExtremes)
+    u.significand -= 1;
+  return packDynamic(f, u);
+}
+
+constexpr std::uint64_t packInfOrSaturateDynamic(const DynamicFormat &f,
+                                                 bool sign) {
+  if (f.inf_encoding != InfEncoding::None)
+    return packSpecialDynamic(f, ValueCategory::Infinity, sign);
+  return packMaxFiniteDynamic(f, sign);
+}
+
+// -----------------------------------------------------------------
+// Runtime epilogue — roundAndPack for a descriptor
+// -----------------------------------------------------------------
+// Same precondition, steps and flags as roundAndPack; the comments
+// there explain each one.
+template <typename Rnd>
+constexpr std::uint64_t roundAndPackDynamic(const DynamicFormat &f,
+                                            bool result_sign, int result_exp,
+                                            DynamicDigits magnitude,
+                                            flags_t &flags) {
+  using DV = DynamicDigits;
+  constexpr int GBits = GuardBits;
+  const int SigBits = f.sig_bits + 1;
+  const int ExpMax = (1 << f.exp_bits) - 1;
+  const int MaxBiasedExp = f.maxBiasedExp();
+  const DV One = digitsFrom<std::uint64_t, 2>(1);
+
+  // After-rounding tininess.
+  bool tiny = false;
+  if (result_exp < 1) {
+    int e_unbounded = result_exp;
+    if (shouldRoundUp<Rnd>(bitAt(magnitude, GBits),
+                           bitAt(magnitude, GBits - 1),
+                           bitAt(magnitude, GBits - 2),
+                           anyBitsBelow(magnitude, GBits - 2), result_sign)) {
+      const DV t = addDigits(shiftRightDigits(magnitude, GBits), One);
+      if (topBitPos(t) >= SigBits)
+        e_unbounded += 1;
+    }
+    tiny = e_unbounded < 1;
+  }
+
+  if (result_exp < 1) {
+    magnitude = shiftRightStickyDigits(magnitude, 1 - result_exp);
+    result_exp = 0;
+  }
+
+  // Round.
+  DV stored_sig = shiftRightDigits(magnitude, GBits);
+  const bool guard_bit = bitAt(magnitude, GBits - 1);
+  const bool round_bit = bitAt(magnitude, GBits - 2);
+  const bool sticky = anyBitsBelow(magnitude, GBits - 2);
+  if (guard_bit || round_bit || sticky)
+    flags |= FlagInexact;
+  if (shouldRoundUp<Rnd>(bitAt(magnitude, GBits), guard_bit, round_bit,
+                         sticky, result_sign))
+    stored_sig = addDigits(stored_sig, One);
+
+  if (topBitPos(stored_sig) >= SigBits) {
+    stored_sig = shiftRightDigits(stored_sig, 1);
+    result_exp += 1;
+  }
+  if (result_exp == 0 && topBitPos(stored_sig) >= SigBits - 1)
+    result_exp = 1;
+
+  // Overflow.
+  if (result_exp > MaxBiasedExp) {
+    flags |= FlagOverflow | FlagInexact;
+    if (f.inf_encoding != InfEncoding::None &&
+        overflowRoundsToInf<Rnd>(result_sign))
+      return packSpecialDynamic(f, ValueCategory::Infinity, result_sign);
+    result_exp = MaxBiasedExp;
+    stored_sig = maskLowDigits<std::uint64_t, 2>(SigBits);
+  }
+
+  // Output denormal flush.
+  if ((f.denormal_mode == DenormalMode::FlushToZero ||
+       f.denormal_mode == DenormalMode::FlushBoth) &&
+      result_exp == 0 && !isZero(stored_sig)) {
+    flags |= FlagUnderflow | FlagInexact;
+    return packSpecialDynamic(
+        f, ValueCategory::Zero,
+        f.negative_zero == NegativeZero::Exists && result_sign);
+  }
+
+  // IntegerExtremes collision.
+  if (f.inf_encoding == InfEncoding::IntegerExtremes) {
+    const std::uint64_t tentative =
+        (std::uint64_t(result_exp) << f.sig_bits) |
+        (lowUint64(stored_sig) & wordOnes<std::uint64_t>(f.sig_bits));
+    if (tentative >= wordOnes<std::uint64_t>(f.totalBits() - 1)) {
+      flags |= FlagOverflow | FlagInexact;
+      if (overflowRoundsToInf<Rnd>(result_sign))
+        return packSpecialDynamic(f, ValueCategory::Infinity, result_sign);
+      result_exp = ExpMax;
+      stored_sig = subDigits(maskLowDigits<std::uint64_t, 2>(SigBits), One);
+    }
+  }
+
+  if (tiny && (flags & FlagInexact))
+    flags |= FlagUnderflow;
+
+  UnpackedFloat<std::uint64_t> result{};
+  result.category = (isZero(stored_sig) && result_exp == 0)
+                        ? ValueCategory::Zero
+                        : ValueCategory::Finite;
+  result.sign = result_sign;
+  result.biased_exp = result_exp;
+  result.significand = lowUint64(stored_sig);
+  return packDynamic(f, result);
+}
+
+// -----------------------------------------------------------------
+// Carrier transfers
+// -----------------------------------------------------------------
+// A descriptor value in the carrier: exact, since valid() keeps
+// every weight within the carrier's; the lowest land in its
+// subnormals (rebaseExact's shift).
+inline CarrierBits toCarrierDynamic(const DynamicFormat &f,
+                                    std::uint64_t bits) {
+  const UnpackedFloat<std::uint64_t> u = unpackDynamic(f, bits);
+  UnpackedFloat<CarrierBits> c{u.category, u.sign, 0, CarrierBits{}};
+  if (u.category == ValueCategory::Finite) {
+    const int e = (u.biased_exp == 0) ? 1 : u.biased_exp;
+    const int top = wordTopBit(u.significand);
+    c.biased_exp = (e - f.exponent_bias) + (top - f.sig_bits) + CarrierBias;
+    c.significand = shiftWordLeft(CarrierBits(u.significand),
+                                  (CarrierSigBits - 1) - top);
+    if (c.biased_exp < 1) {
+      c.significand = shiftWordRight(c.significand, 1 - c.biased_exp);
+      c.biased_exp = 0;
+    }
+  }
+  return pack<DynamicCarrier>(c);
+}
+
+// The carrier value rounded to the descriptor: convertRounded with
+// a runtime Dst. op_flags are those of the step that produced it:
+// Invalid and DivByZero carry over, and Overflow says the value was
+// beyond the carrier — to odd saturated it — so it is beyond f too
+// (convertVia's fallback, without a direct kernel to fall back to).
+template <typename Rnd>
+inline DynamicResult fromCarrierDynamic(const DynamicFormat &f,
+                                        CarrierBits bits, flags_t op_flags) {
+  constexpr int GBits = GuardBits;
+  flags_t flags = flags_t(op_flags & (FlagInvalid | FlagDivByZero));
+  const UnpackedFloat<CarrierBits> u = unpack<DynamicCarrier>(bits);
+
+  if (u.category == ValueCategory::NaN)
+    return {packSpecialDynamic(f, ValueCategory::NaN, false), flags};
+  if (u.category == ValueCategory::Infinity) {
+    // Saturating where there is no Inf: x ÷ 0 (div's DivZeroFlags)
+    // or an infinite source (convert's InfFlags).
+    if (f.inf_encoding == InfEncoding::None)
+      flags |= (flags & FlagDivByZero) ? FlagInexact
+                                       : flags_t(FlagOverflow | FlagInexact);
+    return {packInfOrSaturateDynamic(f, u.sign), flags};
+  }
+  if (u.category == ValueCategory::Zero)
+    return {packSpecialDynamic(f, ValueCategory::Zero, u.sign), flags};
+
+  const int e = (u.biased_exp == 0) ? 1 : u.biased_exp;
+  DynamicDigits magnitude =
+      digitsFromStorage<std::uint64_t, 2>(u.significand);
+  const int cur_msb = topBitPos(magnitude);
+  const int unbiased = (e - CarrierBias) + (cur_msb - (CarrierSigBits - 1));
+  const int target_msb = (f.sig_bits + 1) + GBits - 1;
+  if (cur_msb > target_msb)
+    magnitude = shiftRightStickyDigits(magnitude, cur_msb - target_msb);
+  else if (cur_msb < target_msb)
+    magnitude = shiftLeftDigits(magnitude, target_msb - cur_msb);
+
+  const int result_exp = (op_flags & FlagOverflow)
+                             ? f.maxBiasedExp() + 1
+                             : unbiased + f.exponent_bias;
+  const std::uint64_t out =
+      roundAndPackDynamic<Rnd>(f, u.sign, result_exp, magnitude, flags);
+  return {out, flags};
+}
+
+// -----------------------------------------------------------------
+// Kernel tables
+// -----------------------------------------------------------------
+struct DynamicKernels {
+  DynamicResult (*add)(const DynamicFormat &, std::uint64_t, std::uint64_t);
+  DynamicResult (*sub)(const DynamicFormat &, std::uint64_t, std::uint64_t);
+  DynamicResult (*mul)(const DynamicFormat &, std::uint64_t, std::uint64_t);
+  DynamicResult (*div)(const DynamicFormat &, std::uint64_t, std::uint64_t);
+  DynamicResult (*fma)(const DynamicFormat &, std::uint64_t, std::uint64_t,
+                       std::uint64_t);
+  DynamicResult (*sqrt)(const DynamicFormat &, std::uint64_t);
+  CarrierBits (*to_carrier)(const DynamicFormat &, std::uint64_t);
+  DynamicResult (*from_carrier)(const DynamicFormat &, CarrierBits, flags_t);
+};
+
+// Precompiled: T's own kernels.
+template <typename T> struct StaticKernels {
+  using S = WithExceptions<T, exceptions::ReturnStatus>;
+  using Storage = typename T::storage_type;
+
+  // So a carrier value saturated by to odd still overflows T, and
+  // fromCarrier needs no flags.
+  static_assert(max_unbiased_exp<T> < max_unbiased_exp<DynamicCarrier>,
+                "precompiled Types sit strictly inside the carrier's range");
+
+  static DynamicResult result(const WithStatus<S> &r) {
+    return {std::uint64_t(r.bits), r.flags};
+  }
+  static DynamicResult add(const DynamicFormat &, std::uint64_t a,
+                           std::uint64_t b) {
+    return result(opine::add<S>(Storage(a), Storage(b)));
+  }
+  static DynamicResult sub(const DynamicFormat &, std::uint64_t a,
+                           std::uint64_t b) {
+    return result(opine::sub<S>(Storage(a), Storage(b)));
+  }
+  static DynamicResult mul(const DynamicFormat &, std::uint64_t a,
+                           std::uint64_t b) {
+    return result(opine::mul<S>(Storage(a), Storage(b)));
+  }
+  static DynamicResult div(const DynamicFormat &, std::uint64_t a,
+                           std::uint64_t b) {
+    return result(opine::div<S>(Storage(a), Storage(b)));
+  }
+  static DynamicResult fma(const DynamicFormat &, std::uint64_t a,
+                           std::uint64_t b, std::uint64_t c) {
+    return result(opine::fma<S>(Storage(a), Storage(b), Storage(c)));
+  }
+  static DynamicResult sqrt(const DynamicFormat &, std::uint64_t a) {
+    return result(opine::sqrt<S>(Storage(a)));
+  }
+  static CarrierBits toCarrier(const DynamicFormat &, std::uint64_t a) {
+    return convert<DynamicCarrier, T>(Storage(a)).bits;
+  }
+  static DynamicResult fromCarrier(const DynamicFormat &, CarrierBits c,
+                                   flags_t) {
+    return result(convert<S, DynamicCarrier>(c));
+  }
+
+  static constexpr DynamicKernels table{&add, &sub, &mul,       &div,
+                                        &fma, &sqrt, &toCarrier, &fromCarrier};
+};
+
+// Generic: the carrier operation, then the runtime epilogue.
+template <typename Rnd> struct GenericKernels {
+  using C = DynamicCarrier;
+  static constexpr bool negative_zero_sums =
+      std::is_same_v<Rnd, rounding::TowardNegative>;
+
+  static bool isZeroResult(const WithStatus<C> &r) {
+    return unpack<C>(r.bits).category == ValueCategory::Zero;
+  }
+  static DynamicResult finish(const DynamicFormat &f, const WithStatus<C> &r) {
+    return fromCarrierDynamic<Rnd>(f, r.bits, r.flags);
+  }
+
+  static DynamicResult add(const DynamicFormat &f, std::uint64_t a,
+                           std::uint64_t b) {
+    const CarrierBits ca = toCarrierDynamic(f, a), cb = toCarrierDynamic(f, b);
+    WithStatus<C> r = opine::add<C>(ca, cb);
+    if (negative_zero_sums && isZeroResult(r))
+      r.bits = neg<C>(opine::add<C>(neg<C>(ca), neg<C>(cb)).bits);
+    return finish(f, r);
+  }
+  static DynamicResult sub(const DynamicFormat &f, std::uint64_t a,
+                           std::uint64_t b) {
+    const CarrierBits ca = toCarrierDynamic(f, a), cb = toCarrierDynamic(f, b);
+    WithStatus<C> r = opine::sub<C>(ca, cb);
+    if (negative_zero_sums && isZeroResult(r))
+      r.bits = neg<C>(opine::sub<C>(neg<C>(ca), neg<C>(cb)).bits);
+    return finish(f, r);
+  }
+  static DynamicResult mul(const DynamicFormat &f, std::uint64_t a,
+                           std::uint64_t b) {
+    return finish(f, opine::mul<C>(toCarrierDynamic(f, a),
+                                   toCarrierDynamic(f, b)));
+  }
+  static DynamicResult div(const DynamicFormat &f, std::uint64_t a,
+                           std::uint64_t b) {
+    return finish(f, opine::div<C>(toCarrierDynamic(f, a),
+                                   toCarrierDynamic(f, b)));
+  }
+  static DynamicResult fma(const DynamicFormat &f, std::uint64_t a,
+                           std::uint64_t b, std::uint64_t c) {
+    const CarrierBits ca = toCarrierDynamic(f, a), cb = toCarrierDynamic(f, b),
+                      cc = toCarrierDynamic(f, c);
+    WithStatus<C> r = opine::fma<C>(ca, cb, cc);
+    if (negative_zero_sums && isZeroResult(r))
+      r.bits = neg<C>(opine::fma<C>(neg<C>(ca), cb, neg<C>(cc)).bits);
+    return finish(f, r);
+  }
+  static DynamicResult sqrt(const DynamicFormat &f, std::uint64_t a) {
+    return finish(f, opine::sqrt<C>(toCarrierDynamic(f, a)));
+  }
+  static constexpr DynamicKernels table{&add,
+                                        &sub,
+                                        &mul,
+                                        &div,
+                                        &fma,
+                                        &sqrt,
+                                        &toCarrierDynamic,
+                                        &fromCarrierDynamic<Rnd>};
+};
+
+// k = T's kernels under f's rounding mode, when f describes T
+// (rounding aside).
+template <typename T>
+bool matchKernels(const DynamicFormat &f, const DynamicKernels *&k) {
+  DynamicFormat d = DynamicFormat::of<T>();
+  d.rounding = f.rounding;
+  if (d != f)
+    return false;
+  k = withRoundingMode(f.rounding, []<typename R>() {
+    return &StaticKernels<WithRounding<T, R>>::table;
+  });
+  return true;
+}
+
+// The first Type in the list that f describes (rounding aside),
+// under f's rounding mode; null when none does.
+template <typename... Ts>
+const DynamicKernels *precompiledKernels(const DynamicFormat &f,
+                                         FormatList<Ts...>) {
+  const DynamicKernels *k = nullptr;
+  (void)(matchKernels<Ts>(f, k) || ... || false);
+  return k;
+}
+
+} // namespace detail
+
+// -----------------------------------------------------------------
+// DynamicType
+// -----------------------------------------------------------------
+// A descriptor with its kernels resolved. Cheap to copy; build one
+// per format with dynamicType() and keep it for the sweep.
+struct DynamicType {
+  DynamicFormat format;
+  const detail::DynamicKernels *kernels;
+  bool precompiled; // running a Type's own kernels
+
+  DynamicResult add(std::uint64_t a, std::uint64_t b) const {
+    return kernels->add(format, a, b);
+  }
+  DynamicResult sub(std::uint64_t a, std::uint64_t b) const {
+    return kernels->sub(format, a, b);
+  }
+  DynamicResult mul(std::uint64_t a, std::uint64_t b) const {
+    return kernels->mul(format, a, b);
+  }
+  DynamicResult div(std::uint64_t a, std::uint64_t b) const {
+    return kernels->div(format, a, b);
+  }
+  DynamicResult fma(std::uint64_t a, std::uint64_t b, std::uint64_t c) const {
+    return kernels->fma(format, a, b, c);
+  }
+  DynamicResult sqrt(std::uint64_t a) const { return kernels->sqrt(format, a); }
+
+  // Conversions, with convert's results: src's value is exact in
+  // the carrier, so the one rounding is to this format.
+  DynamicResult convertFrom(const DynamicType &src, std::uint64_t bits) const {
+    return kernels->from_carrier(
+        format, src.kernels->to_carrier(src.format, bits), FlagNone);
+  }
+
+  // From a static Type: Src rounds to odd into the carrier first (a
+  // no-op unless Src is wider), which convertVia shows is exact
+  // enough.
+  template <typename Src>
+  DynamicResult convertFrom(typename Src::storage_type bits) const {
+    const auto c = convert<detail::DynamicCarrier, Src>(bits);
+    return kernels->from_carrier(format, c.bits,
+                                 flags_t(c.flags & FlagOverflow));
+  }
+
+  // To a static Type, delivered through Dst's Exceptions axis.
+  template <typename Dst> auto convertTo(std::uint64_t bits) const {
+    const auto r = convert<WithExceptions<Dst, exceptions::ReturnStatus>,
+                           detail::DynamicCarrier>(
+        kernels->to_carrier(format, bits));
+    return detail::deliver<Dst, Operation::Convert>(r.bits, r.flags);
+  }
+
+  // The native bridges (fromNative / toDouble).
+  DynamicResult fromNative(double v) const {
+    static_assert(std::numeric_limits<double>::is_iec559 &&
+                      sizeof(double) == 8,
+                  "fromNative(double) requires IEEE 754 binary64");
+    return convertFrom<float64>(
+        float64::storage_type(std::bit_cast<std::uint64_t>(v)));
+  }
+  double toDouble(std::uint64_t bits) const {
+    return std::bit_cast<double>(std::uint64_t(
+        convertTo<WithExceptions<float64, exceptions::Silent>>(bits)));
+  }
+};
+
+// f's DynamicType: a Type from Formats when one matches, the generic
+// tier otherwise; nullopt when f is not valid().
+template <typename Formats = PrecompiledFormats>
+std::optional<DynamicType> dynamicType(const DynamicFormat &f) {
+  if (!f.valid())
+    return std::nullopt;
+  if (const detail::DynamicKernels *k = detail::precompiledKernels(f, Formats{}))
+    return DynamicType{f, k, true};
+  return DynamicType{f,
+                     detail::withRoundingMode(f.rounding, []<typename R>() {
+                       return &detail::GenericKernels<R>::table;
+                     }),
+                     false};
+}
+
+} // namespace opine
+
+#endif // OPINE_CORE_DYNAMIC_HPP
@@ -1,7 +1,10 @@
 #ifndef OPINE_CORE_EXCEPTIONS_HPP
 #define OPINE_CORE_EXCEPTIONS_HPP
 
+#include <bit>
 #include <concepts>
+#include <cstdint>
+#include <type_traits>
 
 namespace opine {
 
@@ -22,6 +25,19 @@ inline constexpr flags_t FlagOverflow = 0x04;  // §7.4 overflow
 inline constexpr flags_t FlagUnderflow = 0x08; // §7.5 underflow
 inline constexpr flags_t FlagInexact = 0x10;   // §7.6 inexact
 
+// The rounding operations, as the Exceptions axis sees them: every
+// result is delivered with the operation that produced it, for
+// policies that tell them apart (Counting).
+enum class Operation { Add, Sub, Mul, Div, Fma, Sqrt, Convert, Parse };
+
+inline constexpr int OperationCount = 8;
+
+constexpr const char *operationName(Operation op) {
+  constexpr const char *Names[OperationCount] = {
+      "add", "sub", "mul", "div", "fma", "sqrt", "convert", "parse"};
+  return Names[int(op)];
+}
+
 // Accumulated flags for the StatusFlags policy: per-thread, sticky
 // until cleared — IEEE 754 §7.1 default exception handling.
 inline flags_t &statusFlags() {
@@ -63,10 +79,98 @@ struct ReturnStatus {
   static constexpr bool has_traps = false;
 };
 
-// Call a handler on exceptional conditions.
-struct Trap {
+// Accumulate into the innermost FlagScope live on this thread (the
+// sticky statusFlags() set when there is none). The scope merges
+// what it collected outward when it ends.
+struct Scoped {
+  static constexpr bool has_status_flags = true;
+  static constexpr bool has_traps = false;
+};
+
+// Call a handler on exceptional conditions: the flags in Enabled
+// trap, through the handlers installed with setTrapHandler; the
+// rest are discarded as under Silent. Nothing is looked up unless
+// an enabled flag fires, so the common path is Silent's code plus
+// one branch on the computed flags.
+template <flags_t Enabled> struct TrapOn {
   static constexpr bool has_status_flags = false;
   static constexpr bool has_traps = true;
+  static constexpr flags_t enabled = Enabled;
+};
+
+// The three flags that signal a result gone wrong rather than
+// merely rounded.
+using Trap = TrapOn<FlagInvalid | FlagDivByZero | FlagOverflow>;
+
+// Count every operation and every flag it raises, per Type, per
+// Operation (counting.hpp), then hand the flags on to Inner — so
+// Counting<> is telemetry alone and Counting<StatusFlags> keeps the
+// sticky set too. Each thread counts into its own shard: a few
+// adds per operation, no lock. A Type using it needs counting.hpp
+// (opine.hpp includes it); the kernels do not pull it in.
+template <typename Inner = Silent> struct Counting {
+  static constexpr bool has_status_flags = Inner::has_status_flags;
+  static constexpr bool has_traps = Inner::has_traps;
+  using inner = Inner;
+};
+
+// IEEE 754 §8 alternate exception handling, as a list of
+// attributes applied in deliver to every result of the Type:
+//
+//   Alternate<SubstituteXor<FlagOverflow, substitutes::MaxFinite>,
+//             Substitute<FlagInvalid, substitutes::Zero>,
+//             AbruptUnderflow, RecordException>
+//
+// clamps overflow, turns invalid operations into +0 and flushes
+// tiny results, with no second pass over the output. Each operation
+// first has AbruptUnderflow applied (when listed), then the first
+// Substitute or SubstituteXor whose flags it raised; RecordException
+// raises the operation's flags (as handled) in statusFlags() and
+// continues — without it they are discarded.
+//
+//   Substitute<On, X>     result := X
+//   SubstituteXor<On, X>  result := X signed with §8.3's XOR of the
+//                         operands' signs for mul and div (an invalid
+//                         one's NaN included), and with the default
+//                         result's sign for every other operation
+//   AbruptUnderflow       a tiny nonzero result — subnormal, or
+//                         flagged Underflow — becomes zero of its
+//                         sign, raising Underflow and Inexact
+//
+// Alternate is for binary floating-point Types only: its substitutes
+// and flush are built from the binary interchange encoding (exponent
+// field, packSpecial), and deliver rejects a decimal, posit, HFP or
+// fixed-point Type at compile time rather than produce a wrong
+// pattern for it. Those Types take the other policies.
+namespace substitutes {
+struct Zero {};
+struct MaxFinite {};
+struct Infinity {}; // max finite where the format has no Inf
+struct QuietNaN {};
+template <std::uint64_t B> struct Bits { // that exact pattern
+  static constexpr std::uint64_t bits = B;
+};
+} // namespace substitutes
+
+template <flags_t On, typename X> struct Substitute {
+  static constexpr flags_t on = On;
+  static constexpr bool keeps_sign = false;
+  using value = X;
+};
+
+template <flags_t On, typename X> struct SubstituteXor {
+  static constexpr flags_t on = On;
+  static constexpr bool keeps_sign = true;
+  using value = X;
+};
+
+struct AbruptUnderflow {};
+struct RecordException {};
+
+template <typename... Handling> struct Alternate {
+  static constexpr bool has_status_flags =
+      (std::is_same_v<Handling, RecordException> || ...);
+  static constexpr bool has_traps = false;
 };
 
 using Default = Silent;
@@ -74,9 +178,139 @@ using Default = Silent;
 static_assert(ExceptionPolicy<Silent>);
 static_assert(ExceptionPolicy<StatusFlags>);
 static_assert(ExceptionPolicy<ReturnStatus>);
+static_assert(ExceptionPolicy<Scoped>);
+static_assert(ExceptionPolicy<Counting<>>);
+static_assert(ExceptionPolicy<Alternate<AbruptUnderflow>>);
 static_assert(ExceptionPolicy<Trap>);
 
 } // namespace exceptions
+
+// -----------------------------------------------------------------
+// Flag scopes
+// -----------------------------------------------------------------
+// A FlagScope is a caller-owned flag set bound to its thread for its
+// lifetime. Operations of an exceptions::Scoped Type raise into the
+// innermost live scope; when a scope ends, what it collected is
+// merged into the one it shadowed — the enclosing scope, or the
+// sticky statusFlags() set — so nothing is lost, only deferred:
+//
+//   {
+//     FlagScope scope;
+//     for (...) y[i] = mul<S>(x[i], w[i]); // S: exceptions::Scoped
+//     if (scope.test(FlagOverflow)) ...    // this loop's flags only
+//   }                                      // merged outward here
+//
+// A scope also works as a context object, with no thread binding
+// consulted at all: scope(op<R>(...)) takes a ReturnStatus result,
+// raises its flags into the scope and returns its bits. Nothing but
+// the scope sees that accumulator, so a loop can keep it in a
+// register and store it once.
+struct FlagScope;
+
+namespace detail {
+
+inline FlagScope *&boundFlagScope() {
+  thread_local FlagScope *scope = nullptr;
+  return scope;
+}
+
+} // namespace detail
+
+struct FlagScope {
+  FlagScope() : prev(detail::boundFlagScope()) {
+    detail::boundFlagScope() = this;
+  }
+  ~FlagScope() {
+    detail::boundFlagScope() = prev;
+    (prev != nullptr ? prev->raised : statusFlags()) |= raised;
+  }
+
+  FlagScope(const FlagScope &) = delete;
+  FlagScope &operator=(const FlagScope &) = delete;
+
+  void raise(flags_t flags) { raised |= flags; }
+  bool test(flags_t mask) const { return (raised & mask) != 0; }
+  void clear(flags_t mask = 0x1F) { raised &= flags_t(~mask); }
+
+  template <typename T>
+  typename T::storage_type operator()(const WithStatus<T> &r) {
+    raised |= r.flags;
+    return r.bits;
+  }
+
+  flags_t raised = FlagNone;
+  FlagScope *prev;
+};
+
+namespace detail {
+
+// The flag set Scoped operations raise into on this thread.
+inline flags_t &scopedFlags() {
+  FlagScope *scope = boundFlagScope();
+  return scope != nullptr ? scope->raised : statusFlags();
+}
+
+} // namespace detail
+
+// IEEE 754 §9.3 operations on the same set: the innermost scope's
+// flags, or statusFlags() outside any scope. A saved set is a plain
+// flags_t — save, run something, restore the group you care about.
+inline flags_t saveAllFlags() { return detail::scopedFlags(); }
+
+// Sets every flag in group to its state in saved; leaves the rest.
+inline void restoreFlags(flags_t saved, flags_t group) {
+  flags_t &f = detail::scopedFlags();
+  f = flags_t((f & ~group) | (saved & group));
+}
+
+inline bool testSavedFlags(flags_t saved, flags_t group) {
+  return (saved & group) != 0;
+}
+
+// -----------------------------------------------------------------
+// Trap handlers
+// -----------------------------------------------------------------
+// One slot per flag, per Type, per thread. A handler receives the
+// operation's packed result and every flag the operation raised,
+// and returns the bits to deliver: the result itself (after
+// recording the event, say), a substitute, or nothing at all — it
+// may throw or abort. When an operation raises several enabled
+// flags, the handler of the lowest (Invalid first, Inexact last)
+// runs. An enabled flag with no handler falls back to §7 default
+// handling: the operation's flags are raised in statusFlags().
+template <typename T>
+using TrapHandler = typename T::storage_type (*)(typename T::storage_type,
+                                                  flags_t);
+
+namespace detail {
+
+template <typename T> struct TrapTable {
+  TrapHandler<T> on[5] = {}; // indexed by flag bit
+};
+
+template <typename T> TrapTable<T> &trapTable() {
+  thread_local TrapTable<T> table;
+  return table;
+}
+
+} // namespace detail
+
+// Installs h (nullptr: none) for each flag in flags on this thread;
+// returns the handler it replaced for the lowest of them.
+template <typename T>
+TrapHandler<T> setTrapHandler(flags_t flags, TrapHandler<T> h) {
+  auto &table = detail::trapTable<T>();
+  TrapHandler<T> prev = nullptr;
+  bool first = true;
+  for (unsigned f = flags & 0x1F; f != 0; f &= f - 1) {
+    TrapHandler<T> &slot = table.on[std::countr_zero(f)];
+    if (first)
+      prev = slot;
+    first = false;
+    slot = h;
+  }
+  return prev;
+}
 } // namespace opine
 
 #endif // OPINE_CORE_EXCEPTIONS_HPP
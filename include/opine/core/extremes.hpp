@@ -15,7 +15,11 @@
 //                           stays maxFinite. Formats that flush
 //                           denormals step over the subnormal range
 //                           entirely (those patterns have no value
-//                           of their own).
+//                           of their own). Posits step to the
+//                           adjacent pattern; IBM hex floats to
+//                           the adjacent normalized fraction;
+//                           fixed-point words to the adjacent
+//                           integer, saturating at either end.
 //
 // All results are canonical (repacked), like every computational op.
 
@@ -151,6 +155,61 @@ constexpr typename T::storage_type nextUpCore(typename T::storage_type bits,
   using Storage = typename T::storage_type;
   constexpr int P = Num::significand::digit_count;
 
+  if constexpr (is_posit<Num>) {
+    // Posits order as two's complement integers: the neighbour is
+    // the adjacent pattern, saturating at ±maxpos short of NaR.
+    constexpr int N = Num::total_digits;
+    constexpr std::uint64_t NaR = std::uint64_t{1} << (N - 1);
+    const std::uint64_t x = std::uint64_t(bits) & positWordMask<N>();
+    const std::uint64_t y = (mirror ? x - 1 : x + 1) & positWordMask<N>();
+    return Storage(x == NaR || y == NaR ? x : y);
+  }
+
+  if constexpr (is_fixed_point<Num>) {
+    // Fixed-point words order as integers: the neighbour is one ulp
+    // away, saturating at either end of the word's range.
+    bool neg = false;
+    const std::uint64_t m = fixedMagnitude<T>(bits, neg);
+    if (m == 0)
+      neg = mirror;
+    if (neg != mirror)
+      return fixedWord<T>(neg, m - 1);
+    return fixedWord<T>(neg, m == fixedLimit<T>(neg) ? m : m + 1);
+  }
+
+  if constexpr (is_hex_float<Num>) {
+    // Hex floats step their canonical fields: normalized above
+    // characteristic 0, any fraction at it (the format's own
+    // gradual-underflow grid). The top fraction carries into the
+    // next characteristic at 0.1; the largest magnitude saturates.
+    constexpr Storage Lead = Storage(1) << (P - 4);
+    constexpr Storage Max = (Storage(1) << P) - 1;
+    const Storage c = pack<T>(unpack<T>(bits));
+    bool sign = ((c >> T::layout::sign_offset) & 1) != 0;
+    int characteristic = int((c >> T::layout::exp_offset) & 0x7F);
+    Storage f = hexFraction<T>(c);
+    if (f == 0) {
+      sign = mirror;
+      characteristic = 0;
+      f = 1;
+    } else if (sign == mirror) { // away from zero
+      if (f != Max)
+        f += 1;
+      else if (characteristic == 127)
+        return c;
+      else {
+        characteristic += 1;
+        f = Lead;
+      }
+    } else if (f == Lead && characteristic > 0) {
+      characteristic -= 1;
+      f = Max;
+    } else {
+      f -= 1;
+    }
+    return hexWord<T>(sign, characteristic, f);
+  }
+
   auto u = unpackOperand<T>(bits);
   if (mirror && u.category != ValueCategory::NaN)
     u.sign = !u.sign;
@@ -0,0 +1,208 @@
+#ifndef OPINE_CORE_FIXED_POINT_HPP
+#define OPINE_CORE_FIXED_POINT_HPP
+
+// Fixed-point (Qm.n) arithmetic: the kernels that do not go through
+// the floating-point pipeline.
+//
+// A fixed-point Type (q7, q15, q31, q15_16, or any FixedPointType /
+// UFixedPointType) unpacks to the binary-normalized form like a
+// posit, so compare, classify, neg, abs, sqrt, fma, the integer and
+// string conversions and convert to and from every other Type run
+// through the ordinary kernels and come back through the fixed-point
+// roundAndPack (round_pack.hpp), which rounds to the ulp and
+// saturates. The codec is in pack_unpack.hpp.
+//
+// add, sub, mul and div are integer arithmetic on the word instead
+// (overloads here, taken by constraint),
+// in a working integer twice as wide, and are where the Number's
+// OverflowMode applies: Saturate clamps to the word's range, Wrap
+// keeps the low bits as int16_t arithmetic would. Either way a
+// result out of range raises overflow and inexact.
+//
+//   addFixed — the exact sum or difference. Never rounds.
+//   mulFixed — the exact product shifted back by n bits, rounded by
+//              the Type's Rounding: floor (an arithmetic shift) plus
+//              a per-mode increment, with no branch on the data, so
+//              a loop of them vectorizes (batch.hpp).
+//   divFixed — the quotient of the dividend scaled by 2^n, rounded
+//              by its remainder. x ÷ 0 saturates by x's sign and
+//              raises division by zero; 0 ÷ 0 is 0, invalid.
+//
+// Underflow is the floating-point one read at the ulp: a nonzero
+// exact result below 2^−n in magnitude that rounds. The Alternate
+// exception policy, whose abrupt underflow and substitutes assume
+// the binary floating-point encoding, is rejected at compile time.
+
+#include <bit>
+#include <cstdint>
+#include <type_traits>
+
+#include "opine/core/arith_detail.hpp"
+#include "opine/core/exceptions.hpp"
+#include "opine/core/pack_unpack.hpp"
+#include "opine/core/round_pack.hpp"
+
+namespace opine {
+namespace detail {
+
+// The word as a signed working integer, and back. Wide is any
+// integer type holding every value the kernel forms; the way back
+// applies the Number's overflow rule, raising overflow (and
+// inexact) whichever it is.
+template <typename T, typename Wide>
+constexpr Wide fixedToWide(typename T::storage_type bits) {
+  constexpr int W = T::layout::total_bits;
+  const std::uint64_t x = std::uint64_t(bits);
+  if constexpr (fixed_signed<T>)
+    return Wide(std::int64_t(x << (64 - W)) >> (64 - W));
+  else
+    return Wide(x & fixed_word_mask<T>);
+}
+
+template <typename T, typename Wide>
+constexpr WithStatus<T> fixedFromWide(Wide v, flags_t flags) {
+  constexpr int W = T::layout::total_bits;
+  constexpr Wide Max = Wide(fixedLimit<T>(false));
+  constexpr Wide Min = fixed_signed<T> ? Wide(-Wide(1) << (W - 1)) : Wide(0);
+  const bool below = v < Min, above = v > Max;
+  if constexpr (T::number::overflow == OverflowMode::Saturate)
+    v = below ? Min : above ? Max : v;
+  flags = flags_t(flags | ((below || above) ? FlagOverflow | FlagInexact
+                                            : FlagNone));
+  return {typename T::storage_type(std::uint64_t(v) & fixed_word_mask<T>),
+          flags};
+}
+
+// Working integers: one holding any sum or difference of two words,
+// and one holding any product.
+template <typename T>
+using FixedSum = std::conditional_t<(T::layout::total_bits <= 62),
+                                    std::int64_t, __int128>;
+
+template <typename T>
+using FixedProduct = std::conditional_t<
+    (2 * T::layout::total_bits - (fixed_signed<T> ? 2 : 0) <= 62),
+    std::int64_t,
+    std::conditional_t<fixed_signed<T>, __int128, unsigned __int128>>;
+
+// v · 2^−k rounded to an integer by Rnd, and whether it was inexact.
+template <typename Rnd, int K, typename Wide>
+constexpr Wide roundShift(Wide v, bool &inexact) {
+  if constexpr (K == 0) {
+    inexact = false;
+    return v;
+  } else {
+    constexpr Wide Half = Wide(1) << (K - 1);
+    const Wide q = v >> K; // floor
+    const Wide r = v & ((Wide(1) << K) - 1);
+    const bool neg = q < Wide(0);
+    inexact = r != 0;
+    if constexpr (std::is_same_v<Rnd, rounding::TowardNegative>)
+      return q;
+    else if constexpr (std::is_same_v<Rnd, rounding::TowardPositive>)
+      return q + Wide(r != 0);
+    else if constexpr (std::is_same_v<Rnd, rounding::TowardZero>)
+      return q + Wide(neg && r != 0);
+    else if constexpr (std::is_same_v<Rnd, rounding::ToNearestTiesToEven>)
+      return q + Wide(r > Half || (r == Half && (q & 1) != 0));
+    else if constexpr (std::is_same_v<Rnd, rounding::ToNearestTiesAway>)
+      return q + Wide(r > Half || (r == Half && !neg));
+    else
+      return q | Wide(r != 0); // ToOdd
+  }
+}
+
+template <typename T, Operation Op>
+constexpr WithStatus<T> addFixed(typename T::storage_type a,
+                                 typename T::storage_type b) {
+  using Wide = FixedSum<T>;
+  const Wide x = fixedToWide<T, Wide>(a), y = fixedToWide<T, Wide>(b);
+  return fixedFromWide<T>(Op == Operation::Sub ? x - y : x + y, FlagNone);
+}
+
+template <typename T>
+constexpr WithStatus<T> mulFixed(typename T::storage_type a,
+                                 typename T::storage_type b) {
+  using Wide = FixedProduct<T>;
+  constexpr int F = T::number::fraction_digits;
+  const Wide p = fixedToWide<T, Wide>(a) * fixedToWide<T, Wide>(b);
+  bool inexact = false;
+  const Wide q = roundShift<typename T::rounding, F>(p, inexact);
+  const Wide floor = p >> F;
+  const bool tiny = floor == Wide(0) || floor == Wide(-1);
+  return fixedFromWide<T>(
+      q, flags_t((inexact ? FlagInexact : FlagNone) |
+                 (inexact && tiny ? FlagUnderflow : FlagNone)));
+}
+
+template <typename T>
+constexpr WithStatus<T> divFixed(typename T::storage_type a,
+                                 typename T::storage_type b) {
+  using Storage = typename T::storage_type;
+  constexpr int F = T::number::fraction_digits;
+  bool na = false, nb = false;
+  const std::uint64_t ma = fixedMagnitude<T>(a, na);
+  const std::uint64_t mb = fixedMagnitude<T>(b, nb);
+  const bool neg = na != nb;
+  if (mb == 0)
+    return ma == 0 ? WithStatus<T>{Storage{}, FlagInvalid}
+                   : WithStatus<T>{fixedExtreme<T>(na), FlagDivByZero};
+
+  const unsigned __int128 num = static_cast<unsigned __int128>(ma) << F;
+  unsigned __int128 q = num / mb;
+  const unsigned __int128 r2 = (num % mb) * 2;
+  const bool guard = r2 >= mb;
+  const bool sticky = guard ? r2 != mb : r2 != 0;
+  flags_t flags = FlagNone;
+  if (guard || sticky)
+    flags |= q == 0 ? FlagInexact | FlagUnderflow : FlagInexact;
+  if (shouldRoundUp<typename T::rounding>((q & 1) != 0, guard, false, sticky,
+                                          neg))
+    q += 1;
+
+  if (q > fixedLimit<T>(neg)) {
+    flags |= FlagOverflow | FlagInexact;
+    if constexpr (T::number::overflow == OverflowMode::Saturate)
+      return {fixedExtreme<T>(neg), flags};
+  }
+  return {fixedWord<T>(neg, std::uint64_t(q)), flags};
+}
+
+} // namespace detail
+
+// -----------------------------------------------------------------
+// add / sub / mul / div
+// -----------------------------------------------------------------
+// These take over from the floating-point kernels by constraint, so
+// add<q15> reads as it does for every other Type.
+template <typename T>
+  requires detail::is_fixed_point<typename T::number>
+constexpr auto add(typename T::storage_type a, typename T::storage_type b) {
+  const auto r = detail::addFixed<T, Operation::Add>(a, b);
+  return detail::deliver<T, Operation::Add>(r.bits, r.flags);
+}
+
+template <typename T>
+  requires detail::is_fixed_point<typename T::number>
+constexpr auto sub(typename T::storage_type a, typename T::storage_type b) {
+  const auto r = detail::addFixed<T, Operation::Sub>(a, b);
+  return detail::deliver<T, Operation::Sub>(r.bits, r.flags);
+}
+
+template <typename T>
+  requires detail::is_fixed_point<typename T::number>
+constexpr auto mul(typename T::storage_type a, typename T::storage_type b) {
+  const auto r = detail::mulFixed<T>(a, b);
+  return detail::deliver<T, Operation::Mul>(r.bits, r.flags);
+}
+
+template <typename T>
+  requires detail::is_fixed_point<typename T::number>
+constexpr auto div(typename T::storage_type a, typename T::storage_type b) {
+  const auto r = detail::divFixed<T>(a, b);
+  return detail::deliver<T, Operation::Div>(r.bits, r.flags);
+}
+
+} // namespace opine
+
+#endif // OPINE_CORE_FIXED_POINT_HPP
@@ -40,6 +40,7 @@ namespace opine {
 // fma
 // -----------------------------------------------------------------
 template <typename T>
+  requires(!detail::is_decimal<typename T::number>)
 constexpr auto fma(typename T::storage_type a, typename T::storage_type b,
                    typename T::storage_type c) {
   using Num = typename T::number;
@@ -66,7 +67,7 @@ constexpr auto fma(typename T::storage_type a, typename T::storage_type b,
 
   if (ua.category == ValueCategory::NaN ||
       ub.category == ValueCategory::NaN || uc.category == ValueCategory::NaN)
-    return detail::deliver<T>(
+    return detail::deliver<T, Operation::Fma>(
         detail::packSpecial<T>(ValueCategory::NaN, false), FlagNone);
 
   const bool sign_p = ua.sign != ub.sign;
@@ -78,21 +79,21 @@ constexpr auto fma(typename T::storage_type a, typename T::storage_type b,
 
   if ((a_inf && b_zero) || (a_zero && b_inf))
     // Inf × 0 = NaN: invalid operation (§7.2).
-    return detail::deliver<T>(
+    return detail::deliver<T, Operation::Fma>(
         detail::packSpecial<T>(ValueCategory::NaN, false), FlagInvalid);
 
   if (a_inf || b_inf) {
     // Infinite product (the other factor is nonzero here).
     if (uc.category == ValueCategory::Infinity && uc.sign != sign_p)
       // Inf − Inf = NaN: invalid operation (§7.2).
-      return detail::deliver<T>(
+      return detail::deliver<T, Operation::Fma>(
           detail::packSpecial<T>(ValueCategory::NaN, false), FlagInvalid);
-    return detail::deliver<T>(
+    return detail::deliver<T, Operation::Fma>(
         detail::packSpecial<T>(ValueCategory::Infinity, sign_p), FlagNone);
   }
 
   if (uc.category == ValueCategory::Infinity)
-    return detail::deliver<T>(
+    return detail::deliver<T, Operation::Fma>(
         detail::packSpecial<T>(ValueCategory::Infinity, uc.sign), FlagNone);
 
   if (a_zero || b_zero) {
@@ -101,10 +102,10 @@ constexpr auto fma(typename T::storage_type a, typename T::storage_type b,
     if (uc.category == ValueCategory::Zero) {
       const bool sum_sign =
           (sign_p == uc.sign) ? sign_p : detail::exactZeroSumSign<Rnd>();
-      return detail::deliver<T>(
+      return detail::deliver<T, Operation::Fma>(
           detail::packSpecial<T>(ValueCategory::Zero, sum_sign), FlagNone);
     }
-    return detail::deliver<T>(pack<T>(uc), FlagNone);
+    return detail::deliver<T, Operation::Fma>(pack<T>(uc), FlagNone);
   }
 
   // ---------- Finite × finite (+ finite or zero) ----------
@@ -176,7 +177,7 @@ constexpr auto fma(typename T::storage_type a, typename T::storage_type b,
     const int cmp = detail::compareDigits(pw, cw);
     if (cmp == 0)
       // Exact cancellation: signed zero per the §6.3 rule.
-      return detail::deliver<T>(
+      return detail::deliver<T, Operation::Fma>(
           detail::packSpecial<T>(ValueCategory::Zero,
                                  detail::exactZeroSumSign<Rnd>()),
           FlagNone);
@@ -203,7 +204,7 @@ constexpr auto fma(typename T::storage_type a, typename T::storage_type b,
   flags_t flags = FlagNone;
   auto bits = detail::roundAndPack<T>(result_sign, result_exp, magnitude,
                                       flags);
-  return detail::deliver<T>(bits, flags);
+  return detail::deliver<T, Operation::Fma>(bits, flags);
 }
 
 } // namespace opine
@@ -0,0 +1,319 @@
+#ifndef OPINE_CORE_HFP_HPP
+#define OPINE_CORE_HFP_HPP
+
+// IBM hexadecimal floating point: the two places HFP departs from
+// the shared pipeline.
+//
+// Most of HFP needs nothing here. An HFP Type (hfp32, hfp64,
+// hfp128) unpacks to the binary-normalized form like a posit, runs
+// through the ordinary mul, div, fma, sqrt, compare and convert
+// kernels, and comes back through the hex-float roundAndPack, which
+// rounds at the value's own hex-digit boundary — TowardZero for the
+// predefined Types, i.e. the truncated result System/360 through
+// z/Architecture deliver. The codec is in pack_unpack.hpp and the
+// epilogue in round_pack.hpp. The Alternate exception policy, whose
+// abrupt underflow and substitutes assume the binary encoding, is
+// rejected on HFP Types at compile time.
+//
+// What is here:
+//
+//   addHexFloat  — add and sub (add<T> and sub<T> on an HFP Type
+//                  are overloads here, taken by constraint). The
+//                  architecture does not define an
+//                  HFP sum as the exact sum truncated: the operand
+//                  with the smaller characteristic is shifted right
+//                  by whole hex digits keeping ONE guard digit, and
+//                  digits shifted past it are lost before the add.
+//                  The two differ in subtraction (1 − 16^−7 is
+//                  0x40FFFFFF exactly truncated, 0x41100000 on the
+//                  hardware); this kernel is the hardware's. A zero
+//                  sum is the true zero, +0. Operands enter
+//                  normalized: an unnormalized operand aligns as its
+//                  normalized value would.
+//
+//   hexToBinary, binaryToHex — convert between HFP short or long and
+//                  an IEEE binary word (binary32, binary64; any
+//                  IEEE754Type of at most 64 bits) in 64-bit integer
+//                  arithmetic: one leading-zero count, one shift, one
+//                  rounding decision. convert takes them for those
+//                  pairs, and convertMany with it. They give exactly
+//                  convertRounded's bits and flags: the HFP side's
+//                  range limits as in roundAndPack, the binary side's
+//                  subnormals, overflow and tininess as in its.
+//                  Binary Inf saturates to the largest HFP magnitude
+//                  (overflow); a NaN, which HFP cannot represent,
+//                  becomes +0 and raises invalid.
+
+#include <bit>
+#include <cstdint>
+#include <type_traits>
+
+#include "opine/core/arith_detail.hpp"
+#include "opine/core/digits.hpp"
+#include "opine/core/exceptions.hpp"
+#include "opine/core/pack_unpack.hpp"
+#include "opine/core/round_pack.hpp"
+#include "opine/core/type.hpp"
+
+namespace opine {
+namespace detail {
+
+// -----------------------------------------------------------------
+// add / sub
+// -----------------------------------------------------------------
+template <typename T, Operation Op>
+constexpr auto addHexFloat(typename T::storage_type a,
+                           typename T::storage_type b) {
+  using Num = typename T::number;
+  using Storage = typename T::storage_type;
+  constexpr int F = Num::fraction_digits;
+  constexpr int SigBits = Num::significand::digit_count;
+
+  // A fraction with its guard digit below it, and a carry digit.
+  using DV = WorkingDigits<T, 4 * F + 8>;
+  using Limb = typename DV::limb_type;
+
+  UnpackedFloat<Storage> ua = computeOperand<T>(a);
+  UnpackedFloat<Storage> ub = computeOperand<T>(b);
+  if constexpr (Op == Operation::Sub)
+    ub.sign = !ub.sign;
+
+  if (ua.category == ValueCategory::Zero &&
+      ub.category == ValueCategory::Zero)
+    return deliver<T, Op>(hexWord<T>(false, 0, 0), FlagNone);
+
+  // Each operand as characteristic and fraction-with-guard-digit: the
+  // leading bit, at SigBits − 1 unpacked, moves to its place in the
+  // top hex digit and one digit further up. A zero takes no part.
+  int ca = 0, cb = 0;
+  auto hex = [](const UnpackedFloat<Storage> &u, int &c) {
+    const int scale = u.biased_exp - Num::exponent_bias;
+    c = (scale >> 2) + Num::characteristic_bias + 1;
+    return shiftLeftDigits(
+        digitsFromStorage<Limb, DV::limb_count>(u.significand),
+        1 + (scale & 3));
+  };
+  DV fa = ua.category == ValueCategory::Zero ? DV{} : hex(ua, ca);
+  DV fb = ub.category == ValueCategory::Zero ? DV{} : hex(ub, cb);
+  if (ua.category == ValueCategory::Zero) {
+    ca = cb;
+    ua.sign = ub.sign;
+  } else if (ub.category == ValueCategory::Zero) {
+    cb = ca;
+  }
+
+  // Order so a carries the larger magnitude, then align b, keeping
+  // the guard digit and dropping what falls below it.
+  if (ca < cb || (ca == cb && compareDigits(fa, fb) < 0)) {
+    const DV tf = fa;
+    fa = fb;
+    fb = tf;
+    const int tc = ca;
+    ca = cb;
+    cb = tc;
+    const bool ts = ua.sign;
+    ua.sign = ub.sign;
+    ub.sign = ts;
+  }
+  const int d = 4 * (ca - cb);
+  flags_t flags = anyBitsBelow(fb, d) ? FlagInexact : FlagNone;
+  fb = shiftRightDigits(fb, d);
+
+  DV sum;
+  if (ua.sign == ub.sign) {
+    sum = addDigits(fa, fb);
+  } else {
+    sum = subDigits(fa, fb);
+    if (isZero(sum))
+      return deliver<T, Op>(hexWord<T>(false, 0, 0), FlagNone);
+  }
+
+  // sum · 16^(ca − 64 − (F + 1)), in roundAndPack's terms.
+  const int result_exp = 4 * (ca - Num::characteristic_bias - (F + 1)) +
+                         Num::exponent_bias + (SigBits - 1) + GuardBits;
+  auto bits = roundAndPack<T>(ua.sign, result_exp, sum, flags);
+  return deliver<T, Op>(bits, flags);
+}
+
+// -----------------------------------------------------------------
+// HFP ↔ IEEE binary word conversion
+// -----------------------------------------------------------------
+template <typename T>
+inline constexpr bool is_word_hex_float =
+    is_hex_float<typename T::number> && T::layout::total_bits <= 64;
+
+template <typename T> inline constexpr bool is_word_ieee_binary = false;
+template <int E, int M, typename R, typename X, typename P, typename C>
+  requires(1 + E + M <= 64)
+inline constexpr bool
+    is_word_ieee_binary<Type<numbers::IEEE754<E, M>, layouts::IEEE<E, M, true>,
+                             R, X, P, C>> = true;
+
+// The pairs convert routes through hexToBinary / binaryToHex.
+template <typename Src, typename Dst>
+inline constexpr bool hex_binary_pair =
+    (is_word_hex_float<Src> && is_word_ieee_binary<Dst>) ||
+    (is_word_ieee_binary<Src> && is_word_hex_float<Dst>);
+
+// x >> k, and whether the bits it drops hold a 1 at k − 1 (guard)
+// or below (sticky); k may reach or pass 64.
+struct WordShift {
+  std::uint64_t kept;
+  bool guard;
+  bool sticky;
+};
+constexpr WordShift shiftRightGuarded(std::uint64_t x, int k) {
+  if (k <= 0)
+    return {x << -k, false, false};
+  if (k > 64)
+    return {0, false, x != 0};
+  const std::uint64_t below = k == 64 ? x : x & ((std::uint64_t{1} << k) - 1);
+  const std::uint64_t half = std::uint64_t{1} << (k - 1);
+  return {k == 64 ? 0 : x >> k, (below & half) != 0, (below & (half - 1)) != 0};
+}
+
+template <typename Dst, typename Src>
+constexpr auto hexToBinary(typename Src::storage_type bits) {
+  using Rnd = typename Dst::rounding;
+  using DstStorage = typename Dst::storage_type;
+  constexpr int FracBits = Src::number::significand::digit_count;
+  constexpr int M = Dst::layout::sig_bits;
+  constexpr int E = Dst::layout::exp_bits;
+  constexpr int Bias = Dst::number::exponent_bias;
+  constexpr int MaxExp = (1 << E) - 2;
+
+  const std::uint64_t x = std::uint64_t(bits);
+  const bool sign = ((x >> Src::layout::sign_offset) & 1) != 0;
+  const std::uint64_t sign_bit = std::uint64_t(sign) << (E + M);
+  const std::uint64_t f = x & ((std::uint64_t{1} << FracBits) - 1);
+  if (f == 0)
+    return deliver<Dst, Operation::Convert>(DstStorage(sign_bit), FlagNone);
+
+  const int characteristic = int((x >> FracBits) & 0x7F);
+  const int top = std::bit_width(f) - 1;
+  const int e = 4 * (characteristic - 64) - FracBits + top + Bias;
+
+  // Tininess after rounding, as though the exponent were unbounded.
+  const WordShift full = shiftRightGuarded(f, top - M);
+  flags_t flags = FlagNone;
+  bool tiny = false;
+  if (e < 1) {
+    const bool carries =
+        shouldRoundUp<Rnd>((full.kept & 1) != 0, full.guard, false,
+                           full.sticky, sign) &&
+        full.kept + 1 == std::uint64_t{1} << (M + 1);
+    tiny = e + int(carries) < 1;
+  }
+
+  // The normal binade puts the leading bit at M; a subnormal sits
+  // 1 − e further down, at exponent 0.
+  const WordShift s = e < 1 ? shiftRightGuarded(f, top - M + 1 - e) : full;
+  int exp = e < 1 ? 0 : e;
+  std::uint64_t sig = s.kept;
+  if (s.guard || s.sticky)
+    flags |= FlagInexact;
+  if (shouldRoundUp<Rnd>((sig & 1) != 0, s.guard, false, s.sticky, sign)) {
+    sig += 1;
+    if (sig == std::uint64_t{1} << (M + 1)) {
+      sig >>= 1;
+      exp += 1;
+    } else if (exp == 0 && (sig >> M) != 0) {
+      exp = 1;
+    }
+  }
+
+  if (exp > MaxExp) {
+    flags |= FlagOverflow | FlagInexact;
+    const std::uint64_t inf = std::uint64_t(MaxExp + 1) << M;
+    return deliver<Dst, Operation::Convert>(
+        DstStorage(sign_bit | (overflowRoundsToInf<Rnd>(sign) ? inf : inf - 1)),
+        flags);
+  }
+  if (tiny && (flags & FlagInexact))
+    flags |= FlagUnderflow;
+  const std::uint64_t out = sign_bit | (std::uint64_t(exp) << M) |
+                            (sig & ((std::uint64_t{1} << M) - 1));
+  return deliver<Dst, Operation::Convert>(DstStorage(out), flags);
+}
+
+template <typename Dst, typename Src>
+constexpr auto binaryToHex(typename Src::storage_type bits) {
+  using Rnd = typename Dst::rounding;
+  using DstStorage = typename Dst::storage_type;
+  constexpr int FracBits = Dst::number::significand::digit_count;
+  constexpr int M = Src::layout::sig_bits;
+  constexpr int E = Src::layout::exp_bits;
+  constexpr int Bias = Src::number::exponent_bias;
+  constexpr std::uint64_t ExpMax = (std::uint64_t{1} << E) - 1;
+  constexpr DstStorage MaxFraction = (DstStorage(1) << FracBits) - 1;
+
+  const std::uint64_t x = std::uint64_t(bits);
+  const bool sign = ((x >> (E + M)) & 1) != 0;
+  const std::uint64_t be = (x >> M) & ExpMax;
+  std::uint64_t sig = x & ((std::uint64_t{1} << M) - 1);
+
+  if (be == ExpMax) {
+    if (sig != 0)
+      return deliver<Dst, Operation::Convert>(DstStorage(0), FlagInvalid);
+    return deliver<Dst, Operation::Convert>(
+        hexWord<Dst>(sign, 127, MaxFraction),
+        flags_t(FlagOverflow | FlagInexact));
+  }
+  if (be == 0 && sig == 0)
+    return deliver<Dst, Operation::Convert>(hexWord<Dst>(sign, 0, 0),
+                                            FlagNone);
+
+  int top = M, scale = int(be) - Bias;
+  if (be == 0) {
+    top = std::bit_width(sig) - 1;
+    scale = 1 - Bias - M + top;
+  } else {
+    sig |= std::uint64_t{1} << M;
+  }
+  int characteristic = (scale >> 2) + 65;
+  const WordShift s = shiftRightGuarded(sig, top - (FracBits - 4 + (scale & 3)));
+  std::uint64_t f = s.kept;
+  flags_t flags = (s.guard || s.sticky) ? FlagInexact : FlagNone;
+  if (shouldRoundUp<Rnd>((f & 1) != 0, s.guard, false, s.sticky, sign)) {
+    f += 1;
+    if (f >> FracBits) {
+      f >>= 4;
+      characteristic += 1;
+    }
+  }
+
+  if (characteristic > 127) {
+    flags |= FlagOverflow | FlagInexact;
+    return deliver<Dst, Operation::Convert>(
+        hexWord<Dst>(sign, 127, MaxFraction), flags);
+  }
+  if (characteristic < 0) {
+    flags |= FlagUnderflow | FlagInexact;
+    return deliver<Dst, Operation::Convert>(hexWord<Dst>(false, 0, 0), flags);
+  }
+  return deliver<Dst, Operation::Convert>(
+      hexWord<Dst>(sign, characteristic, DstStorage(f)), flags);
+}
+
+} // namespace detail
+
+// -----------------------------------------------------------------
+// add / sub
+// -----------------------------------------------------------------
+// These take over from add.hpp's by constraint, so add<hfp32> reads
+// as it does for every other Type.
+template <typename T>
+  requires detail::is_hex_float<typename T::number>
+constexpr auto add(typename T::storage_type a, typename T::storage_type b) {
+  return detail::addHexFloat<T, Operation::Add>(a, b);
+}
+
+template <typename T>
+  requires detail::is_hex_float<typename T::number>
+constexpr auto sub(typename T::storage_type a, typename T::storage_type b) {
+  return detail::addHexFloat<T, Operation::Sub>(a, b);
+}
+
+} // namespace opine
+
+#endif // OPINE_CORE_HFP_HPP
@@ -0,0 +1,293 @@
+#ifndef OPINE_CORE_INTEGER_HPP
+#define OPINE_CORE_INTEGER_HPP
+
+// Integer conversion (IEEE 754 §5.4.1 convertFromInt, §5.8
+// convertToIntegerExact) for every integer type up to 128 bits,
+// signed or unsigned, __int128 included.
+//
+//   fromInt<T>(i)                   — i rounded to T per T's Rounding
+//                                     axis; flags through T's
+//                                     Exceptions axis.
+//   toInt<Int, T>(x)                — x rounded to an integer per T's
+//                                     Rounding axis (or an explicit
+//                                     Rnd: toInt<int32_t, T,
+//                                     rounding::TowardZero> is C's
+//                                     cast); flags as for fromInt.
+//   toIntSaturating<Int, T>(x)      — the same value, no flags.
+//
+// fromInt is the identity kernel again: the integer's magnitude is
+// a significand whose leading bit is its exponent, handed to
+// roundAndPack like a conversion's. Overflow (int64 → fp8), inexact
+// and the Inf-or-saturate choice therefore behave as convert's. An
+// integer zero is +0. Pairs where every integer fits T exactly
+// (int8 → bfloat16, int16 → float32, int32 → float64) pack the
+// fields directly, as convert's exact pairs do.
+//
+// toInt rounds the value to an integer and raises Inexact when that
+// changed it — convertToIntegerExact; the inexact-silent §5.8 forms
+// are toIntSaturating. A value outside Int's range, an infinity or
+// a NaN raises Invalid and gives the saturated result: Int's
+// nearest extreme, and 0 for NaN (the ARM and Rust convention; IEEE
+// leaves the value to the implementation). A negative value that
+// rounds to 0 is 0 for every Int, unsigned ones included.
+//
+// An integer result has no T pattern for a trap handler or an
+// Alternate substitute to act on: toInt's flags are counted, handed
+// back (ReturnStatus: IntWithStatus<Int>), scoped or accumulated as
+// T's axis says, and enabled traps fall back to the status flags,
+// as raiseTrap does for a flag with no handler.
+//
+// Decimal Types take the same three through decimal.hpp's
+// overloads, on the coefficient and quantum.
+//
+// Batch forms (fromIntMany, toIntMany, toIntSaturatingMany) live in
+// batch.hpp with the other *Many operations.
+
+#include <algorithm>
+#include <cstdint>
+#include <type_traits>
+
+#include "opine/core/arith_detail.hpp"
+#include "opine/core/bits.hpp"
+#include "opine/core/convert.hpp"
+#include "opine/core/pack_unpack.hpp"
+#include "opine/core/round_pack.hpp"
+#include "opine/core/type.hpp"
+
+namespace opine {
+
+// An integer result with the flags its conversion raised.
+template <typename Int> struct IntWithStatus {
+  Int value;
+  flags_t flags;
+};
+
+namespace detail {
+
+// __int128 is integral to the compiler in every mode, but to
+// std::is_integral only outside strict ISO mode.
+template <typename I> inline constexpr bool is_int128 = false;
+#if defined(__SIZEOF_INT128__)
+template <> inline constexpr bool is_int128<__int128> = true;
+template <> inline constexpr bool is_int128<unsigned __int128> = true;
+#endif
+
+template <typename I>
+concept IntegerValue =
+    (std::is_integral_v<I> && !std::is_same_v<I, bool>) || is_int128<I>;
+
+template <typename I> inline constexpr int int_bits = int(sizeof(I)) * 8;
+template <typename I> inline constexpr bool int_signed = I(-1) < I(0);
+
+// The unsigned word holding an Int's magnitude (|min| included).
+template <typename I> using IntMagnitude = bits_t<int_bits<I>>;
+
+// Every Int value is exactly a finite T with a normal significand,
+// and T packs it by fields (the field_copy_conversion conditions):
+// the magnitude's digits fit the significand and its top bit fits
+// the exponent range.
+template <typename T, typename Int>
+inline constexpr bool exact_from_int =
+    int_bits<Int> - int_signed<Int> <= T::number::significand::digit_count &&
+    int_bits<Int> - 1 <= max_unbiased_exp<T> &&
+    T::number::exponent_bias >= 1 && !is_posit<typename T::number> &&
+    !is_digit_vector<typename T::storage_type> && T::layout::implicit_digit &&
+    T::number::inf_encoding != InfEncoding::IntegerExtremes;
+
+// Int's extreme on the value's side; 0 for NaN.
+template <typename Int> constexpr Int saturatedInt(bool negative) {
+  using U = IntMagnitude<Int>;
+  constexpr int N = int_bits<Int>;
+  if constexpr (int_signed<Int>)
+    return negative ? Int(U(U{1} << (N - 1)))
+                    : Int(U((U{1} << (N - 1)) - U{1}));
+  else
+    return negative ? Int(0) : Int(U(~U{0}));
+}
+
+// The working word for toInt: the significand and any in-range
+// integer fit it.
+template <typename T, typename Int>
+using IntWorkingWord = std::conditional_t<
+    is_digit_vector<typename T::storage_type>,
+    DigitVector<std::uint64_t,
+                (std::max(T::number::significand::digit_count,
+                          int_bits<Int>) +
+                 63) /
+                    64>,
+    bits_t<(std::max(T::number::significand::digit_count, int_bits<Int>) <=
+                    64
+                ? 64
+                : 128)>>;
+
+// x rounded to an integer per Rnd, saturated, with its §5.8 flags.
+template <typename Int, typename T, typename Rnd>
+constexpr IntWithStatus<Int> roundToInt(typename T::storage_type bits) {
+  using U = IntMagnitude<Int>;
+  using W = IntWorkingWord<T, Int>;
+  constexpr int N = int_bits<Int>;
+  constexpr int SigBits = T::number::significand::digit_count;
+  constexpr int WBits = [] {
+    if constexpr (is_digit_vector<W>)
+      return W::total_bits;
+    else
+      return int(sizeof(W)) * 8;
+  }();
+
+  const auto u = unpackOperand<T>(bits);
+  if (u.category == ValueCategory::NaN)
+    return {Int(0), FlagInvalid};
+  if (u.category == ValueCategory::Infinity)
+    return {saturatedInt<Int>(u.sign), FlagInvalid};
+  if (u.category == ValueCategory::Zero)
+    return {Int(0), FlagNone};
+
+  W m;
+  if constexpr (is_digit_vector<W>)
+    m = digitsFromStorage<typename W::limb_type, W::limb_count>(
+        u.significand);
+  else
+    m = W(u.significand);
+
+  // Weight of the significand's bit 0, and of its leading bit.
+  const int e = (u.biased_exp == 0) ? 1 : u.biased_exp;
+  const int lsb = (e - T::number::exponent_bias) - (SigBits - 1);
+  if (wordTopBit(m) + lsb >= N) // |x| ≥ 2^N: no rounding brings it in
+    return {saturatedInt<Int>(u.sign), FlagInvalid};
+
+  bool up = false, inexact = false;
+  if (lsb >= 0) {
+    m = shiftWordLeft(m, lsb);
+  } else {
+    const int k = -lsb;
+    const bool guard = k <= WBits && testWordBit(m, k - 1);
+    const bool sticky =
+        !isZeroWord(andWords(m, wordOnes<W>(std::min(k - 1, WBits))));
+    m = shiftWordRight(m, k);
+    inexact = guard || sticky;
+    up = shouldRoundUp<Rnd>(testWordBit(m, 0), guard, sticky, false, u.sign);
+  }
+
+  U mag;
+  if constexpr (is_digit_vector<W>)
+    mag = storageFromDigits<U>(m);
+  else
+    mag = U(m);
+  if (up) {
+    mag = U(mag + U{1});
+    if (mag == U{0}) // carried out of N bits
+      return {saturatedInt<Int>(u.sign), FlagInvalid};
+  }
+
+  const flags_t flags = inexact ? FlagInexact : FlagNone;
+  if (mag == U{0})
+    return {Int(0), flags};
+  if constexpr (int_signed<Int>) {
+    constexpr U Max = U((U{1} << (N - 1)) - U{1});
+    if (mag > U(Max + U(u.sign)))
+      return {saturatedInt<Int>(u.sign), FlagInvalid};
+    return {u.sign ? Int(U(U{0} - mag)) : Int(mag), flags};
+  } else {
+    if (u.sign)
+      return {Int(0), FlagInvalid};
+    return {Int(mag), flags};
+  }
+}
+
+// deliver for an integer result; see the header comment.
+template <typename T, typename Int, typename E = typename T::exceptions>
+constexpr auto deliverInt(Int value, flags_t flags) {
+  if constexpr (isCounting<E>) {
+    if (!std::is_constant_evaluated())
+      OperationCounter<T>::record(Operation::Convert, flags);
+    return deliverInt<T, Int, typename E::inner>(value, flags);
+  } else if constexpr (std::is_same_v<E, exceptions::ReturnStatus>) {
+    return IntWithStatus<Int>{value, flags};
+  } else if constexpr (std::is_same_v<E, exceptions::Scoped>) {
+    if (!std::is_constant_evaluated())
+      scopedFlags() |= flags;
+    return value;
+  } else {
+    if constexpr (E::has_traps) {
+      if ((flags & E::enabled) != 0 && !std::is_constant_evaluated())
+        statusFlags() |= flags;
+    } else if constexpr (E::has_status_flags) {
+      if (!std::is_constant_evaluated())
+        statusFlags() |= flags;
+    }
+    return value;
+  }
+}
+
+} // namespace detail
+
+// -----------------------------------------------------------------
+// fromInt
+// -----------------------------------------------------------------
+template <typename T, typename Int>
+  requires(detail::IntegerValue<Int> &&
+           !detail::is_decimal<typename T::number>)
+constexpr auto fromInt(Int v) {
+  using U = detail::IntMagnitude<Int>;
+  using Storage = typename T::storage_type;
+  constexpr int N = detail::int_bits<Int>;
+  constexpr int SigBits = T::number::significand::digit_count;
+  constexpr int Bias = T::number::exponent_bias;
+
+  bool neg = false;
+  if constexpr (detail::int_signed<Int>)
+    neg = v < Int(0);
+  const U mag = neg ? U(U{0} - U(v)) : U(v);
+  if (mag == U{0})
+    return detail::deliver<T, Operation::Convert>(
+        detail::packSpecial<T>(ValueCategory::Zero, false), FlagNone);
+
+  const int top = detail::wordTopBit(mag);
+  if constexpr (detail::exact_from_int<T, Int>) {
+    const UnpackedFloat<Storage> u{
+        ValueCategory::Finite, neg, top + Bias,
+        detail::shiftWordLeft(Storage(mag), SigBits - 1 - top)};
+    return detail::deliver<T, Operation::Convert>(pack<T>(u), FlagNone);
+  } else {
+    // As convertRounded: the magnitude is a significand with its
+    // leading bit at weight 2^top.
+    constexpr int GBits = detail::GuardBits;
+    constexpr int NeedBits = (N > SigBits + GBits ? N : SigBits + GBits) + 1;
+    using DV = detail::WorkingDigits<T, NeedBits>;
+
+    DV m = detail::digitsFromStorage<typename DV::limb_type, DV::limb_count>(
+        mag);
+    const int target_msb = SigBits + GBits - 1;
+    if (top > target_msb)
+      m = detail::shiftRightStickyDigits(m, top - target_msb);
+    else if (top < target_msb)
+      m = detail::shiftLeftDigits(m, target_msb - top);
+
+    flags_t flags = FlagNone;
+    auto out = detail::roundAndPack<T>(neg, top + Bias, m, flags);
+    return detail::deliver<T, Operation::Convert>(out, flags);
+  }
+}
+
+// -----------------------------------------------------------------
+// toInt / toIntSaturating
+// -----------------------------------------------------------------
+// Destination first, as convert: toInt<int8_t, fp8_e4m3>(x).
+template <typename Int, typename T, typename Rnd = typename T::rounding>
+  requires(detail::IntegerValue<Int> &&
+           !detail::is_decimal<typename T::number>)
+constexpr auto toInt(typename T::storage_type bits) {
+  const IntWithStatus<Int> r = detail::roundToInt<Int, T, Rnd>(bits);
+  return detail::deliverInt<T, Int>(r.value, r.flags);
+}
+
+template <typename Int, typename T, typename Rnd = typename T::rounding>
+  requires(detail::IntegerValue<Int> &&
+           !detail::is_decimal<typename T::number>)
+constexpr Int toIntSaturating(typename T::storage_type bits) {
+  return detail::roundToInt<Int, T, Rnd>(bits).value;
+}
+
+} // namespace opine
+
+#endif // OPINE_CORE_INTEGER_HPP
@@ -14,9 +14,31 @@
 // Number: the significand *has* M+1 semantic digits (Number); the
 // Layout *stores* M of them and hides the leading digit (Layout).
 //
+// PositLayout is the one dynamic-boundary Layout: the regime scan
+// (a count of leading ones or zeros) places the exponent and
+// fraction fields per value. Its codec lives with the others in
+// pack_unpack.hpp.
+//
+// BIDLayout is IEEE 754's binary-integer decimal encoding: the
+// exponent and the coefficient's top bits share a combination
+// field, so where each begins depends on the value. DPDLayout is
+// the densely-packed-decimal one: a five-bit combination field
+// holds the exponent's top two bits and the leading digit, and
+// every further three digits pack into a ten-bit declet. Both
+// codecs are in pack_unpack.hpp beside the posit one.
+//
+// HexFloatLayout is IBM HFP's: fixed [S][characteristic][fraction]
+// fields, except that the 128-bit extended format is two long-format
+// words, the low one carrying its own copy of the sign and a
+// characteristic 14 below the high one's.
+//
+// FixedPointLayout is the whole word as one two's-complement (or
+// unsigned) integer; where the radix point sits is the Number's.
+//
 // Not implemented in this slice:
-//   - Packing codecs other than direct (DPD, BID).
-//   - Dynamic field boundaries (posits, Type I Unums).
+//   - Packing codecs other than direct, BID, DPD, HFP and fixed
+//     point.
+//   - Other dynamic field boundaries (Type I Unums).
 //   - Variable total_size (strings, Burroughs decimal).
 //   - Byte order other than the storage_type's native order.
 
@@ -75,6 +97,143 @@ struct Layout {
                 "significand field must fit in storage word");
 };
 
+// -----------------------------------------------------------------
+// PositLayout — regime-scanned fields in a TotalBits word
+// -----------------------------------------------------------------
+// [S][regime: run + terminator][E: up to ExpBits][fraction], with
+// negative values the two's complement of the whole word. Only the
+// word width and the supplement width are fixed; the fraction's
+// leading 1 is never stored, hence implicit_digit.
+template <int TotalBits, int ExpBits> struct PositLayout {
+  static constexpr int total_bits = TotalBits;
+  static constexpr int exp_supplement_bits = ExpBits;
+  static constexpr bool implicit_digit = true;
+
+  static_assert(TotalBits >= ExpBits + 3,
+                "a posit word needs a sign, a two-bit regime and the "
+                "exponent supplement");
+};
+
+namespace detail {
+template <typename L> inline constexpr bool is_posit_layout = false;
+template <int TotalBits, int ExpBits>
+inline constexpr bool is_posit_layout<PositLayout<TotalBits, ExpBits>> = true;
+} // namespace detail
+
+// -----------------------------------------------------------------
+// BIDLayout — IEEE 754 decimal, binary-integer coefficient
+// -----------------------------------------------------------------
+// [S][combination: ExpBits + 3][trailing coefficient], MSB to LSB.
+// The combination field's top two bits pick the form:
+//   not 11: [exponent: ExpBits][coefficient bits t+2 … t] above the
+//           trailing field — a coefficient below 2^(t+3);
+//   11, then not 11: [exponent: ExpBits][coefficient bit t] with an
+//           implicit 100 prefix — 2^(t+3) ≤ coefficient < 2^(t+4);
+//   11 11:  the next bit tells infinity (0) from NaN (1).
+// t is trailing_bits. Only the sign sits at a fixed position.
+template <int TotalBits, int ExpBits> struct BIDLayout {
+  static constexpr int total_bits = TotalBits;
+  static constexpr int sign_bits = 1;
+  static constexpr int sign_offset = TotalBits - 1;
+  static constexpr int exp_bits = ExpBits;
+  static constexpr int combination_bits = ExpBits + 3;
+  static constexpr int trailing_bits = TotalBits - 1 - combination_bits;
+
+  static_assert(trailing_bits >= 1,
+                "a BID word needs a trailing coefficient field");
+};
+
+namespace detail {
+template <typename L> inline constexpr bool is_bid_layout = false;
+template <int TotalBits, int ExpBits>
+inline constexpr bool is_bid_layout<BIDLayout<TotalBits, ExpBits>> = true;
+} // namespace detail
+
+// -----------------------------------------------------------------
+// DPDLayout — IEEE 754 decimal, densely packed coefficient
+// -----------------------------------------------------------------
+// [S][combination: 5][exponent continuation: ExpBits − 2][declets],
+// MSB to LSB. The combination field G0…G4 holds:
+//   not 11…: exponent bits G0 G1, leading digit G2 G3 G4 (0–7);
+//   11, then not 11: exponent bits G2 G3, leading digit 8 + G4;
+//   11 11:   the next bit tells infinity (0) from NaN (1).
+// The trailing field is trailing_bits / 10 declets, least
+// significant three digits lowest.
+template <int TotalBits, int ExpBits> struct DPDLayout {
+  static constexpr int total_bits = TotalBits;
+  static constexpr int sign_bits = 1;
+  static constexpr int sign_offset = TotalBits - 1;
+  static constexpr int exp_bits = ExpBits;
+  static constexpr int combination_bits = 5;
+  static constexpr int exp_continuation_bits = ExpBits - 2;
+  static constexpr int trailing_bits =
+      TotalBits - 1 - combination_bits - exp_continuation_bits;
+  static constexpr int declets = trailing_bits / 10;
+
+  static_assert(trailing_bits % 10 == 0 && declets >= 1,
+                "a DPD word's trailing field is whole declets");
+};
+
+namespace detail {
+template <typename L> inline constexpr bool is_dpd_layout = false;
+template <int TotalBits, int ExpBits>
+inline constexpr bool is_dpd_layout<DPDLayout<TotalBits, ExpBits>> = true;
+} // namespace detail
+
+// -----------------------------------------------------------------
+// HexFloatLayout — IBM hexadecimal floating point
+// -----------------------------------------------------------------
+// [S][characteristic: 7][fraction], MSB to LSB, in a 32-bit (short)
+// or 64-bit (long) word. The 128-bit extended format is two long
+// words: the high one holds the sign, the characteristic and the
+// fraction's top 14 digits; the low one the next 14 digits under a
+// sign and characteristic of its own, which the architecture sets
+// to the high word's sign and characteristic − 14 (mod 128) and
+// ignores on input. Every fraction digit is stored: implicit_digit
+// is false.
+template <int TotalBits> struct HexFloatLayout {
+  static constexpr int total_bits = TotalBits;
+  static constexpr int sign_bits = 1;
+  static constexpr int sign_offset = TotalBits - 1;
+  static constexpr int exp_bits = 7;
+  static constexpr int exp_offset = TotalBits - 8;
+  static constexpr bool split = TotalBits == 128;
+  static constexpr int fraction_digits = split ? 28 : (TotalBits - 8) / 4;
+  static constexpr bool implicit_digit = false;
+
+  static_assert(TotalBits == 32 || TotalBits == 64 || TotalBits == 128,
+                "HFP words are short (32), long (64) or extended (128)");
+};
+
+namespace detail {
+template <typename L> inline constexpr bool is_hex_float_layout = false;
+template <int TotalBits>
+inline constexpr bool is_hex_float_layout<HexFloatLayout<TotalBits>> = true;
+} // namespace detail
+
+// -----------------------------------------------------------------
+// FixedPointLayout — a fixed-point word
+// -----------------------------------------------------------------
+// TotalBits of integer, LSB at bit 0, no fields. A signed word's
+// sign is its MSB, as for the complemented layouts below.
+template <int TotalBits> struct FixedPointLayout {
+  static constexpr int total_bits = TotalBits;
+  static constexpr int sign_bits = 0;
+  static constexpr int sig_bits = TotalBits;
+  static constexpr int sig_offset = 0;
+  static constexpr bool implicit_digit = false;
+
+  static_assert(TotalBits >= 1 && TotalBits <= 64,
+                "fixed-point words are 1 to 64 bits");
+};
+
+namespace detail {
+template <typename L> inline constexpr bool is_fixed_point_layout = false;
+template <int TotalBits>
+inline constexpr bool is_fixed_point_layout<FixedPointLayout<TotalBits>> =
+    true;
+} // namespace detail
+
 // -----------------------------------------------------------------
 // Predefined Layout bundles
 // -----------------------------------------------------------------
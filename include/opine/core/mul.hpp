@@ -26,6 +26,8 @@
 // There is no width ceiling: the working geometry is however many
 // limbs the exact product needs (float128's 226-bit product is
 // eight 32-bit limbs on the default platform).
+//
+// Fixed-point words take fixed_point.hpp's integer overload instead.
 
 #include "opine/core/arith_detail.hpp"
 #include "opine/core/digits.hpp"
@@ -37,6 +39,8 @@ namespace opine {
 // mul
 // -----------------------------------------------------------------
 template <typename T>
+  requires(!detail::is_decimal<typename T::number> &&
+           !detail::is_fixed_point<typename T::number>)
 constexpr auto mul(typename T::storage_type a, typename T::storage_type b) {
   using Num = typename T::number;
   using Storage = typename T::storage_type;
@@ -64,22 +68,23 @@ constexpr auto mul(typename T::storage_type a, typename T::storage_type b) {
   // ---------- Special value dispatch ----------
 
   if (ua.category == ValueCategory::NaN || ub.category == ValueCategory::NaN)
-    return detail::deliver<T>(detail::packSpecial<T>(ValueCategory::NaN, false),
-                              FlagNone);
+    return detail::deliver<T, Operation::Mul>(
+        detail::packSpecial<T>(ValueCategory::NaN, false), FlagNone);
 
   if (ua.category == ValueCategory::Infinity ||
       ub.category == ValueCategory::Infinity) {
     if (ua.category == ValueCategory::Zero ||
         ub.category == ValueCategory::Zero)
       // Inf × 0 = NaN: invalid operation (§7.2).
-      return detail::deliver<T>(
-          detail::packSpecial<T>(ValueCategory::NaN, false), FlagInvalid);
-    return detail::deliver<T>(
+      return detail::deliver<T, Operation::Mul>(
+          detail::packSpecial<T>(ValueCategory::NaN, false), FlagInvalid,
+          detail::xorSign(result_sign));
+    return detail::deliver<T, Operation::Mul>(
         detail::packSpecial<T>(ValueCategory::Infinity, result_sign), FlagNone);
   }
 
   if (ua.category == ValueCategory::Zero || ub.category == ValueCategory::Zero)
-    return detail::deliver<T>(
+    return detail::deliver<T, Operation::Mul>(
         detail::packSpecial<T>(ValueCategory::Zero, result_sign), FlagNone);
 
   // ---------- Finite × Finite ----------
@@ -114,7 +119,8 @@ constexpr auto mul(typename T::storage_type a, typename T::storage_type b) {
 
   flags_t flags = FlagNone;
   auto bits = detail::roundAndPack<T>(result_sign, result_exp, magnitude, flags);
-  return detail::deliver<T>(bits, flags);
+  return detail::deliver<T, Operation::Mul>(bits, flags,
+                                            detail::xorSign(result_sign));
 }
 
 } // namespace opine
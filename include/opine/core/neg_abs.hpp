@@ -17,6 +17,11 @@
 //                        complement. Neg is the whole-word negate.
 //                        Abs is a conditional negate (if MSB set).
 //   DiminishedRadixComplement — same idea with one's complement.
+//   Unsigned           — no sign to rewrite: both are the identity.
+//
+// A two's complement fixed-point word negates like the integer it
+// is: the most negative word, which has no positive counterpart, is
+// its own negation.
 //
 // nan_encoding short-circuit:
 //
@@ -126,6 +131,9 @@ constexpr typename T::storage_type copySign(typename T::storage_type x,
   using Storage = typename T::storage_type;
   constexpr int TotalBits = Fmt::total_bits;
 
+  if constexpr (Num::value_sign == SignMethod::Unsigned)
+    return x;
+
   const bool want = [&] {
     if constexpr (Num::value_sign == SignMethod::Explicit)
       return detail::testWordBit(y, Fmt::sign_offset);
@@ -9,6 +9,15 @@
 //   Primitive:      radix, digit_width, digit_count, sign_method.
 //   FloatingPoint:  significand + exponent, plus exponent_base,
 //                   exponent_bias, value_sign, and special_values.
+//   Posit:          a FloatingPoint whose exponent/fraction boundary
+//                   is value-dependent (the regime).
+//   Decimal:        a FloatingPoint of radix-10 significand and
+//                   exponent base 10 (IEEE 754 decimal32/64/128),
+//                   computed by decimal.hpp's own pipeline.
+//   HexFloat:       a FloatingPoint of exponent base 16 (IBM
+//                   System/360 HFP), normalized by whole hex digits.
+//   FixedPoint:     a binary integer with an implied radix point
+//                   (Qm.n), wrapping or saturating on overflow.
 //
 // Sub-Numbers of a composite carry their own radix, digit_width,
 // and sign_method — that's what lets TI-89 (BCD significand, binary
@@ -16,10 +25,12 @@
 // thousand's-complement exponent sign) be expressed at all.
 //
 // Not implemented in this slice:
-//   - FixedPoint, SharedExponent, Codebook composites.
-//   - Non-binary arithmetic (radix != 2 in the compute pipeline).
+//   - SharedExponent, Codebook composites.
+//   - Non-binary arithmetic other than IEEE decimal and IBM hex
+//     (radix != 2 in the shared compute pipeline).
 //   - Variable digit_count.
 
+#include <bit>
 #include <concepts>
 
 namespace opine {
@@ -55,6 +66,12 @@ enum class InfEncoding {
   None,             // No infinity
 };
 
+// What a FixedPoint result outside the representable range becomes.
+enum class OverflowMode {
+  Wrap,     // The low bits: two's-complement (or modular) arithmetic.
+  Saturate, // The nearest extreme.
+};
+
 enum class DenormalMode {
   Full,        // Gradual underflow (IEEE 754)
   FlushToZero, // Output flushing: denormal results → 0
@@ -149,6 +166,176 @@ struct FloatingPoint {
                 "two's-complement value_sign has no negative zero");
 };
 
+// -----------------------------------------------------------------
+// Posit — tapered floating point (Gustafson)
+// -----------------------------------------------------------------
+// TotalDigits bits, two's complement over the whole word, a unary
+// regime run, up to ExponentDigits exponent-supplement bits, and a
+// fraction taking whatever is left. The value's scale is
+// regime·2^ExponentDigits + supplement; zero is all-zeros, NaR
+// (Not-a-Real) the sign bit alone — rbj's trap value — and there is
+// no infinity, negative zero, or subnormal range.
+//
+// The semantic widths are the value-independent envelope the
+// pipeline sizes its working digits by:
+//   significand — the most digits any value carries (the shortest
+//                 regime, two bits, leaves TotalDigits − 3 −
+//                 ExponentDigits fraction bits below the hidden 1);
+//   exponent    — the scale, regime and supplement together, as a
+//                 biased binary integer.
+// The bias puts the smallest scale (minpos) at biased exponent 1,
+// so no posit value unpacks into the subnormal convention.
+template <int TotalDigits, int ExponentDigits> struct Posit {
+  static constexpr int total_digits = TotalDigits;
+  static constexpr int exponent_digits = ExponentDigits;
+  static constexpr int max_scale = (TotalDigits - 2) << ExponentDigits;
+
+  using significand = Binary<TotalDigits - ExponentDigits - 2>;
+  using exponent = Binary<std::bit_width(unsigned(2 * max_scale + 1))>;
+
+  static constexpr int exponent_base = 2;
+  static constexpr int exponent_bias = max_scale + 1;
+  static constexpr SignMethod value_sign = SignMethod::RadixComplement;
+  static constexpr bool is_composite = true;
+
+  static constexpr NegativeZero negative_zero = NegativeZero::DoesNotExist;
+  static constexpr NanEncoding nan_encoding = NanEncoding::TrapValue;
+  static constexpr InfEncoding inf_encoding = InfEncoding::None;
+  static constexpr DenormalMode denormal_mode = DenormalMode::None;
+
+  static_assert(ExponentDigits >= 0 && ExponentDigits <= 4,
+                "posit exponent supplement is 0 to 4 bits");
+  static_assert(TotalDigits >= ExponentDigits + 3 && TotalDigits <= 64,
+                "posit width must leave a regime and fit 64 bits");
+};
+
+// -----------------------------------------------------------------
+// HexFloat — IBM hexadecimal floating point (System/360 HFP)
+// -----------------------------------------------------------------
+// A sign, a 7-bit excess-64 characteristic and a fraction of
+// FractionDigits hex digits: value = 0.F × 16^(characteristic − 64).
+// Normalized means a nonzero leading hex DIGIT, so the leading bit
+// wobbles through the top four bit positions and the precision with
+// it (a 6-digit fraction carries 21 to 24 significant bits). There
+// is no NaN, infinity or hidden digit; a zero fraction is zero at
+// any characteristic, and −0 exists.
+//
+// As with Posit, the semantic widths are the binary envelope the
+// pipeline unpacks into:
+//   significand — 4·FractionDigits bits, the most any value carries;
+//   exponent    — the binary scale of the leading bit, biased.
+// exponent_base records the format's own base, 16. The bias puts
+// the smallest scale (one low fraction bit at characteristic 0) at
+// biased exponent 1, so no value unpacks into the subnormal
+// convention.
+template <int FractionDigits> struct HexFloat {
+  static constexpr int fraction_digits = FractionDigits;
+  static constexpr int characteristic_bias = 64;
+  static constexpr int max_scale = 4 * 63 - 1;
+  static constexpr int min_scale = -4 * 64 - 4 * FractionDigits;
+
+  using significand = Binary<4 * FractionDigits>;
+  using exponent = Binary<std::bit_width(unsigned(max_scale - min_scale + 1))>;
+
+  static constexpr int exponent_base = 16;
+  static constexpr int exponent_bias = 1 - min_scale;
+  static constexpr SignMethod value_sign = SignMethod::Explicit;
+  static constexpr bool is_composite = true;
+
+  static constexpr NegativeZero negative_zero = NegativeZero::Exists;
+  static constexpr NanEncoding nan_encoding = NanEncoding::None;
+  static constexpr InfEncoding inf_encoding = InfEncoding::None;
+  static constexpr DenormalMode denormal_mode = DenormalMode::None;
+
+  static_assert(FractionDigits >= 1 && FractionDigits <= 28,
+                "an HFP fraction is 1 to 28 hex digits");
+};
+
+// -----------------------------------------------------------------
+// FixedPoint — a binary integer with an implied radix point (Qm.n)
+// -----------------------------------------------------------------
+// IntegerDigits integer bits and FractionDigits fraction bits,
+// plus a sign bit when Sign is RadixComplement (two's complement
+// over the whole word; the DSP convention, so Q15 is
+// FixedPoint<0, 15> in 16 bits and Q15.16 FixedPoint<15, 16> in 32)
+// or none when it is Unsigned. value = word · 2^−FractionDigits.
+// Overflow says what add, sub, mul and div do with a result outside
+// the range: keep its low bits (Wrap) or clamp it (Saturate).
+//
+// As with Posit, the semantic widths are the binary envelope the
+// pipeline unpacks into:
+//   significand — IntegerDigits + FractionDigits bits: every
+//                 magnitude fits (−2^IntegerDigits, the one that
+//                 needs the sign bit's place, is a single bit);
+//   exponent    — the scale of the leading bit, −FractionDigits to
+//                 max_scale, biased so the smallest sits at 1.
+// There is no NaN, infinity, negative zero or subnormal range.
+template <int IntegerDigits, int FractionDigits,
+          SignMethod Sign = SignMethod::RadixComplement,
+          OverflowMode Overflow = OverflowMode::Saturate>
+struct FixedPoint {
+  static constexpr int integer_digits = IntegerDigits;
+  static constexpr int fraction_digits = FractionDigits;
+  static constexpr int total_digits =
+      IntegerDigits + FractionDigits +
+      (Sign == SignMethod::RadixComplement ? 1 : 0);
+  static constexpr OverflowMode overflow = Overflow;
+  // Leading-bit scale of the largest magnitude: −2^IntegerDigits
+  // when signed, just under 2^IntegerDigits when not.
+  static constexpr int max_scale =
+      Sign == SignMethod::RadixComplement ? IntegerDigits : IntegerDigits - 1;
+
+  using significand = Binary<IntegerDigits + FractionDigits>;
+  using exponent =
+      Binary<std::bit_width(unsigned(max_scale + FractionDigits + 2))>;
+
+  static constexpr int exponent_base = 2;
+  static constexpr int exponent_bias = FractionDigits + 1;
+  static constexpr SignMethod value_sign = Sign;
+  static constexpr bool is_composite = true;
+
+  static constexpr NegativeZero negative_zero = NegativeZero::DoesNotExist;
+  static constexpr NanEncoding nan_encoding = NanEncoding::None;
+  static constexpr InfEncoding inf_encoding = InfEncoding::None;
+  static constexpr DenormalMode denormal_mode = DenormalMode::None;
+
+  static_assert(Sign == SignMethod::RadixComplement ||
+                    Sign == SignMethod::Unsigned,
+                "a fixed-point word is two's complement or unsigned");
+  static_assert(IntegerDigits >= 0 && FractionDigits >= 0 &&
+                    IntegerDigits + FractionDigits >= 1,
+                "a fixed-point word needs at least one value digit");
+  static_assert(total_digits <= 64, "fixed-point words are at most 64 bits");
+};
+
+namespace detail {
+template <typename N> inline constexpr bool is_posit = false;
+template <int TotalDigits, int ExponentDigits>
+inline constexpr bool is_posit<Posit<TotalDigits, ExponentDigits>> = true;
+
+// Decimal floating point: a radix-10 significand scaled by powers of
+// ten. Unlike binary, a decimal value has a cohort of representations
+// (1.0 and 1.00 differ in exponent), so the exponent is the quantum,
+// not a normalized scale.
+template <typename N> inline constexpr bool is_decimal = false;
+template <typename Significand, typename Exponent, int ExponentBias,
+          SignMethod ValueSign, typename Specials>
+  requires(Significand::radix == 10)
+inline constexpr bool is_decimal<FloatingPoint<Significand, Exponent, 10,
+                                               ExponentBias, ValueSign,
+                                               Specials>> = true;
+
+template <typename N> inline constexpr bool is_hex_float = false;
+template <int FractionDigits>
+inline constexpr bool is_hex_float<HexFloat<FractionDigits>> = true;
+
+template <typename N> inline constexpr bool is_fixed_point = false;
+template <int IntegerDigits, int FractionDigits, SignMethod Sign,
+          OverflowMode Overflow>
+inline constexpr bool is_fixed_point<
+    FixedPoint<IntegerDigits, FractionDigits, Sign, Overflow>> = true;
+} // namespace detail
+
 // -----------------------------------------------------------------
 // ValidNumber concept
 // -----------------------------------------------------------------
@@ -241,6 +428,19 @@ using CDC6600 =
     FloatingPoint<Binary<48>, Binary<11>, 2, /*bias=*/1024,
                   SignMethod::DiminishedRadixComplement, CDC6600Specials>;
 
+// IEEE 754 decimal{K}, K a multiple of 32: p = 9·K/32 − 2 decimal
+// digits, emax = 3·2^(K/16 + 3), and a (K/16 + 6)-bit biased
+// exponent q + bias, where q is the exponent of the coefficient's
+// last digit (value = C · 10^q). digit_width is nominal — how the
+// coefficient's digits sit in the word (one binary integer for BID,
+// declets for DPD) is the Layout's business.
+template <int K>
+using IEEE754Decimal =
+    FloatingPoint<Primitive<10, 4, 9 * K / 32 - 2, SignMethod::Unsigned>,
+                  Binary<K / 16 + 6>, /*base=*/10,
+                  /*bias=*/3 * (1 << (K / 16 + 3)) + (9 * K / 32 - 2) - 2,
+                  SignMethod::Explicit, IEEESpecials>;
+
 // Static verification.
 static_assert(ValidNumber<IEEE754<8, 23>>);
 static_assert(ValidNumber<RbjTwosComplement<8, 23>>);
@@ -249,6 +449,19 @@ static_assert(ValidNumber<Relaxed<5, 2>>);
 static_assert(ValidNumber<GPUStyle<8, 23>>);
 static_assert(ValidNumber<PDP10>);
 static_assert(ValidNumber<CDC6600>);
+static_assert(ValidNumber<Posit<32, 2>>);
+static_assert(ValidNumber<IEEE754Decimal<64>>);
+static_assert(detail::is_decimal<IEEE754Decimal<128>>);
+static_assert(!detail::is_decimal<IEEE754<11, 52>>);
+static_assert(IEEE754Decimal<64>::exponent_bias == 398);
+static_assert(IEEE754Decimal<128>::significand::digit_count == 34);
+static_assert(ValidNumber<HexFloat<14>>);
+static_assert(detail::is_hex_float<HexFloat<6>>);
+static_assert(HexFloat<6>::exponent_bias == 281);
+static_assert(ValidNumber<FixedPoint<0, 15>>);
+static_assert(detail::is_fixed_point<FixedPoint<15, 16>>);
+static_assert(FixedPoint<15, 16>::total_digits == 32);
+static_assert(FixedPoint<8, 8, SignMethod::Unsigned>::max_scale == 7);
 
 } // namespace numbers
 } // namespace opine
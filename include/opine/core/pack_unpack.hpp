@@ -20,9 +20,42 @@
 //
 // This slice covers Explicit and RadixComplement value_sign only.
 // DiminishedRadixComplement (CDC 6600) is deferred.
+//
+// Posits have their own codec at the end of this file: the regime
+// is one count-leading-ones/zeros on the word, after which the
+// supplement and fraction are a shift apiece. Their unpacked form is
+// the same UnpackedFloat — always Finite-normal with the scale as a
+// biased exponent — so every kernel runs on posits unchanged.
+//
+// BID decimals follow them: the combination field's top bits pick
+// where the exponent and coefficient start. A decimal unpacks to the
+// same UnpackedFloat with different contents — biased_exp is the
+// biased quantum exponent and significand the integer coefficient,
+// not normalized (decimal values have cohorts) — and a decimal Zero
+// keeps its exponent. Only decimal.hpp's kernels read them. DPD
+// decimals unpack to exactly the same contents: their declets go
+// through a 1024-entry decode table and back through a 1000-entry
+// encode table, three digits per lookup.
+//
+// IBM hex floats come last. Their fields are fixed, but the value's
+// leading bit may sit anywhere in the top hex digit — or lower, in
+// an unnormalized word — so unpack finds it and produces the
+// binary-normalized form, as for posits; pack puts it back at its
+// place within the top digit.
+//
+// Fixed-point words close the file: the word is the value's integer
+// count of ulps, so unpack is a magnitude and a leading-bit search,
+// and pack a shift back to the ulp. The helpers beside them split a
+// word into sign and magnitude and back, for roundAndPack and the
+// kernels in fixed_point.hpp.
+
+#include <array>
+#include <bit>
+#include <cstdint>
 
 #include "opine/core/arith_detail.hpp"
 #include "opine/core/bits.hpp"
+#include "opine/core/decimal_digits.hpp"
 #include "opine/core/digits.hpp"
 #include "opine/core/layout.hpp"
 #include "opine/core/number.hpp"
@@ -62,6 +95,10 @@ template <typename Storage> struct UnpackedFloat {
 // unpack
 // -----------------------------------------------------------------
 template <typename T>
+  requires(!detail::is_posit<typename T::number> &&
+           !detail::is_decimal<typename T::number> &&
+           !detail::is_hex_float<typename T::number> &&
+           !detail::is_fixed_point<typename T::number>)
 constexpr UnpackedFloat<typename T::storage_type>
 unpack(typename T::storage_type bits) {
   using Number = typename T::number;
@@ -71,8 +108,10 @@ unpack(typename T::storage_type bits) {
   static_assert(Number::is_composite,
                 "unpack currently supports FloatingPoint composites only");
   static_assert(Number::exponent_base == 2,
-                "non-binary exponent bases (IBM hex, decimal) are declared "
-                "in the type system but not yet implemented");
+                "decimal, IBM hex and fixed-point Types have their own "
+                "codecs below; "
+                "other non-binary exponent bases are declared in the type "
+                "system but not yet implemented");
 
   constexpr int TotalBits = Layout::total_bits;
   constexpr std::uint64_t ExpMax = (std::uint64_t{1} << Layout::exp_bits) - 1;
@@ -250,6 +289,10 @@ unpack(typename T::storage_type bits) {
 // pack
 // -----------------------------------------------------------------
 template <typename T>
+  requires(!detail::is_posit<typename T::number> &&
+           !detail::is_decimal<typename T::number> &&
+           !detail::is_hex_float<typename T::number> &&
+           !detail::is_fixed_point<typename T::number>)
 constexpr typename T::storage_type
 pack(const UnpackedFloat<typename T::storage_type> &u) {
   using Number = typename T::number;
@@ -259,8 +302,10 @@ pack(const UnpackedFloat<typename T::storage_type> &u) {
   static_assert(Number::is_composite,
                 "pack currently supports FloatingPoint composites only");
   static_assert(Number::exponent_base == 2,
-                "non-binary exponent bases (IBM hex, decimal) are declared "
-                "in the type system but not yet implemented");
+                "decimal, IBM hex and fixed-point Types have their own "
+                "codecs below; "
+                "other non-binary exponent bases are declared in the type "
+                "system but not yet implemented");
 
   constexpr int TotalBits = Layout::total_bits;
   constexpr std::uint64_t ExpMax = (std::uint64_t{1} << Layout::exp_bits) - 1;
@@ -363,6 +408,695 @@ pack(const UnpackedFloat<typename T::storage_type> &u) {
   }
 }
 
+// -----------------------------------------------------------------
+// Posit codec
+// -----------------------------------------------------------------
+namespace detail {
+
+// A positive posit pattern (sign bit clear) and what rounding the
+// value to it did: inexact, and clamped = −1 when the value lay
+// below minpos, +1 above maxpos (a posit saturates at both ends
+// rather than reaching zero or NaR).
+struct PositRounding {
+  std::uint64_t pattern;
+  bool inexact;
+  int clamped;
+};
+
+// The posit nearest, per Rnd, to m · 2^(scale − topBitPos(m)) — m's
+// leading bit has weight 2^scale. This is where the rounding
+// precision becomes value-dependent: the regime length follows
+// from the scale, and whatever of the N − 1 body bits the regime
+// and supplement leave is the fraction width. Rounding is on the
+// bit pattern — the body as if extended with every further
+// supplement and fraction bit, cut at N − 1 bits, with the first
+// dropped bit as guard and the rest as sticky — which is the posit
+// standard's rule; past a long regime the tie point between two
+// neighbours is the geometric one their truncated supplement bits
+// imply. Incrementing a positive pattern moves to the next larger
+// posit across every field boundary, so the round-up carry needs no
+// case analysis.
+template <int N, int ES, typename Rnd, typename Limb, int Count>
+constexpr PositRounding roundPosit(bool sign, int scale,
+                                   const DigitVector<Limb, Count> &m) {
+  constexpr int MaxScale = (N - 2) << ES;
+  constexpr std::uint64_t MaxPos = (std::uint64_t{1} << (N - 1)) - 1;
+  const int top = topBitPos(m);
+
+  if (scale < -MaxScale)
+    return {1, true, -1};
+  if (scale >= MaxScale) {
+    const bool above = scale > MaxScale || anyBitsBelow(m, top);
+    return {MaxPos, above, above ? 1 : 0};
+  }
+
+  // Regime k and supplement e: scale = k·2^ES + e, e in [0, 2^ES).
+  const int k = scale >> ES;
+  const std::uint64_t e = std::uint64_t(scale & ((1 << ES) - 1));
+  const int run = k >= 0 ? k + 2 : 1 - k; // with the terminator
+  const std::uint64_t regime =
+      k >= 0 ? ((std::uint64_t{1} << (k + 1)) - 1) << 1 : std::uint64_t{1};
+
+  std::uint64_t kept;
+  bool guard, sticky;
+  const int fb = (N - 1) - run - ES; // fraction bits kept
+  if (fb >= 0) {
+    // The fraction is m's bits below its leading one.
+    const int s = top - fb;
+    std::uint64_t frac;
+    if (s >= 0) {
+      frac = lowUint64(shiftRightDigits(m, s));
+      guard = bitAt(m, s - 1);
+      sticky = anyBitsBelow(m, s - 1);
+    } else {
+      frac = lowUint64(m) << -s;
+      guard = sticky = false;
+    }
+    frac &= (std::uint64_t{1} << fb) - 1;
+    kept = (regime << (ES + fb)) | (e << fb) | frac;
+  } else {
+    // The regime leaves room for only ES − d supplement bits.
+    const int d = -fb;
+    kept = (regime << (ES - d)) | (e >> d);
+    guard = ((e >> (d - 1)) & 1) != 0;
+    sticky = (e & ((std::uint64_t{1} << (d - 1)) - 1)) != 0 ||
+             anyBitsBelow(m, top);
+  }
+
+  if (shouldRoundUp<Rnd>((kept & 1) != 0, guard, false, sticky, sign))
+    kept += 1;
+  return {kept, guard || sticky, 0};
+}
+
+template <int N>
+constexpr std::uint64_t positWordMask() {
+  return N == 64 ? ~std::uint64_t{0} : (std::uint64_t{1} << N) - 1;
+}
+
+// A pattern with its sign applied: negatives are the two's
+// complement of the whole word.
+template <typename T>
+constexpr typename T::storage_type positFromPattern(bool sign,
+                                                    std::uint64_t pattern) {
+  constexpr int N = T::number::total_digits;
+  if (sign)
+    pattern = (~pattern + 1) & positWordMask<N>();
+  return typename T::storage_type(pattern);
+}
+
+} // namespace detail
+
+template <typename T>
+  requires detail::is_posit<typename T::number>
+constexpr UnpackedFloat<typename T::storage_type>
+unpack(typename T::storage_type bits) {
+  using Number = typename T::number;
+  using Storage = typename T::storage_type;
+  constexpr int N = Number::total_digits;
+  constexpr int ES = Number::exponent_digits;
+  constexpr int FracBits = Number::significand::digit_count - 1;
+  constexpr std::uint64_t NaR = std::uint64_t{1} << (N - 1);
+
+  UnpackedFloat<Storage> u{};
+  std::uint64_t x = std::uint64_t(bits) & detail::positWordMask<N>();
+  if (x == 0) {
+    u.category = ValueCategory::Zero;
+    return u;
+  }
+  if (x == NaR) {
+    u.category = ValueCategory::NaN;
+    return u;
+  }
+  u.sign = (x & NaR) != 0;
+  if (u.sign)
+    x = (~x + 1) & detail::positWordMask<N>();
+
+  // The body — every bit below the sign — left-aligned, so the
+  // regime run starts at bit 63 and one count measures it. Bits
+  // past the word's end read as zeros: a supplement or fraction the
+  // regime crowded out is zero.
+  std::uint64_t w = x << (65 - N);
+  int run, k;
+  if (w >> 63) {
+    run = std::countl_one(w);
+    k = run - 1;
+  } else {
+    run = std::countl_zero(w);
+    k = -run;
+  }
+  w = run + 1 < 64 ? w << (run + 1) : 0;
+  int e = 0;
+  if constexpr (ES > 0) {
+    e = int(w >> (64 - ES));
+    w <<= ES;
+  }
+  std::uint64_t sig = std::uint64_t{1} << FracBits;
+  if constexpr (FracBits > 0)
+    sig |= w >> (64 - FracBits);
+
+  u.category = ValueCategory::Finite;
+  u.biased_exp = k * (1 << ES) + e + Number::exponent_bias;
+  u.significand = Storage(sig);
+  return u;
+}
+
+// Exact for every value unpack produces; anything else rounds to
+// nearest (ties to the even pattern). No Infinity exists to pack —
+// an infinite result is NaR, as is NaN.
+template <typename T>
+  requires detail::is_posit<typename T::number>
+constexpr typename T::storage_type
+pack(const UnpackedFloat<typename T::storage_type> &u) {
+  using Number = typename T::number;
+  using Storage = typename T::storage_type;
+  constexpr int N = Number::total_digits;
+  constexpr int SigBits = Number::significand::digit_count;
+
+  if (u.category == ValueCategory::NaN ||
+      u.category == ValueCategory::Infinity)
+    return Storage(std::uint64_t{1} << (N - 1));
+  if (u.category == ValueCategory::Zero || detail::isZeroWord(u.significand))
+    return Storage{};
+
+  const auto m = detail::digitsFrom<std::uint64_t, 1>(
+      std::uint64_t(u.significand));
+  const int scale = (u.biased_exp == 0 ? 1 : u.biased_exp) -
+                    Number::exponent_bias +
+                    (detail::topBitPos(m) - (SigBits - 1));
+  const auto r =
+      detail::roundPosit<N, Number::exponent_digits,
+                         rounding::ToNearestTiesToEven>(u.sign, scale, m);
+  return detail::positFromPattern<T>(u.sign, r.pattern);
+}
+
+// -----------------------------------------------------------------
+// BID decimal codec
+// -----------------------------------------------------------------
+namespace detail {
+
+// 10^n in a decimal Type's storage word.
+template <typename Storage> constexpr Storage decimalPow10(int n) {
+  Storage p = 1;
+  for (int i = 0; i < n; ++i)
+    p *= 10;
+  return p;
+}
+
+// Decimal digits in a nonzero coefficient.
+template <typename Storage> constexpr int decimalDigitCount(Storage c) {
+  int n = 1;
+  for (Storage p = 10; p <= c; p *= 10)
+    ++n;
+  return n;
+}
+
+// A finite decimal below 10^emin: its coefficient too short to reach
+// the smallest normal exponent from its own. With E the biased
+// exponent, that is C < 10^(P − 1 − E).
+template <typename T>
+constexpr bool decimalIsSubnormal(
+    const UnpackedFloat<typename T::storage_type> &u) {
+  constexpr int P = T::number::significand::digit_count;
+  return u.biased_exp < P - 1 &&
+         u.significand <
+             decimalPow10<typename T::storage_type>(P - 1 - u.biased_exp);
+}
+
+} // namespace detail
+
+// A coefficient of 10^P or more is non-canonical and reads as zero,
+// with its exponent (IEEE 754 §3.5.2).
+template <typename T>
+  requires(detail::is_decimal<typename T::number> &&
+           detail::is_bid_layout<typename T::layout>)
+constexpr UnpackedFloat<typename T::storage_type>
+unpack(typename T::storage_type bits) {
+  using Layout = typename T::layout;
+  using Storage = typename T::storage_type;
+  constexpr int P = T::number::significand::digit_count;
+  constexpr int t = Layout::trailing_bits;
+  constexpr Storage ExpMask = (Storage(1) << Layout::exp_bits) - 1;
+  constexpr Storage MaxCoefficient = detail::decimalPow10<Storage>(P) - 1;
+
+  UnpackedFloat<Storage> u{};
+  u.sign = ((bits >> Layout::sign_offset) & 1) != 0;
+  const unsigned top = unsigned((bits >> (Layout::sign_offset - 5)) & 0x1F);
+  if ((top & 0x18) == 0x18) {
+    if ((top & 0x1E) == 0x1E) {
+      u.category = (top & 1) ? ValueCategory::NaN : ValueCategory::Infinity;
+      return u;
+    }
+    u.biased_exp = int((bits >> (t + 1)) & ExpMask);
+    u.significand =
+        (Storage(1) << (t + 3)) | (bits & ((Storage(1) << (t + 1)) - 1));
+  } else {
+    u.biased_exp = int((bits >> (t + 3)) & ExpMask);
+    u.significand = bits & ((Storage(1) << (t + 3)) - 1);
+  }
+  if (u.significand == 0 || u.significand > MaxCoefficient) {
+    u.category = ValueCategory::Zero;
+    u.significand = 0;
+  } else {
+    u.category = ValueCategory::Finite;
+  }
+  return u;
+}
+
+// The small form whenever the coefficient fits it, which makes every
+// canonical encoding's round trip exact. NaN packs as the canonical
+// quiet NaN.
+template <typename T>
+  requires(detail::is_decimal<typename T::number> &&
+           detail::is_bid_layout<typename T::layout>)
+constexpr typename T::storage_type
+pack(const UnpackedFloat<typename T::storage_type> &u) {
+  using Layout = typename T::layout;
+  using Storage = typename T::storage_type;
+  constexpr int t = Layout::trailing_bits;
+  constexpr int Top = Layout::sign_offset - 5; // the combination's G0…G4
+
+  const Storage sign = Storage(u.sign ? 1 : 0) << Layout::sign_offset;
+  if (u.category == ValueCategory::NaN)
+    return Storage(0x1F) << Top;
+  if (u.category == ValueCategory::Infinity)
+    return sign | (Storage(0x1E) << Top);
+
+  const Storage c =
+      u.category == ValueCategory::Zero ? Storage(0) : u.significand;
+  const Storage e = Storage(unsigned(u.biased_exp));
+  if (c < (Storage(1) << (t + 3)))
+    return sign | (e << (t + 3)) | c;
+  return sign | (Storage(3) << (Layout::sign_offset - 2)) | (e << (t + 1)) |
+         (c & ((Storage(1) << (t + 1)) - 1));
+}
+
+// -----------------------------------------------------------------
+// DPD decimal codec
+// -----------------------------------------------------------------
+namespace detail {
+
+// A declet's bits are p q r s t u v w x y (bit 9 to bit 0). With
+// digits abcd efgh ijkm and a, e, i marking the large digits (8, 9),
+// IEEE 754 Table 3.4 reads:
+//
+//   aei   pqr stu v wxy        aei   pqr stu v wxy
+//   000   bcd fgh 0 jkm        100   jkd fgh 1 10m
+//   001   bcd fgh 1 00m        101   fgd 01h 1 11m
+//   010   bcd jkh 1 01m        110   jkd 00h 1 11m
+//   011   bcd 10h 1 11m        111   00d 11h 1 11m
+//
+// Decoding inverts it for all 1024 patterns; the 24 that no three
+// digits encode to (pq ≠ 00 in the 111 row) read as the digits that
+// row gives, ignoring p and q (§3.5.2).
+inline constexpr std::array<std::uint16_t, 1024> dpdDecodeTable = [] {
+  std::array<std::uint16_t, 1024> t{};
+  for (unsigned x = 0; x < 1024; ++x) {
+    auto bit = [x](int i) { return (x >> i) & 1; };
+    const unsigned pqr = x >> 7, stu = (x >> 4) & 7, wxy = x & 7;
+    const unsigned r = bit(7), u = bit(4), y = bit(0);
+    const unsigned pq_y = (bit(9) << 2) | (bit(8) << 1) | y;
+    unsigned d1 = pqr, d2 = stu, d3 = wxy;
+    if (bit(3)) {
+      switch ((x >> 1) & 3) {
+      case 0: d3 = 8 + y; break;
+      case 1: d2 = 8 + u; d3 = (bit(6) << 2) | (bit(5) << 1) | y; break;
+      case 2: d1 = 8 + r; d3 = pq_y; break;
+      default:
+        switch ((x >> 5) & 3) {
+        case 0: d1 = 8 + r; d2 = 8 + u; d3 = pq_y; break;
+        case 1: d1 = 8 + r; d2 = (bit(9) << 2) | (bit(8) << 1) | u; d3 = 8 + y; break;
+        case 2: d2 = 8 + u; d3 = 8 + y; break;
+        default: d1 = 8 + r; d2 = 8 + u; d3 = 8 + y; break;
+        }
+      }
+    }
+    t[x] = std::uint16_t(d1 * 100 + d2 * 10 + d3);
+  }
+  return t;
+}();
+
+inline constexpr std::array<std::uint16_t, 1000> dpdEncodeTable = [] {
+  std::array<std::uint16_t, 1000> t{};
+  for (unsigned n = 0; n < 1000; ++n) {
+    const unsigned d1 = n / 100, d2 = n / 10 % 10, d3 = n % 10;
+    const unsigned a = d1 >> 3, e = d2 >> 3, i = d3 >> 3;
+    const unsigned bcd = d1 & 7, fgh = d2 & 7, jkm = d3 & 7;
+    const unsigned d = d1 & 1, h = d2 & 1, m = d3 & 1;
+    const unsigned jk = jkm >> 1, fg = fgh >> 1;
+    unsigned x = 0;
+    switch ((a << 2) | (e << 1) | i) {
+    case 0: x = (bcd << 7) | (fgh << 4) | jkm; break;
+    case 1: x = (bcd << 7) | (fgh << 4) | 0x8 | m; break;
+    case 2: x = (bcd << 7) | (jk << 5) | (h << 4) | 0xA | m; break;
+    case 3: x = (bcd << 7) | (2 << 5) | (h << 4) | 0xE | m; break;
+    case 4: x = (jk << 8) | (d << 7) | (fgh << 4) | 0xC | m; break;
+    case 5: x = (fg << 8) | (d << 7) | (1 << 5) | (h << 4) | 0xE | m; break;
+    case 6: x = (jk << 8) | (d << 7) | (h << 4) | 0xE | m; break;
+    default: x = (d << 7) | (3 << 5) | (h << 4) | 0xE | m; break;
+    }
+    t[n] = std::uint16_t(x);
+  }
+  return t;
+}();
+
+inline constexpr std::array<std::uint64_t, 7> pow1000 = {
+    1, 1000, 1000000, 1000000000, 1000000000000, 1000000000000000,
+    1000000000000000000};
+
+// The coefficient of the leading digit and Declets declets, six
+// declets (18 digits, one 64-bit word) per step.
+template <typename Storage, int Declets>
+constexpr Storage dpdCoefficient(unsigned lead, Storage trailing) {
+  Storage c = lead;
+  int j = Declets;
+  while (j > 0) {
+    const int n = (j - 1) % 6 + 1; // what leaves a multiple of six below
+    std::uint64_t part = 0;
+    for (int k = 0; k < n; ++k) {
+      --j;
+      part = part * 1000 +
+             dpdDecodeTable[unsigned(trailing >> (10 * j)) & 0x3FF];
+    }
+    c = c * Storage(pow1000[n]) + Storage(part);
+  }
+  return c;
+}
+
+// The reverse: the declets of c < 10^(3·Declets + 1) into the low
+// bits of a word, and its leading digit. A coefficient wider than 64
+// bits splits at 10^19 by reciprocal first, so no step divides a
+// 128-bit word.
+template <typename Storage, int Declets>
+constexpr Storage dpdTrailing(Storage c, unsigned &lead) {
+  Storage out = 0;
+  std::uint64_t x;
+  int j = 0;
+  if constexpr (sizeof(Storage) > 8) {
+    const auto v = decimalFromWord<2>(c);
+    std::uint64_t lo = v.d[0] % pow1000[6];
+    x = v.d[1] * 10 + v.d[0] / pow1000[6];
+    for (; j < 6 && j < Declets; ++j, lo /= 1000)
+      out |= Storage(dpdEncodeTable[lo % 1000]) << (10 * j);
+  } else {
+    x = std::uint64_t(c);
+  }
+  for (; j < Declets; ++j, x /= 1000)
+    out |= Storage(dpdEncodeTable[x % 1000]) << (10 * j);
+  lead = unsigned(x);
+  return out;
+}
+
+} // namespace detail
+
+// Every declet decodes, so a DPD coefficient is always canonical
+// (below 10^P); non-canonical declets read as IEEE 754 says.
+template <typename T>
+  requires(detail::is_decimal<typename T::number> &&
+           detail::is_dpd_layout<typename T::layout>)
+constexpr UnpackedFloat<typename T::storage_type>
+unpack(typename T::storage_type bits) {
+  using Layout = typename T::layout;
+  using Storage = typename T::storage_type;
+  constexpr int t = Layout::trailing_bits;
+  constexpr int w = Layout::exp_continuation_bits;
+
+  UnpackedFloat<Storage> u{};
+  u.sign = ((bits >> Layout::sign_offset) & 1) != 0;
+  const unsigned g = unsigned((bits >> (Layout::sign_offset - 5)) & 0x1F);
+  unsigned exp_top, lead;
+  if ((g & 0x18) != 0x18) {
+    exp_top = g >> 3;
+    lead = g & 7;
+  } else if ((g & 0x1E) != 0x1E) {
+    exp_top = (g >> 1) & 3;
+    lead = 8 + (g & 1);
+  } else {
+    u.category = (g & 1) ? ValueCategory::NaN : ValueCategory::Infinity;
+    return u;
+  }
+  u.biased_exp =
+      int((exp_top << w) | unsigned((bits >> t) & ((Storage(1) << w) - 1)));
+  u.significand = detail::dpdCoefficient<Storage, Layout::declets>(
+      lead, bits & ((Storage(1) << t) - 1));
+  u.category =
+      u.significand == 0 ? ValueCategory::Zero : ValueCategory::Finite;
+  return u;
+}
+
+// Canonical declets always. NaN packs as the canonical quiet NaN.
+template <typename T>
+  requires(detail::is_decimal<typename T::number> &&
+           detail::is_dpd_layout<typename T::layout>)
+constexpr typename T::storage_type
+pack(const UnpackedFloat<typename T::storage_type> &u) {
+  using Layout = typename T::layout;
+  using Storage = typename T::storage_type;
+  constexpr int t = Layout::trailing_bits;
+  constexpr int w = Layout::exp_continuation_bits;
+  constexpr int Top = Layout::sign_offset - 5;
+
+  const Storage sign = Storage(u.sign ? 1 : 0) << Layout::sign_offset;
+  if (u.category == ValueCategory::NaN)
+    return Storage(0x1F) << Top;
+  if (u.category == ValueCategory::Infinity)
+    return sign | (Storage(0x1E) << Top);
+
+  unsigned lead = 0;
+  const Storage trailing =
+      u.category == ValueCategory::Zero
+          ? Storage(0)
+          : detail::dpdTrailing<Storage, Layout::declets>(u.significand, lead);
+  const unsigned e = unsigned(u.biased_exp), exp_top = e >> w;
+  const unsigned g = lead < 8 ? (exp_top << 3) | lead
+                              : 0x18 | (exp_top << 1) | (lead & 1);
+  return sign | (Storage(g) << Top) |
+         (Storage(e & ((1u << w) - 1)) << t) | trailing;
+}
+
+// -----------------------------------------------------------------
+// HFP codec
+// -----------------------------------------------------------------
+namespace detail {
+
+// An HFP word's fraction as one 4·F-bit integer: the extended
+// format's two 14-digit halves joined, the low half's sign and
+// characteristic dropped.
+template <typename T>
+constexpr typename T::storage_type
+hexFraction(typename T::storage_type bits) {
+  using Layout = typename T::layout;
+  using Storage = typename T::storage_type;
+  if constexpr (Layout::split) {
+    constexpr Storage Half = (Storage(1) << 56) - 1;
+    return (((bits >> 64) & Half) << 56) | (bits & Half);
+  } else {
+    return bits & ((Storage(1) << (4 * Layout::fraction_digits)) - 1);
+  }
+}
+
+// The word for a sign, a characteristic and a 4·F-bit fraction. An
+// extended word's low half carries the sign and characteristic − 14
+// (mod 128), as the hardware writes it — or nothing, for a zero.
+template <typename T>
+constexpr typename T::storage_type hexWord(bool sign, int characteristic,
+                                           typename T::storage_type fraction) {
+  using Layout = typename T::layout;
+  using Storage = typename T::storage_type;
+  const Storage fields = (Storage(sign) << 7) | Storage(characteristic);
+  if constexpr (Layout::split) {
+    constexpr Storage Half = (Storage(1) << 56) - 1;
+    const Storage low_fields =
+        fraction == 0 ? Storage(0)
+                      : (Storage(sign) << 7) |
+                            Storage((characteristic - 14) & 0x7F);
+    return (fields << 120) | ((fraction >> 56) << 64) | (low_fields << 56) |
+           (fraction & Half);
+  } else {
+    return (fields << Layout::exp_offset) | fraction;
+  }
+}
+
+} // namespace detail
+
+// A zero fraction is zero at any characteristic, keeping its sign.
+// Anything else is Finite whatever its leading digit: an
+// unnormalized word decodes to the value it denotes.
+template <typename T>
+  requires detail::is_hex_float<typename T::number>
+constexpr UnpackedFloat<typename T::storage_type>
+unpack(typename T::storage_type bits) {
+  using Number = typename T::number;
+  using Layout = typename T::layout;
+  using Storage = typename T::storage_type;
+  constexpr int FracBits = Number::significand::digit_count;
+
+  UnpackedFloat<Storage> u{};
+  u.sign = ((bits >> Layout::sign_offset) & 1) != 0;
+  const Storage f = detail::hexFraction<T>(bits);
+  if (f == 0) {
+    u.category = ValueCategory::Zero;
+    return u;
+  }
+  const int characteristic = int((bits >> Layout::exp_offset) & 0x7F);
+  const int top = detail::wordTopBit(f);
+  u.category = ValueCategory::Finite;
+  u.biased_exp = 4 * (characteristic - Number::characteristic_bias) -
+                 FracBits + top + Number::exponent_bias;
+  u.significand = f << (FracBits - 1 - top);
+  return u;
+}
+
+// Normalized: the leading bit goes back into the top hex digit.
+// Exact for every value unpack produces; bits that do not fit are
+// truncated (roundAndPack rounds before it gets here), a value below
+// the normalized range keeps what it can at characteristic 0, and
+// one above it saturates. There is no NaN to pack — like every
+// NaN-less format, a NaN category packs as +0 — and an infinity
+// saturates too.
+template <typename T>
+  requires detail::is_hex_float<typename T::number>
+constexpr typename T::storage_type
+pack(const UnpackedFloat<typename T::storage_type> &u) {
+  using Number = typename T::number;
+  using Storage = typename T::storage_type;
+  constexpr int FracBits = Number::significand::digit_count;
+  constexpr Storage MaxFraction = (Storage(1) << FracBits) - 1;
+
+  if (u.category == ValueCategory::NaN)
+    return Storage{};
+  if (u.category == ValueCategory::Infinity)
+    return detail::hexWord<T>(u.sign, 127, MaxFraction);
+  if (u.category == ValueCategory::Zero || u.significand == 0)
+    return detail::hexWord<T>(u.sign, 0, 0);
+
+  const int top = detail::wordTopBit(u.significand);
+  const int scale = (u.biased_exp == 0 ? 1 : u.biased_exp) -
+                    Number::exponent_bias + (top - (FracBits - 1));
+  if (scale > Number::max_scale)
+    return detail::hexWord<T>(u.sign, 127, MaxFraction);
+  int characteristic = (scale >> 2) + Number::characteristic_bias + 1;
+  const int lead = FracBits - 4 + (scale & 3);
+  Storage f = top > lead ? u.significand >> (top - lead)
+                         : u.significand << (lead - top);
+  if (characteristic < 0) {
+    const int s = -4 * characteristic;
+    f = s < FracBits ? f >> s : Storage(0);
+    characteristic = 0;
+  }
+  return detail::hexWord<T>(u.sign, characteristic, f);
+}
+
+// -----------------------------------------------------------------
+// Fixed-point codec
+// -----------------------------------------------------------------
+namespace detail {
+
+template <typename T>
+inline constexpr bool fixed_signed =
+    T::number::value_sign == SignMethod::RadixComplement;
+
+// The word's low total_bits bits, as a 64-bit mask.
+template <typename T>
+inline constexpr std::uint64_t fixed_word_mask =
+    ~std::uint64_t{0} >> (64 - T::layout::total_bits);
+
+// |x| in ulps and its sign. −2^(W−1) is its own magnitude.
+template <typename T>
+constexpr std::uint64_t fixedMagnitude(typename T::storage_type bits,
+                                       bool &negative) {
+  constexpr int W = T::layout::total_bits;
+  const std::uint64_t x = std::uint64_t(bits) & fixed_word_mask<T>;
+  negative = fixed_signed<T> && ((x >> (W - 1)) & 1) != 0;
+  return negative ? (std::uint64_t{0} - x) & fixed_word_mask<T> : x;
+}
+
+// The largest magnitude of the given sign: 2^(W−1) below zero and
+// 2^(W−1) − 1 above it for a signed word; 0 and 2^W − 1 unsigned.
+template <typename T>
+constexpr std::uint64_t fixedLimit(bool negative) {
+  constexpr std::uint64_t Top = fixed_word_mask<T> >> 1;
+  if constexpr (fixed_signed<T>)
+    return negative ? Top + 1 : Top;
+  else
+    return negative ? 0 : fixed_word_mask<T>;
+}
+
+// The word for a sign and a magnitude: two's complement, wrapped to
+// the word.
+template <typename T>
+constexpr typename T::storage_type fixedWord(bool negative,
+                                             std::uint64_t magnitude) {
+  const std::uint64_t x = negative ? std::uint64_t{0} - magnitude : magnitude;
+  return typename T::storage_type(x & fixed_word_mask<T>);
+}
+
+template <typename T>
+constexpr typename T::storage_type fixedExtreme(bool negative) {
+  return fixedWord<T>(negative, fixedLimit<T>(negative));
+}
+
+} // namespace detail
+
+// Zero is the all-zero word; everything else is Finite, its
+// magnitude normalized to the envelope's leading bit.
+template <typename T>
+  requires detail::is_fixed_point<typename T::number>
+constexpr UnpackedFloat<typename T::storage_type>
+unpack(typename T::storage_type bits) {
+  using Number = typename T::number;
+  using Storage = typename T::storage_type;
+  constexpr int SigBits = Number::significand::digit_count;
+
+  UnpackedFloat<Storage> u{};
+  bool negative = false;
+  const std::uint64_t m = detail::fixedMagnitude<T>(bits, negative);
+  if (m == 0) {
+    u.category = ValueCategory::Zero;
+    return u;
+  }
+  const int top = std::bit_width(m) - 1;
+  u.category = ValueCategory::Finite;
+  u.sign = negative;
+  u.biased_exp = top - Number::fraction_digits + Number::exponent_bias;
+  u.significand = Storage(top >= SigBits ? m >> (top - SigBits + 1)
+                                         : m << (SigBits - 1 - top));
+  return u;
+}
+
+// Exact for every value unpack produces; bits below the ulp are
+// truncated (roundAndPack rounds before it gets here) and a value
+// out of range saturates, as does an infinity. There is no NaN to
+// pack: a NaN category packs as 0.
+template <typename T>
+  requires detail::is_fixed_point<typename T::number>
+constexpr typename T::storage_type
+pack(const UnpackedFloat<typename T::storage_type> &u) {
+  using Number = typename T::number;
+  using Storage = typename T::storage_type;
+  constexpr int SigBits = Number::significand::digit_count;
+
+  if (u.category == ValueCategory::NaN || u.category == ValueCategory::Zero)
+    return Storage{};
+  if (u.category == ValueCategory::Infinity)
+    return detail::fixedExtreme<T>(u.sign);
+  const std::uint64_t sig = std::uint64_t(u.significand);
+  if (sig == 0)
+    return Storage{};
+
+  const int top = std::bit_width(sig) - 1;
+  const int scale = (u.biased_exp == 0 ? 1 : u.biased_exp) -
+                    Number::exponent_bias + (top - (SigBits - 1));
+  if (scale > Number::max_scale)
+    return detail::fixedExtreme<T>(u.sign);
+  const int shift = scale + Number::fraction_digits - top;
+  const std::uint64_t m = shift >= 0   ? sig << shift
+                          : shift > -64 ? sig >> -shift
+                                        : 0;
+  if (m > detail::fixedLimit<T>(u.sign))
+    return detail::fixedExtreme<T>(u.sign);
+  return detail::fixedWord<T>(u.sign, m);
+}
+
 } // namespace opine
 
 #endif // OPINE_CORE_PACK_UNPACK_HPP
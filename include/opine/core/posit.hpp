@@ -0,0 +1,198 @@
+#ifndef OPINE_CORE_POSIT_HPP
+#define OPINE_CORE_POSIT_HPP
+
+// The posit quire: an exact accumulator for sums of products.
+//
+//   Quire<T> q;                  // T a posit Type; q holds 0
+//   q.addProduct(a, b);          // q += a·b, exactly
+//   q.subProduct(a, b);          // q −= a·b
+//   q.add(a); q.sub(a);          // q ± a
+//   q.round()                    // q rounded once to T
+//   dotProduct<T>(a, b)          // Σ a[i]·b[i] over two spans,
+//                                // rounded once
+//
+// Posit arithmetic itself needs nothing here — a posit Type runs
+// through add, mul, fma, convert, compare and the rest like any
+// other Type (the codec and epilogue are in pack_unpack.hpp and
+// round_pack.hpp), except under the Alternate exception policy,
+// whose abrupt underflow and substitutes assume the binary encoding
+// and which deliver rejects at compile time. The quire is what posits add on top: every posit
+// is an integer multiple of minpos, so every product of two is a
+// multiple of minpos², and a fixed-point register from minpos² up
+// past maxpos² holds any such sum with no rounding at all.
+//
+// Geometry (the 2022 Posit Standard's for ES = 2, where it comes to
+// 16·N bits): bit 0 weighs minpos² = 2^(−2·max_scale), bit
+// 4·max_scale weighs maxpos², the largest product; carry_bits above
+// that let 2^carry_bits maxpos² products accumulate before the
+// register wraps, and the top bit is the two's complement sign. A
+// NaR operand makes the quire NaR until clear().
+//
+// Accumulating is one product (a single 64-bit multiply up to
+// posit32, two limbs past it) added at its bit offset with the
+// carry run out — no alignment shift of the whole register and no
+// normalization. round() is the only rounding: one roundAndPack
+// with T's Rounding, flags through T's Exceptions axis as a fused
+// operation (Operation::Fma) reports them.
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+#include "opine/core/digits.hpp"
+#include "opine/core/exceptions.hpp"
+#include "opine/core/pack_unpack.hpp"
+#include "opine/core/round_pack.hpp"
+#include "opine/core/type.hpp"
+
+namespace opine {
+
+template <typename T>
+  requires detail::is_posit<typename T::number>
+struct Quire {
+  using storage_type = typename T::storage_type;
+
+  static constexpr int max_scale = T::number::max_scale;
+  static constexpr int carry_bits = 30;
+  static constexpr int total_bits =
+      ((4 * max_scale + 1 + carry_bits + 1) + 63) / 64 * 64;
+  static constexpr int limb_count = total_bits / 64;
+
+  using Acc = detail::DigitVector<std::uint64_t, limb_count>;
+  static constexpr storage_type One =
+      storage_type(std::uint64_t{1} << (T::number::total_digits - 2));
+
+  Acc acc{};
+  bool nar = false;
+
+  constexpr void clear() {
+    acc = {};
+    nar = false;
+  }
+
+  constexpr void addProduct(storage_type a, storage_type b) {
+    accumulate(false, a, b);
+  }
+  constexpr void subProduct(storage_type a, storage_type b) {
+    accumulate(true, a, b);
+  }
+  constexpr void add(storage_type a) { accumulate(false, a, One); }
+  constexpr void sub(storage_type a) { accumulate(true, a, One); }
+
+  constexpr bool isNaR() const { return nar; }
+  constexpr bool isZero() const { return !nar && detail::isZero(acc); }
+
+  // The sum, rounded to T.
+  constexpr auto round() const {
+    using Num = typename T::number;
+    if (nar)
+      return detail::deliver<T, Operation::Fma>(
+          detail::packSpecial<T>(ValueCategory::NaN, false), FlagNone);
+    if (detail::isZero(acc))
+      return detail::deliver<T, Operation::Fma>(
+          detail::packSpecial<T>(ValueCategory::Zero, false), FlagNone);
+
+    const bool negative = detail::bitAt(acc, total_bits - 1);
+    const auto magnitude = negative ? detail::subDigits(Acc{}, acc) : acc;
+    // roundAndPack reads a magnitude's bit 0 as weighing
+    // 2^(result_exp − bias − (SigBits − 1) − GuardBits); the
+    // quire's weighs minpos².
+    constexpr int ResultExp = Num::exponent_bias +
+                              (Num::significand::digit_count - 1) +
+                              detail::GuardBits - 2 * max_scale;
+    flags_t flags = FlagNone;
+    const auto bits =
+        detail::roundAndPack<T>(negative, ResultExp, magnitude, flags);
+    return detail::deliver<T, Operation::Fma>(bits, flags);
+  }
+
+  constexpr void accumulate(bool negative, storage_type a, storage_type b) {
+    using Num = typename T::number;
+    constexpr int SigBits = Num::significand::digit_count;
+    const auto ua = unpack<T>(a);
+    const auto ub = unpack<T>(b);
+    if (ua.category == ValueCategory::NaN ||
+        ub.category == ValueCategory::NaN) {
+      nar = true;
+      return;
+    }
+    if (ua.category == ValueCategory::Zero ||
+        ub.category == ValueCategory::Zero)
+      return;
+    negative ^= ua.sign != ub.sign;
+
+    // The exact product of the significands, up to 2·SigBits ≤ 120
+    // bits, and the quire bit its bit 0 lands on.
+    std::uint64_t lo, hi;
+    if constexpr (2 * SigBits <= 64) {
+      lo = std::uint64_t(ua.significand) * std::uint64_t(ub.significand);
+      hi = 0;
+    } else {
+      const auto p = detail::mulDigits(
+          detail::digitsFrom<std::uint64_t, 1>(std::uint64_t(ua.significand)),
+          detail::digitsFrom<std::uint64_t, 1>(std::uint64_t(ub.significand)));
+      lo = p.d[0];
+      hi = p.d[1];
+    }
+    int at = ua.biased_exp + ub.biased_exp - 2 * Num::exponent_bias -
+             2 * (SigBits - 1) + 2 * max_scale;
+    if (at < 0) {
+      // Below minpos² the product's bits are all zero: a posit with a
+      // long regime has few fraction bits, and the unpacked
+      // significand only pads them.
+      const int s = -at; // at most 2·(SigBits − 1)
+      if (s < 64) {
+        lo = (lo >> s) | (hi << (64 - s));
+        hi >>= s;
+      } else {
+        lo = hi >> (s - 64);
+        hi = 0;
+      }
+      at = 0;
+    }
+    addAt(lo, hi, at, negative);
+  }
+
+  // acc ±= (hi:lo) · 2^at, wrapping like the two's complement
+  // register it is.
+  constexpr void addAt(std::uint64_t lo, std::uint64_t hi, int at,
+                       bool subtract) {
+    const int first = at / 64, sh = at % 64;
+    const std::uint64_t part[3] = {
+        lo << sh, sh ? (hi << sh) | (lo >> (64 - sh)) : hi,
+        sh ? hi >> (64 - sh) : 0};
+    bool carry = false;
+    for (int i = first; i < limb_count; ++i) {
+      const int j = i - first;
+      if (j >= 3 && !carry)
+        break;
+      const std::uint64_t p = j < 3 ? part[j] : 0;
+      const std::uint64_t x = acc.d[i];
+      if (subtract) {
+        const std::uint64_t d = x - p;
+        acc.d[i] = d - std::uint64_t(carry);
+        carry = x < p || d < std::uint64_t(carry);
+      } else {
+        const std::uint64_t s = x + p;
+        acc.d[i] = s + std::uint64_t(carry);
+        carry = s < p || acc.d[i] < s;
+      }
+    }
+  }
+};
+
+// Σ a[i]·b[i] over the shorter span, rounded once.
+template <typename T>
+  requires detail::is_posit<typename T::number>
+constexpr auto dotProduct(std::span<const typename T::storage_type> a,
+                          std::span<const typename T::storage_type> b) {
+  Quire<T> q;
+  const std::size_t n = a.size() < b.size() ? a.size() : b.size();
+  for (std::size_t i = 0; i < n; ++i)
+    q.addProduct(a[i], b[i]);
+  return q.round();
+}
+
+} // namespace opine
+
+#endif // OPINE_CORE_POSIT_HPP
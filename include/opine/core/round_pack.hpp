@@ -21,12 +21,17 @@
 // IntegerExtremes Inf encoding is only known after the round-up
 // carry. (For dynamic-boundary layouts like posits the coupling is
 // even tighter — the packing structure determines the rounding
-// target — so this fusion is the boundary that generalizes.)
+// target — so this fusion is the boundary that generalizes: posits
+// take a second roundAndPack overload with the same signature, IBM
+// hex floats, whose precision wobbles with the leading digit, a
+// third, and fixed-point words, which round to a fixed ulp, a
+// fourth.)
 //
 // Guard bits are fixed at 3 (G/R/S): the max any currently
 // supported Rounding policy needs, and using a wider working
 // significand than Rounding::guard_bits does not change the result.
 
+#include <bit>
 #include <cstdint>
 #include <type_traits>
 
@@ -45,12 +50,25 @@ inline constexpr int GuardBits = 3;
 // The largest biased exponent finite values may occupy. Formats
 // whose NaN or Inf encoding reserves the top exponent lose that
 // binade to specials.
+// A posit's, hex float's or fixed-point word's is its largest scale
+// (maxpos; the leading bit of 0.FF…F × 16^63; that of the largest
+// word); a decimal's is the largest
+// quantum exponent, 3·2^(exp_bits − 2) − 1 (the combination field
+// has no room above it).
 template <typename T>
-inline constexpr int max_biased_exp =
-    (T::number::nan_encoding == NanEncoding::ReservedExponent ||
-     T::number::inf_encoding == InfEncoding::ReservedExponent)
-        ? ((1 << T::layout::exp_bits) - 1) - 1
-        : ((1 << T::layout::exp_bits) - 1);
+inline constexpr int max_biased_exp = [] {
+  if constexpr (is_posit<typename T::number> ||
+                is_hex_float<typename T::number> ||
+                is_fixed_point<typename T::number>)
+    return T::number::exponent_bias + T::number::max_scale;
+  else if constexpr (is_decimal<typename T::number>)
+    return 3 * (1 << (T::layout::exp_bits - 2)) - 1;
+  else
+    return (T::number::nan_encoding == NanEncoding::ReservedExponent ||
+            T::number::inf_encoding == InfEncoding::ReservedExponent)
+               ? ((1 << T::layout::exp_bits) - 1) - 1
+               : ((1 << T::layout::exp_bits) - 1);
+}();
 
 // The working digit geometry for NeedBits of significand
 // arithmetic: enough limbs of the Type's Platform machine word
@@ -71,15 +89,98 @@ using WorkingDigits = DigitVector<
 // decides the disposition. Silent discards them (the computation is
 // dead code the optimizer removes), StatusFlags accumulates into
 // the per-thread sticky set (runtime only — constant evaluation
-// cannot touch thread_local state), and ReturnStatus changes the
-// operation's return type to WithStatus<T>.
-template <typename T>
-constexpr auto deliver(typename T::storage_type bits, flags_t flags) {
-  using E = typename T::exceptions;
-  static_assert(!E::has_traps,
-                "exceptions::Trap is declared but not yet implemented");
-  if constexpr (std::is_same_v<E, exceptions::ReturnStatus>) {
+// cannot touch thread_local state), Scoped into the innermost
+// FlagScope, ReturnStatus changes the operation's return type to
+// WithStatus<T>, and TrapOn branches to the out-of-line handler
+// dispatch when an enabled flag fires. Counting<Inner> counts, then
+// does what Inner does; Alternate<...> rewrites the result per its
+// §8 attributes.
+
+// The trap path, kept out of line and cold so the caller's fast
+// path stays Silent's.
+template <typename T, flags_t Enabled>
+[[gnu::cold, gnu::noinline]] typename T::storage_type
+raiseTrap(typename T::storage_type bits, flags_t flags) {
+  const TrapTable<T> &table = trapTable<T>();
+  for (unsigned f = flags & Enabled; f != 0; f &= f - 1)
+    if (const TrapHandler<T> h = table.on[std::countr_zero(f)])
+      return h(bits, flags);
+  statusFlags() |= flags;
+  return bits;
+}
+
+template <typename E> inline constexpr bool isCounting = false;
+template <typename I>
+inline constexpr bool isCounting<exceptions::Counting<I>> = true;
+
+// Where a Counting Type's operations are counted: defined in
+// counting.hpp, so its registry, lock and strings stay out of every
+// kernel. A Counting Type used without that header fails to compile
+// on this incomplete type.
+template <typename T> struct OperationCounter;
+
+template <typename E> inline constexpr bool isAlternate = false;
+template <typename... H>
+inline constexpr bool isAlternate<exceptions::Alternate<H...>> = true;
+
+// The sign a SubstituteXor attribute gives its substitute. mul and
+// div pass §8.3's XOR of their operands' signs, which an invalid
+// product or quotient's default NaN does not carry; every other
+// site leaves it to the default result's own sign.
+enum class XorSign : std::uint8_t { OfResult, Plus, Minus };
+
+constexpr XorSign xorSign(bool sign) {
+  return sign ? XorSign::Minus : XorSign::Plus;
+}
+
+// Whether E (past a Counting wrapper) reads a XorSign, so a batch
+// loop computes one only when it is used.
+template <typename E>
+inline constexpr bool reads_xor_sign = isAlternate<E>;
+template <typename I>
+inline constexpr bool reads_xor_sign<exceptions::Counting<I>> =
+    reads_xor_sign<I>;
+
+// Applies an Alternate policy's attributes; defined after the
+// epilogue, whose packing helpers it uses.
+template <typename T, typename E> struct AlternateHandling;
+
+// E is T's Exceptions axis, or — past a Counting wrapper — the
+// policy it wraps.
+template <typename T, Operation Op, typename E = typename T::exceptions>
+constexpr auto deliver(typename T::storage_type bits, flags_t flags,
+                       XorSign xor_sign = XorSign::OfResult) {
+  if constexpr (isCounting<E>) {
+    if (!std::is_constant_evaluated())
+      OperationCounter<T>::record(Op, flags);
+    return deliver<T, Op, typename E::inner>(bits, flags, xor_sign);
+  } else if constexpr (std::is_same_v<E, exceptions::ReturnStatus>) {
     return WithStatus<T>{bits, flags};
+  } else if constexpr (isAlternate<E>) {
+    // Alternate's substitutes and abrupt underflow read and write
+    // the binary interchange encoding (exponent field, packSpecial).
+    static_assert(!is_decimal<typename T::number> &&
+                      !is_posit<typename T::number> &&
+                      !is_hex_float<typename T::number> &&
+                      !is_fixed_point<typename T::number>,
+                  "the Alternate exception policy is only supported on "
+                  "binary floating-point Types");
+    bits = AlternateHandling<T, E>::apply(bits, flags, xor_sign);
+    if constexpr (E::has_status_flags) {
+      if (!std::is_constant_evaluated())
+        statusFlags() |= flags;
+    }
+    return bits;
+  } else if constexpr (std::is_same_v<E, exceptions::Scoped>) {
+    if (!std::is_constant_evaluated())
+      scopedFlags() |= flags;
+    return bits;
+  } else if constexpr (E::has_traps) {
+    if ((flags & E::enabled) != 0) [[unlikely]] {
+      if (!std::is_constant_evaluated())
+        return raiseTrap<T, E::enabled>(bits, flags);
+    }
+    return bits;
   } else {
     if constexpr (E::has_status_flags) {
       if (!std::is_constant_evaluated())
@@ -175,11 +276,15 @@ constexpr typename T::storage_type packMaxFinite(bool sign) {
   using Storage = typename T::storage_type;
   constexpr int SigBits = Num::significand::digit_count;
   constexpr int MaxBiasedExp = max_biased_exp<T>;
+  if constexpr (is_fixed_point<Num>)
+    return fixedExtreme<T>(sign);
   UnpackedFloat<Storage> u{};
   u.category = ValueCategory::Finite;
   u.sign = sign;
   u.biased_exp = MaxBiasedExp;
   u.significand = wordOnes<Storage>(SigBits);
+  if constexpr (is_decimal<Num>)
+    u.significand = decimalPow10<Storage>(SigBits) - 1; // P nines
   if constexpr (Num::inf_encoding == InfEncoding::IntegerExtremes)
     // The all-ones pattern IS +Inf; max finite sits one below it.
     u.significand = wordSubSmall(u.significand, 1);
@@ -187,10 +292,14 @@ constexpr typename T::storage_type packMaxFinite(bool sign) {
 }
 
 // Inf when the format encodes it, max finite otherwise (the
-// oracle's EmitInfOrSaturate).
+// oracle's EmitInfOrSaturate). A posit has neither an infinity nor
+// a saturating reading of one: an infinite result (x ÷ 0, an
+// infinite source) is NaR.
 template <typename T>
 constexpr typename T::storage_type packInfOrSaturate(bool sign) {
-  if constexpr (T::number::inf_encoding != InfEncoding::None)
+  if constexpr (is_posit<typename T::number>)
+    return packSpecial<T>(ValueCategory::NaN, sign);
+  else if constexpr (T::number::inf_encoding != InfEncoding::None)
     return packSpecial<T>(ValueCategory::Infinity, sign);
   else
     return packMaxFinite<T>(sign);
@@ -234,6 +343,9 @@ constexpr typename T::storage_type packInfOrSaturate(bool sign) {
 //               format grid rounds up to the smallest normal is
 //               still tiny.
 template <typename T, typename Limb, int Count>
+  requires(!is_posit<typename T::number> &&
+           !is_hex_float<typename T::number> &&
+           !is_fixed_point<typename T::number>)
 constexpr typename T::storage_type
 roundAndPack(bool result_sign, int result_exp,
              DigitVector<Limb, Count> magnitude, flags_t &flags) {
@@ -381,6 +493,199 @@ roundAndPack(bool result_sign, int result_exp,
   return pack<T>(result);
 }
 
+// The posit epilogue: same precondition, but the rounding target is
+// found from the value. The magnitude's leading bit fixes the scale
+// (a kernel's short magnitude — cancellation — just sits lower),
+// the scale fixes the regime length, and roundPosit rounds to
+// whatever fraction width is left (pack_unpack.hpp). There is no
+// subnormal range, Inf or flush to decide: a value beyond maxpos
+// becomes maxpos (overflow), one below minpos becomes minpos
+// (underflow), both inexact.
+template <typename T, typename Limb, int Count>
+  requires is_posit<typename T::number>
+constexpr typename T::storage_type
+roundAndPack(bool result_sign, int result_exp,
+             DigitVector<Limb, Count> magnitude, flags_t &flags) {
+  using Num = typename T::number;
+  constexpr int SigBits = Num::significand::digit_count;
+  const int scale = result_exp - Num::exponent_bias - (SigBits - 1) -
+                    GuardBits + topBitPos(magnitude);
+  const PositRounding r =
+      roundPosit<Num::total_digits, Num::exponent_digits,
+                 typename T::rounding>(result_sign, scale, magnitude);
+  if (r.inexact)
+    flags |= FlagInexact;
+  if (r.clamped > 0)
+    flags |= FlagOverflow;
+  else if (r.clamped < 0)
+    flags |= FlagUnderflow;
+  return positFromPattern<T>(result_sign, r.pattern);
+}
+
+// The hex-float epilogue: same precondition, and like the posit one
+// it takes the scale from the magnitude's leading bit. The rounding
+// target follows from the scale: the leading bit's place in the top
+// hex digit decides how many of the 4·F fraction bits lie below it.
+// A round-up carry out of the top digit moves to the next
+// characteristic with fraction 0.1. Range is judged after rounding:
+// above 0.FF…F × 16^63 saturates (overflow), below 0.1 × 16^−64
+// gives the true zero, +0 (underflow) — what the hardware delivers
+// with its overflow and underflow interruptions masked. No
+// unnormalized result is ever produced.
+template <typename T, typename Limb, int Count>
+  requires is_hex_float<typename T::number>
+constexpr typename T::storage_type
+roundAndPack(bool result_sign, int result_exp,
+             DigitVector<Limb, Count> magnitude, flags_t &flags) {
+  using Num = typename T::number;
+  using DV = DigitVector<Limb, Count>;
+  constexpr int SigBits = Num::significand::digit_count;
+  const int top = topBitPos(magnitude);
+  const int scale = result_exp - Num::exponent_bias - (SigBits - 1) -
+                    GuardBits + top;
+  int characteristic = (scale >> 2) + Num::characteristic_bias + 1;
+  const int lead = SigBits - 4 + (scale & 3);
+
+  DV f;
+  bool guard = false, sticky = false;
+  if (top > lead) {
+    f = shiftRightDigits(magnitude, top - lead);
+    guard = bitAt(magnitude, top - lead - 1);
+    sticky = anyBitsBelow(magnitude, top - lead - 1);
+  } else {
+    f = shiftLeftDigits(magnitude, lead - top);
+  }
+  if (guard || sticky)
+    flags |= FlagInexact;
+  if (shouldRoundUp<typename T::rounding>(bitAt(f, 0), guard, false, sticky,
+                                          result_sign)) {
+    f = addDigits(f, digitsFrom<Limb, Count>(1));
+    if (topBitPos(f) >= SigBits) {
+      f = shiftRightDigits(f, 4);
+      characteristic += 1;
+    }
+  }
+
+  if (characteristic > 127) {
+    flags |= FlagOverflow | FlagInexact;
+    return packMaxFinite<T>(result_sign);
+  }
+  if (characteristic < 0) {
+    flags |= FlagUnderflow | FlagInexact;
+    return hexWord<T>(false, 0, 0);
+  }
+  return hexWord<T>(result_sign, characteristic,
+                    storageFromDigits<typename T::storage_type>(f));
+}
+
+// The fixed-point epilogue: same precondition, rounded to the ulp,
+// 2^−F, whatever the scale. A result beyond the word saturates
+// (overflow) under either OverflowMode — Wrap is integer arithmetic
+// on the word, which only the add/sub/mul/div kernels do — and a
+// nonzero result below the ulp that does not survive rounding
+// exactly is tiny (underflow). A negative result for an unsigned
+// word saturates to 0.
+template <typename T, typename Limb, int Count>
+  requires is_fixed_point<typename T::number>
+constexpr typename T::storage_type
+roundAndPack(bool result_sign, int result_exp,
+             DigitVector<Limb, Count> magnitude, flags_t &flags) {
+  using Num = typename T::number;
+  using DV = DigitVector<Limb, Count>;
+  constexpr int SigBits = Num::significand::digit_count;
+  const int top = topBitPos(magnitude);
+  const int scale = result_exp - Num::exponent_bias - (SigBits - 1) -
+                    GuardBits + top;
+  if (scale > Num::max_scale) {
+    flags |= FlagOverflow | FlagInexact;
+    return fixedExtreme<T>(result_sign);
+  }
+
+  // The ulp's bit in the magnitude.
+  const int ulp = top - (scale + Num::fraction_digits);
+  DV f;
+  bool guard = false, sticky = false;
+  if (ulp > 0) {
+    f = shiftRightDigits(magnitude, ulp);
+    guard = bitAt(magnitude, ulp - 1);
+    sticky = anyBitsBelow(magnitude, ulp - 1);
+  } else {
+    f = shiftLeftDigits(magnitude, -ulp);
+  }
+  if (guard || sticky) {
+    flags |= FlagInexact;
+    if (scale < -Num::fraction_digits)
+      flags |= FlagUnderflow;
+  }
+  if (shouldRoundUp<typename T::rounding>(bitAt(f, 0), guard, false, sticky,
+                                          result_sign))
+    f = addDigits(f, digitsFrom<Limb, Count>(1));
+
+  if (topBitPos(f) >= 64 ||
+      storageFromDigits<std::uint64_t>(f) > fixedLimit<T>(result_sign)) {
+    flags |= FlagOverflow | FlagInexact;
+    return fixedExtreme<T>(result_sign);
+  }
+  return fixedWord<T>(result_sign, storageFromDigits<std::uint64_t>(f));
+}
+
+// -----------------------------------------------------------------
+// §8 alternate exception handling
+// -----------------------------------------------------------------
+template <typename T, typename X>
+constexpr typename T::storage_type substituteValue(bool sign) {
+  using Num = typename T::number;
+  if constexpr (std::is_same_v<X, exceptions::substitutes::Zero>)
+    return packSpecial<T>(ValueCategory::Zero,
+                          Num::negative_zero == NegativeZero::Exists && sign);
+  else if constexpr (std::is_same_v<X, exceptions::substitutes::MaxFinite>)
+    return packMaxFinite<T>(sign);
+  else if constexpr (std::is_same_v<X, exceptions::substitutes::Infinity>)
+    return packInfOrSaturate<T>(sign);
+  else if constexpr (std::is_same_v<X, exceptions::substitutes::QuietNaN>)
+    return packSpecial<T>(ValueCategory::NaN, false);
+  else
+    return wordFromUint<typename T::storage_type>(X::bits);
+}
+
+// Replaces bits with H's substitute when H is a Substitute or
+// SubstituteXor listed for one of flags; says whether it did.
+template <typename T, typename H>
+constexpr bool substituteIf(typename T::storage_type &bits, flags_t flags,
+                            XorSign xor_sign) {
+  if constexpr (requires { H::on; }) {
+    if ((flags & H::on) != 0) {
+      const bool sign =
+          H::keeps_sign && (xor_sign == XorSign::OfResult
+                                ? unpackOperand<T>(bits).sign
+                                : xor_sign == XorSign::Minus);
+      bits = substituteValue<T, typename H::value>(sign);
+      return true;
+    }
+  }
+  return false;
+}
+
+template <typename T, typename... H>
+struct AlternateHandling<T, exceptions::Alternate<H...>> {
+  static constexpr typename T::storage_type
+  apply(typename T::storage_type bits, flags_t &flags, XorSign xor_sign) {
+    using Num = typename T::number;
+    if constexpr ((std::is_same_v<H, exceptions::AbruptUnderflow> || ...)) {
+      const auto u = unpackOperand<T>(bits);
+      if (u.category == ValueCategory::Finite &&
+          (u.biased_exp == 0 || (flags & FlagUnderflow) != 0)) {
+        flags |= FlagUnderflow | FlagInexact;
+        bits = packSpecial<T>(ValueCategory::Zero,
+                              Num::negative_zero == NegativeZero::Exists &&
+                                  u.sign);
+      }
+    }
+    (substituteIf<T, H>(bits, flags, xor_sign) || ...);
+    return bits;
+  }
+};
+
 } // namespace detail
 } // namespace opine
 
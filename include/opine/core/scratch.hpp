@@ -0,0 +1,107 @@
+#ifndef OPINE_CORE_SCRATCH_HPP
+#define OPINE_CORE_SCRATCH_HPP
+
+// Scratch storage for wide working integers.
+//
+// The exact decimal conversions (string.hpp) compute on fixed
+// DigitVector tiers up to 1024 limbs — 8 KiB per working integer,
+// a handful of them live at once. By default those live in one
+// stack frame of the converting call. A thread whose stack is small
+// (a worker pool, a coroutine, an embedded task) can lend them a
+// workspace instead:
+//
+//   static std::uint64_t buf[opine::decimalScratchLimbs];
+//   opine::ScratchScope scope(buf);     // this thread, this scope
+//   auto s = opine::toString<float1024>(x, 300); // works in buf
+//
+// While a scope is live, its thread's conversions take their working
+// integers from the buffer — a bump arena, released in LIFO order as
+// each conversion returns — and keep only small fixed frames on the
+// stack. A buffer too small for a tier is not an error: that tier
+// falls back to the stack. Nothing here allocates; scopes nest, each
+// restoring the workspace it displaced. A scope belongs to the
+// thread that opened it, like the StatusFlags accumulator.
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <span>
+
+#include "opine/core/digits.hpp"
+
+namespace opine {
+namespace detail {
+
+struct ScratchArena {
+  std::uint64_t *base = nullptr;
+  std::size_t limbs = 0; // capacity
+  std::size_t used = 0;
+  std::size_t peak = 0;  // high-water mark of used
+};
+
+// The workspace installed on this thread, or nullptr.
+inline ScratchArena *&installedScratch() {
+  thread_local ScratchArena *arena = nullptr;
+  return arena;
+}
+
+// The stack fallback gets a frame of its own, so a caller that took
+// the arena path does not carry the array in its frame too.
+template <int Limbs, int N, typename F>
+[[gnu::noinline]] auto withStackScratch(F &f) {
+  DigitVector<std::uint64_t, Limbs> v[N];
+  return f(v);
+}
+
+// Runs f(v) with v pointing at N uninitialized working integers of
+// Limbs limbs each: from this thread's workspace when it has room,
+// else from the stack. Returns what f returns.
+template <int Limbs, int N, typename F> auto withScratch(F &&f) {
+  using DV = DigitVector<std::uint64_t, Limbs>;
+  constexpr std::size_t Need = std::size_t(Limbs) * N;
+  static_assert(sizeof(DV) == Limbs * sizeof(std::uint64_t));
+  ScratchArena *arena = installedScratch();
+  if (arena == nullptr || arena->limbs - arena->used < Need)
+    return withStackScratch<Limbs, N>(f);
+
+  std::uint64_t *at = arena->base + arena->used;
+  for (int i = 0; i < N; ++i) // begin their lifetimes; no stores
+    ::new (static_cast<void *>(at + std::size_t(i) * Limbs)) DV;
+  DV *v = std::launder(reinterpret_cast<DV *>(at));
+  arena->used += Need;
+  if (arena->used > arena->peak)
+    arena->peak = arena->used;
+  struct Release {
+    ScratchArena *arena;
+    ~Release() { arena->used -= Need; }
+  } release{arena};
+  return f(v);
+}
+
+} // namespace detail
+
+// Installs buffer as this thread's conversion workspace until the
+// scope ends. See the header comment; decimalScratchLimbs
+// (string.hpp) is enough for every conversion.
+struct ScratchScope {
+  explicit ScratchScope(std::span<std::uint64_t> buffer)
+      : arena{buffer.data(), buffer.size(), 0, 0},
+        prev(detail::installedScratch()) {
+    detail::installedScratch() = &arena;
+  }
+  ~ScratchScope() { detail::installedScratch() = prev; }
+
+  ScratchScope(const ScratchScope &) = delete;
+  ScratchScope &operator=(const ScratchScope &) = delete;
+
+  // High-water mark so far, in limbs: what a buffer needs to be for
+  // the conversions run under this scope.
+  std::size_t peakLimbs() const { return arena.peak; }
+
+  detail::ScratchArena arena;
+  detail::ScratchArena *prev;
+};
+
+} // namespace opine
+
+#endif // OPINE_CORE_SCRATCH_HPP
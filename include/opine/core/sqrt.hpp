@@ -58,25 +58,25 @@ constexpr auto sqrt(typename T::storage_type a) {
   // ---------- Special value dispatch ----------
 
   if (ua.category == ValueCategory::NaN)
-    return detail::deliver<T>(
+    return detail::deliver<T, Operation::Sqrt>(
         detail::packSpecial<T>(ValueCategory::NaN, false), FlagNone);
 
   if (ua.category == ValueCategory::Zero)
     // §5.4.1: sqrt(±0) = ±0, operand sign preserved.
-    return detail::deliver<T>(
+    return detail::deliver<T, Operation::Sqrt>(
         detail::packSpecial<T>(ValueCategory::Zero, ua.sign), FlagNone);
 
   if (ua.category == ValueCategory::Infinity) {
     if (!ua.sign)
-      return detail::deliver<T>(
+      return detail::deliver<T, Operation::Sqrt>(
           detail::packSpecial<T>(ValueCategory::Infinity, false), FlagNone);
-    return detail::deliver<T>(
+    return detail::deliver<T, Operation::Sqrt>(
         detail::packSpecial<T>(ValueCategory::NaN, false), FlagInvalid);
   }
 
   if (ua.sign)
     // Negative finite: invalid operation (§7.2).
-    return detail::deliver<T>(
+    return detail::deliver<T, Operation::Sqrt>(
         detail::packSpecial<T>(ValueCategory::NaN, false), FlagInvalid);
 
   // ---------- Finite positive ----------
@@ -111,7 +111,7 @@ constexpr auto sqrt(typename T::storage_type a) {
 
   flags_t flags = FlagNone;
   auto bits = detail::roundAndPack<T>(false, q + Bias, magnitude, flags);
-  return detail::deliver<T>(bits, flags);
+  return detail::deliver<T, Operation::Sqrt>(bits, flags);
 }
 
 } // namespace opine
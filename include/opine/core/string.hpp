@@ -1,17 +1,38 @@
 #ifndef OPINE_CORE_STRING_HPP
 #define OPINE_CORE_STRING_HPP
 
-// Decimal and hex string conversion for FloatingPoint Types.
+// Decimal and hex string conversion for FloatingPoint Types with a
+// binary significand — binary, posit, HFP and fixed point. Decimal
+// Types (decimal.hpp) are excluded by constraint: every kernel here
+// reads the significand as m · 2^e.
 //
 //   toString<T>(bits, digits)   — correctly rounded decimal,
 //                                 %g-style (positional or scientific,
 //                                 trailing zeros trimmed).
+//   toShortestString<T>(bits)   — the shortest decimal that parses
+//                                 back to the same bits, same style.
 //   fromString<T>(text)         — correctly rounded parse, honoring
 //                                 T's Rounding axis and delivering
 //                                 IEEE 754 flags through T's
-//                                 Exceptions axis.
+//                                 Exceptions axis; decimal or hex.
 //   toHexString<T>(bits)        — exact C hex-float (%a-style), any
-//                                 width, no rounding at all.
+//                                 width, no rounding at all; reads
+//                                 back bit-exact.
+//   toChars<T>(first, last, …)  — std::to_chars-style: any of the
+//                                 above (or fixed / scientific /
+//                                 hex with a precision) into a
+//                                 caller's buffer, no allocation.
+//   fromChars<T>(first, last)   — std::from_chars-style: parses a
+//                                 literal prefix in place, no
+//                                 allocation.
+//   parseMany<T>(buffer, out)   — every number in whitespace- or
+//                                 comma-separated text, in bulk.
+//   streamDigits<T>(bits, sink) — the exact decimal expansion,
+//                                 chunk by chunk, stoppable and
+//                                 roundable at any digit.
+//
+// The std::string forms are thin wrappers: toChars into a stack
+// buffer, fromString = fromChars that must consume everything.
 //
 // Method: the exact big-integer school. A finite value is
 // m · 2^e with integral m, so its D-digit decimal significand is
@@ -19,8 +40,8 @@
 // and every factor splits into powers of 2 (shifts) and powers of 5
 // (exact DigitVector multiplies, or one division with the remainder
 // deciding the round). No floating-point intermediates, no
-// precomputed tables, no correctness-by-benchmark: each conversion
-// is one exact integer computation. fromString runs the same recipe
+// correctness-by-benchmark: each conversion is one exact integer
+// computation. fromString runs the same recipe
 // backwards and hands (sign, exponent, magnitude-with-G/R/S) to
 // roundAndPack — decimal parsing is a conversion kernel, so it
 // inherits subnormals, §7.4 overflow, denormal flushing, and
@@ -28,26 +49,67 @@
 //
 // The working integers grow with the value's binary exponent
 // (~1.7·|e| bits), dispatched over fixed DigitVector tiers up to
-// 2^17 bits. That covers every value of every format through
+// 2^16 bits. That covers every value of every format through
 // float128/extFloat80 (|e| ≤ 16494), and all wide-format values
-// with decimal exponent within about ±19,700. Beyond the window —
-// possible only for binary256/512/1024 — toString falls back to the
-// exact hex form and fromString reports Invalid: correctly rounded
-// decimal at 10^±20,000,000 needs multi-megabit multiplication,
-// which is specialized-backend territory, not a place to guess.
+// with decimal exponent within about ±19,700. Past that window —
+// binary256/512/1024, or a parse like "1e-100000" into any format —
+// a bounded tier takes over: 5^t as a fixed-width interval rather
+// than a multi-megabit integer, the conversion evaluated at both of
+// its ends, and the answer taken only where the two agree. It needs
+// no wide multiply and no heap: ~27 squarings of at most 128 limbs.
+//
+// What that guarantees, past the window: toString decides unless the
+// value's decimal expansion sits within about 2^-(4P) of a digit
+// tie, which a binary value that far out all but never does. When it
+// cannot decide, it prints the exact hex form. fromString decides
+// every literal except those that agree with a rounding boundary
+// (a binary midpoint, or a representable value under a directed
+// mode) to their first 4·P·log10(2) + 28 significant digits. Such a
+// literal parses as a quiet NaN with Invalid, and fromChars reports
+// result_out_of_range. An exact midpoint written out in full is the
+// natural case: 2^69763 · (2^237 + 1) into float256.
+//
+// The exact tiers' working integers — at most six of them, 8 KiB
+// each at the widest tier — live in one stack frame per conversion,
+// or in a caller's workspace when its thread has one installed
+// (ScratchScope, scratch.hpp; decimalScratchLimbs covers every
+// conversion). Each kernel computes in place within its fixed set,
+// so nothing else wide is ever on the stack.
+//
+// toShortestString has a second, table-driven tier for formats up
+// to binary64 precision: a Schubfach-style pass over 128-bit powers
+// of five (decimal_powers.hpp) that decides from one 64×128
+// multiply in the common case and hands every decision it cannot
+// prove to the exact tier. Both tiers define the same output.
+// fromString has the mirror image: an Eisel–Lemire pass over the
+// same table for inputs of up to 19 significant digits into formats
+// whose working magnitude fits 64 bits. It produces the leading
+// bits and an exact sticky bit, so the shared epilogue rounds it in
+// any mode and raises the same flags; whatever it cannot decide
+// goes to the exact tier.
 //
 // toString rounds its last digit to nearest, ties to even (the
 // printf convention), independent of T's Rounding axis; parse
 // honors the axis. Special values: "inf", "-inf", "nan", and zeros
 // render as "0" / "-0".
 
+#include <bit>
+#include <charconv>
 #include <cstdint>
+#include <cstring>
+#include <limits>
+#include <span>
 #include <string>
 #include <string_view>
+#include <system_error>
+#include <utility>
 
+#include "opine/core/decimal_powers.hpp"
 #include "opine/core/digits.hpp"
 #include "opine/core/pack_unpack.hpp"
 #include "opine/core/round_pack.hpp"
+#include "opine/core/scratch.hpp"
+#include "opine/core/type.hpp"
 
 namespace opine {
 
@@ -59,6 +121,11 @@ inline constexpr int roundTripDigits =
         100000) +
     1;
 
+// Workspace, in limbs, that every conversion here fits at its
+// widest tier: six working integers of 1024 limbs (48 KiB). Size a
+// ScratchScope buffer with it.
+inline constexpr std::size_t decimalScratchLimbs = 6 * 1024;
+
 namespace detail {
 
 // -----------------------------------------------------------------
@@ -84,20 +151,53 @@ template <typename F> bool withDecimalBudget(long need_bits, F &&f) {
   return false;
 }
 
-// 5^n, exact, by repeated squaring. Fits by budget construction.
+// 5^n, exact, into out. Fits by budget construction. Below
+// Pow5ExactTableLimit (everything the 32-limb tier can hold) it is
+// assembled from the compile-time tables in one or two multiplies;
+// past it, the 320- and 1024-limb tiers raise the 5^Pow5ExactTableLimit
+// block by squaring — a handful of wide products in place of one per
+// bit of n — and fold in the tabled remainder. The products
+// ping-pong between out and the caller's two spare vectors, so no
+// wide temporary is ever on the stack.
 template <int Limbs>
-DigitVector<std::uint64_t, Limbs> pow5Digits(long n) {
+void pow5DigitsInto(DigitVector<std::uint64_t, Limbs> &out, long n,
+                    DigitVector<std::uint64_t, Limbs> &spare1,
+                    DigitVector<std::uint64_t, Limbs> &spare2) {
   using DV = DigitVector<std::uint64_t, Limbs>;
-  DV result = digitsFrom<std::uint64_t, Limbs>(1);
-  DV base = digitsFrom<std::uint64_t, Limbs>(5);
-  while (n > 0) {
-    if (n & 1)
-      result = resizeDigits<Limbs>(mulDigits(result, base));
-    n >>= 1;
-    if (n)
-      base = resizeDigits<Limbs>(mulDigits(base, base));
+  const long hi = n / Pow5ExactTableLimit;
+  const long lo = n % Pow5ExactTableLimit;
+  const int a = int(lo / Pow5BigStep);
+  const Pow5Mid mid = pow5BelowBigStep(int(lo % Pow5BigStep));
+  if (a == 0)
+    resizeDigitsInto(out, mid);
+  else
+    mulDigitsInto(out, pow5Big(a), mid);
+  if (hi == 0)
+    return;
+
+  DV *result = &out, *base = &spare1, *tmp = &spare2;
+  mulDigitsInto(*base, pow5Big(Pow5BigCount - 1),
+                pow5Big(1)); // 5^Pow5ExactTableLimit
+  for (long e = hi;;) {
+    if (e & 1) {
+      mulDigitsInto(*tmp, *result, *base);
+      std::swap(result, tmp);
+    }
+    e >>= 1;
+    if (e == 0)
+      break;
+    mulDigitsInto(*tmp, *base, *base);
+    std::swap(base, tmp);
   }
-  return result;
+  if (result != &out)
+    out = *result;
+}
+
+template <int Limbs>
+DigitVector<std::uint64_t, Limbs> pow5Digits(long n) {
+  DigitVector<std::uint64_t, Limbs> out, spare1, spare2;
+  pow5DigitsInto(out, n, spare1, spare2);
+  return out;
 }
 
 // floor(x · log10 2) for |x| up to ~2^40, exact enough to land the
@@ -107,14 +207,68 @@ inline long floorLog10Pow2(long x) {
   return long(p >= 0 ? p / 100000 : (p - 99999) / 100000);
 }
 
-// Round an integer with explicit guard/sticky to nearest, ties to
-// even. `q` is the truncated integer; the discarded part is (guard,
-// sticky).
-template <typename DV>
-DV roundNearestEven(DV q, bool guard, bool sticky) {
-  if (guard && (sticky || bitAt(q, 0)))
-    return addDigits(q, digitsFrom<typename DV::limb_type, DV::limb_count>(1));
-  return q;
+// -----------------------------------------------------------------
+// Past the window: two-sided bounds on 5^t
+// -----------------------------------------------------------------
+// Outside the exact tiers' reach, 5^t is carried as an interval of
+// fixed width instead of an exact integer:
+//
+//   sig · 2^exp2  ≤  5^t  ≤  (sig + err) · 2^exp2,   2^(W-1) ≤ sig < 2^W
+//
+// built by left-to-right binary powering, truncating after each
+// step and widening err to cover what was dropped. The accounting
+// grows err by at most three bits per binary digit of t, so even
+// |t| near 2^27 — past every format's range — costs under 90 of W
+// bits. A caller
+// evaluates its rounding at both ends of the interval and accepts
+// only what they agree on; the rest stays out of the window, as
+// before. Like pow5Table (decimal_powers.hpp): a wrong bound could
+// only make it give up, never give a wrong digit.
+template <int Limbs> struct Pow5Bound {
+  DigitVector<std::uint64_t, Limbs> sig;
+  long exp2 = 0;
+  DigitVector<std::uint64_t, 2> err; // in units of sig's last place
+};
+
+template <int Limbs> bool pow5Bound(long t, Pow5Bound<Limbs> &b) {
+  using DV = DigitVector<std::uint64_t, Limbs>;
+  using Wide = DigitVector<std::uint64_t, Limbs + 1>;
+  constexpr int W = DV::total_bits;
+  const unsigned long n = t < 0 ? 0UL - (unsigned long)(t) : (unsigned long)(t);
+  b.sig = withBit(DV{}, W - 1);
+  b.exp2 = -(W - 1);
+  b.err = {};
+  const auto two = digitsFrom<std::uint64_t, 2>(2);
+  for (int i = std::bit_width(n) - 1; i >= 0; --i) {
+    // Square: sig² ≥ 2^(2W-2) drops at least W-1 bits, so the
+    // upper end adds under 4·err, plus one for the truncation and
+    // one for err² (< 2^240 ≪ 2^(W-1)).
+    const auto sq = mulDigits(b.sig, b.sig);
+    const int sh = topBitPos(sq) - (W - 1);
+    b.sig = resizeDigits<Limbs>(shiftRightDigits(sq, sh));
+    b.exp2 = 2 * b.exp2 + sh;
+    b.err = addDigits(shiftLeftDigits(b.err, 2), two);
+    if ((n >> i) & 1) {
+      Wide w;
+      int down;
+      if (t > 0) { // ×5, dropping 2 or 3 bits: err·5/4 + 1
+        w = mulSmallDigits(resizeDigits<Limbs + 1>(b.sig), std::uint64_t{5});
+        down = 0;
+      } else { // ÷5 as ⌊8·sig/5⌋, dropping 0 or 1: err·8/5 + 2
+        w = divModSmallDigits(shiftLeftDigits(resizeDigits<Limbs + 1>(b.sig), 3),
+                              std::uint64_t{5})
+                .quot;
+        down = 3;
+      }
+      const int s2 = topBitPos(w) - (W - 1);
+      b.sig = resizeDigits<Limbs>(shiftRightDigits(w, s2));
+      b.exp2 += s2 - down;
+      b.err = addDigits(shiftLeftDigits(b.err, 1), two);
+    }
+    if (topBitPos(b.err) >= 120)
+      return false;
+  }
+  return true;
 }
 
 // -----------------------------------------------------------------
@@ -122,31 +276,94 @@ DV roundNearestEven(DV q, bool guard, bool sticky) {
 // -----------------------------------------------------------------
 // Result: value ≈ (neg ? -1 : 1) · 0.d1d2…dD · 10^(k10+1) with the
 // digit string correctly rounded to D digits (nearest, ties even).
+// The digits live in the struct, so producing them never touches
+// the heap.
+inline constexpr int MaxDecimalDigits = 1000; // digit-extraction bound
+
 struct DecimalDigits {
   bool neg = false;
-  std::string digits; // exactly D characters '0'-'9'
-  long k10 = 0;       // exponent of the leading digit: d1 · 10^k10
-  bool ok = false;    // false: out of the supported window
+  char buf[MaxDecimalDigits]; // '0'-'9', len of them
+  int len = 0;
+  long k10 = 0;    // exponent of the leading digit: d1 · 10^k10
+  bool ok = false; // false: out of the supported window
+
+  std::string_view digits() const { return {buf, std::size_t(len)}; }
 };
 
-// One attempt at a given decimal exponent k. Returns the rounded
-// D-digit integer N with 10^(D-1) <= N < 10^D when k was right;
-// the caller nudges k when the estimate was off by one.
+// Exactly width digits of n < 10^width into buf, leading zeros kept.
+// Divide and conquer: one long division by 10^(width/2) — a table
+// power (decimal_powers.hpp) shifted — splits n into halves that
+// recurse at half the limbs, so the work is a few divisions per
+// level instead of one full-width pass per 18 digits. Below a few
+// limbs, 18-digit chunks by short division finish it.
 template <int Limbs>
-bool decimalAttempt(const DigitVector<std::uint64_t, Limbs> &m, long e, int D,
-                    long k, DigitVector<std::uint64_t, Limbs> &n_out) {
+void fixedWidthDigits(const DigitVector<std::uint64_t, Limbs> &n, int width,
+                      char *buf) {
   using DV = DigitVector<std::uint64_t, Limbs>;
+  if constexpr (Limbs > 8) {
+    if (width > 72) {
+      // Each half is below 10^ceil(width/2), which fits Half limbs
+      // whenever n < 10^width fits Limbs.
+      constexpr int Half = Limbs / 2 + 1;
+      const int lo_width = width / 2;
+      const DV p10 = shiftLeftDigits(pow5Digits<Limbs>(lo_width), lo_width);
+      const auto dm = divModLongDigits(n, p10);
+      fixedWidthDigits(resizeDigits<Half>(dm.quot), width - lo_width, buf);
+      fixedWidthDigits(resizeDigits<Half>(dm.rem), lo_width,
+                       buf + (width - lo_width));
+      return;
+    }
+  }
+  DV v = n;
+  for (int pos = width; pos > 0;) {
+    auto dm = divModSmallDigits(v, std::uint64_t{1000000000000000000ULL});
+    std::uint64_t chunk = dm.rem;
+    v = dm.quot;
+    for (int i = 0; i < 18 && pos > 0; ++i) {
+      buf[--pos] = char('0' + chunk % 10);
+      chunk /= 10;
+    }
+  }
+}
+
+// The decimal digits of n into buf, most significant first; returns
+// how many (none for zero). n < 10^MaxDecimalDigits.
+template <int Limbs>
+int integerDigits(const DigitVector<std::uint64_t, Limbs> &n, char *buf) {
+  const int top = topBitPos(n);
+  if (top < 0)
+    return 0;
+  // n < 2^(top+1), so it has at most this many digits.
+  const int width = int(floorLog10Pow2(top + 1)) + 1;
+  fixedWidthDigits(n, width, buf);
+  int lead = 0;
+  while (buf[lead] == '0')
+    ++lead;
+  std::memmove(buf, buf + lead, std::size_t(width - lead));
+  return width - lead;
+}
+
+// One attempt at a given decimal exponent k. Leaves in n the
+// rounded D-digit integer N with 10^(D-1) <= N < 10^D when k was
+// right; the caller nudges k when the estimate was off by one. w is
+// three spare working integers.
+template <int Limbs, int ML>
+void decimalAttempt(const DigitVector<std::uint64_t, ML> &m, long e, int D,
+                    long k, DigitVector<std::uint64_t, Limbs> &n,
+                    DigitVector<std::uint64_t, Limbs> *w) {
   const long t = long(D) - 1 - k; // N = round(m · 2^(e+t) · 5^t)
   if (t >= 0) {
-    DV scaled = resizeDigits<Limbs>(mulDigits(m, pow5Digits<Limbs>(t)));
+    pow5DigitsInto(w[0], t, w[1], w[2]);
+    mulDigitsInto(n, m, w[0]);
     const long shift = e + t;
     if (shift >= 0) {
-      n_out = shiftLeftDigits(scaled, int(shift)); // exact
+      shiftLeftDigitsInPlace(n, int(shift)); // exact
     } else {
-      const bool guard = bitAt(scaled, int(-shift) - 1);
-      const bool sticky = anyBitsBelow(scaled, int(-shift) - 1);
-      n_out = roundNearestEven(shiftRightDigits(scaled, int(-shift)), guard,
-                               sticky);
+      const bool guard = bitAt(n, int(-shift) - 1);
+      const bool sticky = anyBitsBelow(n, int(-shift) - 1);
+      shiftRightDigitsInPlace(n, int(-shift));
+      if (guard && (sticky || bitAt(n, 0))) // nearest, ties to even
+        addSmallDigitsInPlace(n, std::uint64_t{1});
     }
   } else {
     // N = m · 2^(e+t) / 5^(-t). e + t is usually positive (large
@@ -155,84 +372,224 @@ bool decimalAttempt(const DigitVector<std::uint64_t, Limbs> &m, long e, int D,
     // joins the divisor instead. Round via the remainder: 2·rem vs
     // divisor, ties to even.
     const long sh = e + t;
-    DV num = sh >= 0 ? shiftLeftDigits(m, int(sh)) : m;
-    DV den = pow5Digits<Limbs>(-t);
+    auto &num = w[1], &den = w[0];
+    pow5DigitsInto(den, -t, w[1], w[2]);
     if (sh < 0)
-      den = shiftLeftDigits(den, int(-sh));
-    auto dm = divModDigits(num, den);
-    const DV twice = shiftLeftDigits(dm.rem, 1);
-    int cmp = compareDigits(twice, den);
-    bool up = cmp > 0 || (cmp == 0 && bitAt(dm.quot, 0));
-    n_out = up ? addDigits(dm.quot, digitsFrom<std::uint64_t, Limbs>(1))
-               : dm.quot;
+      shiftLeftDigitsInPlace(den, int(-sh));
+    resizeDigitsInto(num, m);
+    if (sh >= 0)
+      shiftLeftDigitsInPlace(num, int(sh));
+    divModLongDigitsInPlace(num, den, n); // num: the remainder
+    shiftLeftDigitsInPlace(num, 1);
+    const int cmp = compareDigits(num, den);
+    if (cmp > 0 || (cmp == 0 && bitAt(n, 0)))
+      addSmallDigitsInPlace(n, std::uint64_t{1});
   }
-  return true;
 }
 
+// Where n stands against 10^(D-1) and 10^D: -1 below, +1 at or
+// above, 0 between. The powers are at most MaxDecimalDigits digits,
+// so they stay small whatever the working width.
+inline constexpr int DecimalLimbs = (MaxDecimalDigits * 10 / 3 + 1) / 64 + 2;
+
+template <int Limbs>
+int decadeOf(const DigitVector<std::uint64_t, Limbs> &n, int D) {
+  using Small = DigitVector<std::uint64_t, DecimalLimbs>;
+  if (topBitPos(n) >= Small::total_bits)
+    return 1;
+  const Small v = resizeDigits<DecimalLimbs>(n);
+  if (compareDigits(v, shiftLeftDigits(pow5Digits<DecimalLimbs>(D), D)) >= 0)
+    return 1;
+  return compareDigits(
+             v, shiftLeftDigits(pow5Digits<DecimalLimbs>(D - 1), D - 1)) < 0
+             ? -1
+             : 0;
+}
+
+// The working integers: n and decimalAttempt's three, from the
+// thread's scratch workspace when one is installed.
+inline constexpr int AttemptVectors = 4;
+
 template <typename T, int Limbs>
 void decimalFromUnpacked(const UnpackedFloat<typename T::storage_type> &u,
                          int D, DecimalDigits &out) {
   using DV = DigitVector<std::uint64_t, Limbs>;
   using Num = typename T::number;
   constexpr int P = Num::significand::digit_count;
+  constexpr int ML = (P + 63) / 64;
 
-  DV m = digitsFromStorage<std::uint64_t, Limbs>(u.significand);
+  const auto m = digitsFromStorage<std::uint64_t, ML>(u.significand);
   const int eff = (u.biased_exp == 0) ? 1 : u.biased_exp;
   const long e = long(eff) - Num::exponent_bias - (P - 1); // value = m · 2^e
 
-  // Decimal exponent estimate from the value's binary magnitude.
-  long k = floorLog10Pow2(e + topBitPos(m));
+  withScratch<Limbs, AttemptVectors>([&](DV *w) {
+    // Decimal exponent estimate from the value's binary magnitude,
+    // then the correction loop.
+    long k = floorLog10Pow2(e + topBitPos(m));
+    DV &n = w[0];
+    for (int tries = 0; tries < 4; ++tries) {
+      decimalAttempt(m, e, D, k, n, w + 1);
+      const int decade = decadeOf(n, D);
+      if (decade == 0)
+        break;
+      k += decade;
+    }
 
-  // 10^(D-1) and 10^D bounds for the correction loop.
-  const DV pow10_dm1 = shiftLeftDigits(pow5Digits<Limbs>(D - 1), D - 1);
-  const DV pow10_d = shiftLeftDigits(pow5Digits<Limbs>(D), D);
+    // Extract decimal digits from the (small) integer N, ≤ ~3.33·D
+    // bits.
+    int len = integerDigits(resizeDigits<64>(n), out.buf);
+    // Defensive: the correction loop guarantees exactly D digits.
+    if (len > D)
+      len = D;
+    while (len < D)
+      out.buf[len++] = '0';
 
-  DV n{};
+    out.neg = u.sign;
+    out.len = len;
+    out.k10 = k;
+    out.ok = true;
+  });
+}
+
+// Fixed-point digits: N = round(value · 10^p), nearest-even, all of
+// its digits (none when it rounds to zero); k10 then places the
+// last one at 10^-p.
+template <typename T, int Limbs>
+void fixedFromUnpacked(const UnpackedFloat<typename T::storage_type> &u,
+                       int p, DecimalDigits &out) {
+  using DV = DigitVector<std::uint64_t, Limbs>;
+  using Num = typename T::number;
+  constexpr int P = Num::significand::digit_count;
+  constexpr int ML = (P + 63) / 64;
+
+  const auto m = digitsFromStorage<std::uint64_t, ML>(u.significand);
+  const int eff = (u.biased_exp == 0) ? 1 : u.biased_exp;
+  const long e = long(eff) - Num::exponent_bias - (P - 1); // value = m · 2^e
+
+  // decimalAttempt scales by 10^(D-1-k); D = p + 1, k = 0 is 10^p.
+  withScratch<Limbs, AttemptVectors>([&](DV *w) {
+    decimalAttempt(m, e, p + 1, 0, w[0], w + 1);
+    out.neg = u.sign;
+    out.len = integerDigits(resizeDigits<64>(w[0]), out.buf);
+    out.k10 = long(out.len) - 1 - p;
+    out.ok = true;
+  });
+}
+
+// decimalFromUnpacked's recipe past the window: N = round(m · 5^t ·
+// 2^(e+t)) from both ends of a Pow5Bound, accepted when they agree
+// and the lower end is not a possible tie (out there ties cannot
+// happen — m · 5^t · 2^(e+t) is never a half-integer once 5^t
+// outgrows m — but nothing here relies on it). With inside set,
+// also decide whether N · 10^-t lies in the round-trip interval of
+// x = m · 2^e (see the shortest section): 2m·N against (2m ± 1)·v,
+// or 4m·N against (4m - 1)·v below a binade boundary, at both ends
+// of v. Anything undecided leaves out.ok false.
+template <typename T, int Limbs>
+void decimalFromBounds(const UnpackedFloat<typename T::storage_type> &u,
+                       int D, DecimalDigits &out, bool *inside = nullptr) {
+  using DV = DigitVector<std::uint64_t, Limbs>;
+  using Num = typename T::number;
+  constexpr int P = Num::significand::digit_count;
+  constexpr int ML = (P + 63) / 64;
+  constexpr int PL = Limbs + 1 + ML; // m · (sig + err)
+  constexpr int XL = PL + ML + 2;    // those times 4m, or N · 4m · 2^cut
+  using Prod = DigitVector<std::uint64_t, PL>;
+  using X = DigitVector<std::uint64_t, XL>;
+
+  const auto m = digitsFromStorage<std::uint64_t, ML>(u.significand);
+  const int eff = (u.biased_exp == 0) ? 1 : u.biased_exp;
+  const long e = long(eff) - Num::exponent_bias - (P - 1); // value = m · 2^e
+
+  long k = floorLog10Pow2(e + topBitPos(m));
   for (int tries = 0; tries < 4; ++tries) {
-    decimalAttempt<Limbs>(m, e, D, k, n);
-    if (compareDigits(n, pow10_d) >= 0) {
-      ++k;
-      continue;
-    }
-    if (compareDigits(n, pow10_dm1) < 0) {
-      --k;
+    const long t = long(D) - 1 - k;
+    Pow5Bound<Limbs> f;
+    if (!pow5Bound(t, f))
+      return;
+    // 2v = m · 5^t · 2^(e+t+1) ∈ [lo, hi] · 2^-cut
+    const Prod lo = resizeDigits<PL>(mulDigits(f.sig, m));
+    const Prod hi = mulDigits(addDigits(resizeDigits<Limbs + 1>(f.sig),
+                                        resizeDigits<Limbs + 1>(f.err)),
+                              m);
+    const long cut = -(f.exp2 + e + t + 1);
+    if (cut < 1 || cut >= Prod::total_bits)
+      return;
+    const Prod twice = shiftRightDigits(lo, int(cut));
+    if (!(twice == shiftRightDigits(hi, int(cut))) ||
+        !anyBitsBelow(lo, int(cut)))
+      return;
+    const DV n = resizeDigits<Limbs>(shiftRightDigits(
+        addDigits(twice, digitsFrom<std::uint64_t, PL>(1)), 1));
+    if (const int decade = decadeOf(n, D); decade != 0) {
+      k += decade;
       continue;
     }
-    break;
-  }
-
-  // Extract decimal digits from the (small) integer N.
-  DigitVector<std::uint64_t, 64> small =
-      resizeDigits<64>(n); // ≤ ~3.33·D bits
-  const auto ten18 = digitsFrom<std::uint64_t, 64>(1000000000000000000ULL);
-  std::string s;
-  while (!isZero(small)) {
-    auto dm = divModDigits(small, ten18);
-    std::uint64_t chunk = lowUint64(dm.rem);
-    small = dm.quot;
-    const bool last = isZero(small);
-    for (int i = 0; i < 18 && (chunk != 0 || !last); ++i) {
-      s.push_back(char('0' + chunk % 10));
-      chunk /= 10;
+
+    if (inside != nullptr) {
+      // v = [lo, hi] · 2^-(cut+1); compare N · Q · 2^(cut+1) with
+      // V · (Q ± 1) at both ends.
+      const bool boundary = u.biased_exp > 1 && topBitPos(m) == P - 1 &&
+                            !anyBitsBelow(m, P - 1);
+      const auto m1 = resizeDigits<ML + 1>(m);
+      const auto q_up = shiftLeftDigits(m1, 1);
+      const auto q_dn = shiftLeftDigits(m1, boundary ? 2 : 1);
+      const auto one = digitsFrom<std::uint64_t, ML + 1>(1);
+      const X n_up =
+          shiftLeftDigits(resizeDigits<XL>(mulDigits(n, q_up)), int(cut + 1));
+      const X n_dn =
+          shiftLeftDigits(resizeDigits<XL>(mulDigits(n, q_dn)), int(cut + 1));
+      const auto above = [](const X &a, const X &b) {
+        return compareDigits(a, b) > 0;
+      };
+      const auto up_lo =
+          resizeDigits<XL>(mulDigits(lo, addDigits(q_up, one)));
+      const auto up_hi =
+          resizeDigits<XL>(mulDigits(hi, addDigits(q_up, one)));
+      const auto dn_lo = resizeDigits<XL>(mulDigits(lo, subDigits(q_dn, one)));
+      const auto dn_hi = resizeDigits<XL>(mulDigits(hi, subDigits(q_dn, one)));
+      const bool below_top = above(up_lo, n_up);   // N < v + h, surely
+      const bool past_top = !above(up_hi, n_up);   // surely not
+      const bool above_bottom = above(n_dn, dn_hi); // N > v - h, surely
+      const bool under_bottom = !above(n_dn, dn_lo);
+      if (past_top || under_bottom)
+        *inside = false;
+      else if (below_top && above_bottom)
+        *inside = true;
+      else
+        return;
     }
-    if (last && chunk == 0 && s.empty())
-      s.push_back('0');
+
+    int len = integerDigits(resizeDigits<64>(n), out.buf);
+    while (len < D)
+      out.buf[len++] = '0';
+    out.neg = u.sign;
+    out.len = len;
+    out.k10 = k;
+    out.ok = true;
+    return;
   }
-  std::string digits(s.rbegin(), s.rend());
-  // Defensive: the correction loop guarantees exactly D digits.
-  if (int(digits.size()) > D)
-    digits.resize(D);
-  while (int(digits.size()) < D)
-    digits.push_back('0');
+}
 
-  out.neg = u.sign;
-  out.digits = std::move(digits);
-  out.k10 = k;
-  out.ok = true;
+// The bounded tier's working width. A value can sit within about
+// 2^-P of a D-digit rounding boundary (x itself rounded from a short
+// decimal, say), so 5^t needs P + 3.33·D bits plus 90 of error
+// growth and a margin; f reports whether it decided, and an
+// undecided conversion retries at the next width up.
+template <typename T, typename F> void withBoundedBudget(int D, F &&f) {
+  constexpr long P = T::number::significand::digit_count;
+  const long need = P + (10L * D) / 3 + 192;
+  auto tier = [&](auto limbs) {
+    return decltype(limbs)::value * 64L >= need && f(limbs);
+  };
+  (void)(tier(std::integral_constant<int, 16>{}) ||
+         tier(std::integral_constant<int, 32>{}) ||
+         tier(std::integral_constant<int, 64>{}) ||
+         tier(std::integral_constant<int, 128>{}));
 }
 
-// Correctly rounded D-digit decimal decomposition, or ok=false when
-// the value's exponent exceeds the supported window.
+// Correctly rounded D-digit decimal decomposition: the exact tiers,
+// then the bounded one; ok=false only when that cannot decide.
 template <typename T>
 DecimalDigits decimalDigits(typename T::storage_type bits, int D) {
   using Num = typename T::number;
@@ -252,301 +609,1709 @@ DecimalDigits decimalDigits(typename T::storage_type bits, int D) {
   bool fit = withDecimalBudget(need, [&](auto limbs) {
     decimalFromUnpacked<T, decltype(limbs)::value>(u, D, out);
   });
-  out.ok = out.ok && fit;
+  if (!fit)
+    withBoundedBudget<T>(D, [&](auto limbs) {
+      decimalFromBounds<T, decltype(limbs)::value>(u, D, out);
+      return out.ok;
+    });
   return out;
 }
 
-} // namespace detail
+// Fixed-point decomposition with p digits after the point, or
+// ok=false when that takes more than MaxDecimalDigits digits or
+// leaves the window.
+template <typename T>
+DecimalDigits fixedDigits(typename T::storage_type bits, int p) {
+  using Num = typename T::number;
+  constexpr int P = Num::significand::digit_count;
+
+  DecimalDigits out;
+  const auto u = detail::unpackOperand<T>(bits);
+  if (u.category != ValueCategory::Finite)
+    return out;
+
+  const int eff = (u.biased_exp == 0) ? 1 : u.biased_exp;
+  const long e = long(eff) - Num::exponent_bias - (P - 1);
+  // Leading digit at 10^k, k within one of this estimate.
+  const long k = floorLog10Pow2(e + topBitPos(digitsFromStorage<
+                                            std::uint64_t, (P + 63) / 64>(
+                                        u.significand)));
+  const long D = k + 2 + p; // digits of N, at most
+  if (D > MaxDecimalDigits)
+    return out;
+  if (D < 0) { // below half a unit of 10^-p: rounds to zero
+    out.neg = u.sign;
+    out.k10 = -1 - p;
+    out.ok = true;
+    return out;
+  }
+  const long ea = e < 0 ? -e : e;
+  const long need = (3 * ea) / 4 + 4L * (D + 1) + P + 96;
+  bool fit = withDecimalBudget(need, [&](auto limbs) {
+    fixedFromUnpacked<T, decltype(limbs)::value>(u, p, out);
+  });
+  out.ok = out.ok && fit;
+  return out;
+}
 
 // -----------------------------------------------------------------
-// toHexString — exact C hex-float, any width
+// Shortest round-trip digits (the toShortestString core)
 // -----------------------------------------------------------------
-template <typename T> std::string toHexString(typename T::storage_type bits) {
+// x = c · 2^q rounds back from every decimal strictly inside the
+// half-ulp interval around it — and from the endpoints too when c
+// is even, since a tie parses to the even neighbor. At the bottom
+// of a binade (c = 2^(P-1) above the smallest normal exponent) the
+// lower neighbor sits half as far away, so the lower half-width is
+// a quarter ulp. The output is the decimal in that interval with
+// the fewest significant digits; among equally short candidates,
+// the one closest to x; an exact tie between two, the even one.
+// Both tiers below produce exactly that decimal.
+//
+// The interval is the round-to-nearest one whatever T's Rounding
+// axis says, matching toString's convention (and the round-trip
+// theorem's, which parses through a nearest-rounding sibling).
+
+// Exact tier: Steele & White / Burger & Dybvig free-format digit
+// generation. value = r/s with half-widths mp/s (up) and mm/s
+// (down), all scaled by 10^-k so that s ≤ r + mp < 10·s; each step
+// peels one digit and stops at the first position where the digit,
+// or the digit plus one, already lands inside the interval.
+template <typename T, int Limbs>
+void shortestFromUnpacked(const UnpackedFloat<typename T::storage_type> &u,
+                          DecimalDigits &out) {
+  using DV = DigitVector<std::uint64_t, Limbs>;
+  using Num = typename T::number;
+  constexpr int P = Num::significand::digit_count;
+  constexpr int ML = (P + 63) / 64;
+  constexpr std::uint64_t Ten = 10;
+
+  const auto c = digitsFromStorage<std::uint64_t, ML>(u.significand);
+  const int eff = (u.biased_exp == 0) ? 1 : u.biased_exp;
+  const long q = long(eff) - Num::exponent_bias - (P - 1); // x = c · 2^q
+  const bool boundary = u.biased_exp > 1 && topBitPos(c) == P - 1 &&
+                        !anyBitsBelow(c, P - 1);
+  const bool closed = !bitAt(c, 0);
+  const auto c4 = shiftLeftDigits(resizeDigits<ML + 1>(c), 2);
+
+  // r, s, mp, mm and two temporaries.
+  withScratch<Limbs, 6>([&](DV *w) {
+    DV &r = w[0], &s = w[1], &mp = w[2], &mm = w[3], &x = w[4], &y = w[5];
+    const auto set = [](DV &v, std::uint64_t small) {
+      resizeDigitsInto(v, digitsFrom<std::uint64_t, 1>(small));
+    };
+
+    // x · 10^-k = 4c · 5^-k · 2^(q-2-k); the half-widths are 2 (or 1
+    // below a binade boundary) in the same units.
+    long k = floorLog10Pow2(q + topBitPos(c));
+    if (k < 0) {
+      pow5DigitsInto(s, -k, mp, mm); // s holds 5^-k for now
+      mulDigitsInto(r, c4, s);
+      mp = s;
+      shiftLeftDigitsInPlace(mp, 1);
+      mm = s;
+      if (!boundary)
+        shiftLeftDigitsInPlace(mm, 1);
+      set(s, 1);
+    } else {
+      pow5DigitsInto(s, k, mp, mm);
+      resizeDigitsInto(r, c4);
+      set(mp, 2);
+      set(mm, boundary ? 1 : 2);
+    }
+    const long e2 = q - 2 - k;
+    if (e2 >= 0) {
+      shiftLeftDigitsInPlace(r, int(e2));
+      shiftLeftDigitsInPlace(mp, int(e2));
+      shiftLeftDigitsInPlace(mm, int(e2));
+    } else {
+      shiftLeftDigitsInPlace(s, int(-e2));
+    }
+
+    // "reaches": r + mp lands at or past a limit (past it when the
+    // interval is open).
+    auto reaches = [&](const DV &v, const DV &lim) {
+      const int cmp = compareDigits(v, lim);
+      return closed ? cmp >= 0 : cmp > 0;
+    };
+    auto times10 = [&](DV &v) { mulAddSmallDigitsInPlace(v, Ten, std::uint64_t{0}); };
+    for (;;) {
+      x = r;
+      addDigitsInPlace(x, mp); // the interval's top
+      y = s;
+      times10(y);
+      if (reaches(x, y)) {
+        s = y;
+        ++k;
+      } else if (!reaches(x, s)) {
+        times10(r);
+        times10(mp);
+        times10(mm);
+        --k;
+      } else {
+        break;
+      }
+    }
+
+    int len = 0;
+    for (;;) {
+      int d = 0;
+      while (compareDigits(r, s) >= 0) {
+        subDigitsInPlace(r, s);
+        ++d;
+      }
+      const int lo_cmp = compareDigits(r, mm);
+      const bool low = closed ? lo_cmp <= 0 : lo_cmp < 0;
+      x = r;
+      addDigitsInPlace(x, mp);
+      const bool high = reaches(x, s);
+      if (!low && !high) {
+        out.buf[len++] = char('0' + d);
+        times10(r);
+        times10(mp);
+        times10(mm);
+        continue;
+      }
+      bool up = high;
+      if (low && high) {
+        x = r;
+        shiftLeftDigitsInPlace(x, 1);
+        const int mid = compareDigits(x, s);
+        up = mid > 0 || (mid == 0 && (d & 1) != 0);
+      }
+      out.buf[len++] = char('0' + d + (up ? 1 : 0));
+      break;
+    }
+
+    out.neg = u.sign;
+    out.len = len;
+    out.k10 = k;
+    out.ok = true;
+  });
+}
+
+// The table tier applies when c fits one limb with headroom and
+// every decimal exponent the format can reach has a table entry.
+template <typename T>
+inline constexpr bool shortest_fast_path = [] {
   using Num = typename T::number;
   constexpr int P = Num::significand::digit_count;
+  constexpr int qmin = 1 - Num::exponent_bias - (P - 1);
+  constexpr int qmax = max_biased_exp<T> - Num::exponent_bias - (P - 1);
+  return P <= 56 && qmin >= -17000 && qmax <= 17000 &&
+         -floorLog10Pow2Exact(qmax) >= Pow5TableMin &&
+         -floorLog10ThreeQuartersPow2(qmin) <= Pow5TableMax;
+}();
 
+// Table tier (Schubfach-shaped). k is chosen so the interval,
+// scaled by 10^-k, is between 1 and 10 wide: it then holds at most
+// one multiple of 10 — if so, that is the answer, with at least one
+// digit fewer than anything else inside — and otherwise one of
+// floor(x·10^-k) and its successor. The scaled values are
+// Y · 2^-sh with Y = (4c + {-2|-1, 0, +2}) · g for the table's
+// 128-bit g; g is below the true 5^-k significand by less than one
+// unit (exact for 0 ≤ -k ≤ 55), so each Y is low by less than
+// 4c + 2. Every comparison against an integer or half-integer is
+// taken only when it clears that band; otherwise this returns false
+// and the caller runs the exact tier. The band is ~2^-65 of a
+// decimal unit at binary64; about one random double in 3000 lands
+// in it (mostly exact decimal boundaries under an inexact entry).
+inline bool shortestFast(std::uint64_t c, int q, bool boundary, bool closed,
+                         std::uint64_t &dec, int &exp10) {
+  using DV = DigitVector<std::uint64_t, 4>;
+  const int k =
+      boundary ? floorLog10ThreeQuartersPow2(q) : floorLog10Pow2Exact(q);
+  const Pow5Entry &g = pow5Entry(-k);
+  const int sh = -(q - 2 + g.exp2 - k); // fraction bits of every Y
+  if (sh < 8 || sh > 190)
+    return false;
+
+  const DV gs = resizeDigits<4>(g.sig);
+  const DV y = resizeDigits<4>(
+      mulDigits(digitsFrom<std::uint64_t, 1>(4 * c), g.sig));
+  const DV yl = subDigits(y, boundary ? gs : addDigits(gs, gs));
+  const DV yr = addDigits(y, addDigits(gs, gs));
+  const DV err = pow5EntryExact(-k) ? DV{} : digitsFrom<std::uint64_t, 4>(
+                                                 4 * c + 2);
+
+  // Order of Y·2^-sh against b (+½ when half): -1, 0, +1, or 2 when
+  // the difference is inside the error band.
+  auto order = [&](const DV &yv, std::uint64_t b, bool half) {
+    DV t = shiftLeftDigits(digitsFrom<std::uint64_t, 4>(b), sh);
+    if (half)
+      t = withBit(t, sh - 1);
+    const int cmp = compareDigits(yv, t);
+    const DV diff = cmp >= 0 ? subDigits(yv, t) : subDigits(t, yv);
+    if (!isZero(err) && compareDigits(diff, err) <= 0)
+      return 2;
+    return cmp;
+  };
+  auto intPart = [&](const DV &yv) {
+    return lowUint64(shiftRightDigits(yv, sh));
+  };
+
+  // One digit shorter: the multiple of 10 at or below the upper end.
+  const std::uint64_t fr = intPart(yr);
+  const std::uint64_t m = fr - fr % 10;
+  if (order(yr, m + 10, false) == 2)
+    return false;
+  if (m != 0) {
+    const int ur = order(yr, m, false);
+    const int ul = order(yl, m, false);
+    if (ur == 2 || ul == 2)
+      return false;
+    if ((ur > 0 || (ur == 0 && closed)) && (ul < 0 || (ul == 0 && closed))) {
+      dec = m / 10;
+      exp10 = k + 1;
+      while (dec % 10 == 0) {
+        dec /= 10;
+        ++exp10;
+      }
+      return true;
+    }
+  }
+
+  // Full length: floor(x·10^-k) or its successor, nearest wins.
+  const std::uint64_t f = intPart(y);
+  const int fl = order(yl, f, false);
+  const int fu = order(yr, f + 1, false);
+  if (fl == 2 || fu == 2)
+    return false;
+  const bool f_in = f != 0 && (fl < 0 || (fl == 0 && closed));
+  const bool f1_in = fu > 0 || (fu == 0 && closed);
+  bool up;
+  if (f_in && f1_in) {
+    const int mid = order(y, f, true);
+    if (mid == 2)
+      return false;
+    up = mid > 0 || (mid == 0 && (f & 1) != 0);
+  } else if (f_in || f1_in) {
+    up = f1_in;
+  } else {
+    return false;
+  }
+  dec = f + (up ? 1 : 0);
+  exp10 = k;
+  return true;
+}
+
+// Past the window: the first digit count whose correctly rounded
+// decimal lands in the round-trip interval, by the bounded tier —
+// the same minimality the exact tier's output has.
+template <typename T>
+void shortestFromBounds(const UnpackedFloat<typename T::storage_type> &u,
+                        DecimalDigits &out) {
+  for (int D = 1; D <= roundTripDigits<T>; ++D) {
+    bool inside = false;
+    out = DecimalDigits{};
+    withBoundedBudget<T>(D, [&](auto limbs) {
+      decimalFromBounds<T, decltype(limbs)::value>(u, D, out, &inside);
+      return out.ok;
+    });
+    if (!out.ok)
+      return;
+    if (inside) {
+      while (out.len > 1 && out.buf[out.len - 1] == '0')
+        --out.len;
+      return;
+    }
+  }
+  out.ok = false;
+}
+
+// The exact tier alone (the reference the table tier is tested
+// against), then the bounded one past the decimal window.
+template <typename T>
+DecimalDigits shortestDigitsExact(typename T::storage_type bits) {
+  using Num = typename T::number;
+  constexpr int P = Num::significand::digit_count;
+
+  DecimalDigits out;
   const auto u = detail::unpackOperand<T>(bits);
-  std::string s = u.sign ? "-" : "";
-  switch (u.category) {
-  case ValueCategory::NaN:
-    return "nan";
-  case ValueCategory::Infinity:
-    return s + "inf";
-  case ValueCategory::Zero:
-    return s + "0x0p+0";
-  default:
-    break;
+  if (u.category != ValueCategory::Finite)
+    return out; // caller handles specials/zero
+
+  const int eff = (u.biased_exp == 0) ? 1 : u.biased_exp;
+  const long e = long(eff) - Num::exponent_bias - (P - 1);
+  // Budget: the powers of two cancel between r and s, leaving
+  // ≈ 0.7·|e| + P bits on the larger side, plus a few ×10 steps.
+  const long ea = e < 0 ? -e : e;
+  const long need = (3 * ea) / 4 + P + 128;
+  bool fit = withDecimalBudget(need, [&](auto limbs) {
+    shortestFromUnpacked<T, decltype(limbs)::value>(u, out);
+  });
+  if (!fit)
+    shortestFromBounds<T>(u, out);
+  return out;
+}
+
+// Shortest round-trip decomposition: the table tier where the
+// format allows and it can decide, the exact tier otherwise.
+template <typename T>
+DecimalDigits shortestDigits(typename T::storage_type bits) {
+  using Num = typename T::number;
+  constexpr int P = Num::significand::digit_count;
+
+  if constexpr (shortest_fast_path<T>) {
+    const auto u = detail::unpackOperand<T>(bits);
+    if (u.category != ValueCategory::Finite)
+      return DecimalDigits{};
+    const std::uint64_t c = lowUint64(u.significand);
+    const int eff = (u.biased_exp == 0) ? 1 : u.biased_exp;
+    const int q = eff - Num::exponent_bias - (P - 1);
+    const bool boundary =
+        u.biased_exp > 1 && c == (std::uint64_t{1} << (P - 1));
+    std::uint64_t dec = 0;
+    int exp10 = 0;
+    if (shortestFast(c, q, boundary, (c & 1) == 0, dec, exp10)) {
+      DecimalDigits out;
+      out.neg = u.sign;
+      out.len = integerDigits(digitsFrom<std::uint64_t, 1>(dec), out.buf);
+      out.k10 = exp10 + long(out.len) - 1;
+      out.ok = true;
+      return out;
+    }
   }
+  return shortestDigitsExact<T>(bits);
+}
+
+// -----------------------------------------------------------------
+// Streaming exact digits (the streamDigits core)
+// -----------------------------------------------------------------
+// A finite value's exact decimal expansion is finite — m · 2^e has
+// at most max(-e, 0) digits after the point — but can run to
+// thousands of digits (the float64 minimum subnormal has 751
+// significant ones). Rather than build it, walk it: with k the
+// decimal exponent of the leading digit,
+//
+//   value / 10^k = R / S,   R = m · 2^max(e-k, 0) · 5^max(-k, 0),
+//                           S =     2^max(k-e, 0) · 5^max(k, 0),
+//
+// so 1 ≤ R/S < 10 and each step R ← (R mod S) · 10^18 yields the
+// next 18 digits as one short quotient. R stays below 2^60 · S, so
+// the working integers are fixed by the value, not by how many
+// digits are taken; the expansion ends when R reaches zero.
+//
+// The caller stops it at a digit count or at any chunk, and the
+// result describes what was dropped — enough to round the kept
+// digits correctly in any direction without seeing the rest.
+struct DigitStream {
+  bool ok = false;  // false: zero, inf, NaN, or out of the window
+  bool neg = false;
+  long k10 = 0;     // exponent of the leading digit: d1 · 10^k10
+  long count = 0;   // digits delivered to the sink
+  // The dropped tail against half a unit in the last delivered
+  // place: -1 below, 0 exactly half, +1 above. Zero tails (the
+  // expansion ended) are below.
+  int tail = -1;
+  bool inexact = false;  // the tail is nonzero
+  bool last_odd = false; // the last delivered digit is odd
+
+  // Round to nearest, ties to even: whether the delivered digits
+  // need one added in their last place. Carrying through trailing
+  // 9s (and into a new leading 1, k10 + 1) is the caller's, over
+  // the digits it kept.
+  bool roundsUp() const { return tail > 0 || (tail == 0 && last_odd); }
+};
+
+// The tail's relation to half a unit, from the dropped digits of a
+// chunk followed by the remainder r of a divisor s. Spends r.
+template <typename DV>
+void streamTail(std::string_view dropped, DV &r, const DV &s,
+                DigitStream &out) {
+  bool rest = !isZero(r);
+  if (dropped.empty()) {
+    shiftLeftDigitsInPlace(r, 1);
+    const int c = compareDigits(r, s);
+    out.tail = c > 0 ? 1 : c == 0 ? 0 : -1;
+    out.inexact = rest;
+    return;
+  }
+  for (std::size_t i = 1; i < dropped.size() && !rest; ++i)
+    rest = dropped[i] != '0';
+  const char c = dropped[0];
+  out.tail = c > '5' || (c == '5' && rest) ? 1 : c == '5' ? 0 : -1;
+  out.inexact = c != '0' || rest;
+}
+
+template <typename T, int Limbs, typename Sink>
+void streamFromUnpacked(const UnpackedFloat<typename T::storage_type> &u,
+                        long limit, Sink &sink, DigitStream &out) {
+  using DV = DigitVector<std::uint64_t, Limbs>;
+  using Num = typename T::number;
+  constexpr int P = Num::significand::digit_count;
+  constexpr std::uint64_t Chunk = 1000000000000000000ULL; // 10^18
+
+  constexpr int ML = (P + 63) / 64;
+
+  const auto m = digitsFromStorage<std::uint64_t, ML>(u.significand);
+  const int eff = (u.biased_exp == 0) ? 1 : u.biased_exp;
+  const long e = long(eff) - Num::exponent_bias - (P - 1); // value = m · 2^e
+
+  // r / s, a quotient and two temporaries.
+  withScratch<Limbs, 5>([&](DV *w) {
+    DV &r = w[0], &s = w[1], &x = w[2], &y = w[3], &z = w[4];
+    long k = floorLog10Pow2(e + topBitPos(m));
+    for (int tries = 0; tries < 4; ++tries) {
+      if (k < 0) {
+        pow5DigitsInto(x, -k, y, z);
+        mulDigitsInto(r, m, x);
+      } else {
+        resizeDigitsInto(r, m);
+      }
+      if (k > 0)
+        pow5DigitsInto(s, k, y, z);
+      else
+        resizeDigitsInto(s, digitsFrom<std::uint64_t, 1>(1));
+      if (e > k)
+        shiftLeftDigitsInPlace(r, int(e - k));
+      else
+        shiftLeftDigitsInPlace(s, int(k - e));
+      y = s;
+      mulAddSmallDigitsInPlace(y, std::uint64_t{10}, std::uint64_t{0});
+      if (compareDigits(r, s) < 0)
+        --k;
+      else if (compareDigits(r, y) >= 0)
+        ++k;
+      else
+        break;
+    }
+    out.neg = u.sign;
+    out.k10 = k;
+    out.ok = true;
+
+    // The leading digit, then 18 per step; the first chunk carries
+    // both. r keeps the remainder, x takes each quotient.
+    char chunk[19];
+    divModLongDigitsInPlace(r, s, x);
+    chunk[0] = char('0' + x.d[0]);
+    int n = 1;
+    for (;;) {
+      if (!isZero(r)) {
+        mulAddSmallDigitsInPlace(r, Chunk, std::uint64_t{0});
+        divModLongDigitsInPlace(r, s, x);
+        std::uint64_t q = x.d[0];
+        for (int i = 18; i > 0; --i, q /= 10)
+          chunk[n + i - 1] = char('0' + q % 10);
+        n += 18;
+      }
+      const bool end = isZero(r);
+      if (end)
+        while (chunk[n - 1] == '0')
+          --n;
+
+      const long room = limit - out.count;
+      if (n >= room) { // the limit falls in (or at the end of) this chunk
+        const int take = int(room);
+        sink(std::string_view(chunk, std::size_t(take)));
+        out.count = limit;
+        out.last_odd = (chunk[take - 1] - '0') & 1;
+        streamTail(std::string_view(chunk + take, std::size_t(n - take)), r,
+                   s, out);
+        return;
+      }
+      out.count += n;
+      out.last_odd = (chunk[n - 1] - '0') & 1;
+      const bool more = sink(std::string_view(chunk, std::size_t(n)));
+      if (end)
+        return; // tail -1, exact
+      if (!more) {
+        streamTail(std::string_view{}, r, s, out);
+        return;
+      }
+      n = 0;
+    }
+  });
+}
+
+template <typename T, typename Sink>
+DigitStream streamDecimalDigits(typename T::storage_type bits, long limit,
+                                Sink &sink) {
+  using Num = typename T::number;
+  constexpr int P = Num::significand::digit_count;
+
+  DigitStream out;
+  const auto u = detail::unpackOperand<T>(bits);
+  if (u.category != ValueCategory::Finite)
+    return out;
 
-  // Leading semantic digit, then the P-1 fraction bits in nibbles.
   const int eff = (u.biased_exp == 0) ? 1 : u.biased_exp;
-  s += detail::testWordBit(u.significand, P - 1) ? "0x1" : "0x0";
+  const long e = long(eff) - Num::exponent_bias - (P - 1);
+  // Budget: S at k one above the estimate, plus 10^18 of headroom.
+  const long k = floorLog10Pow2(e + P) + 1;
+  const long need = (k > e ? k - e : 0) + (k > 0 ? (7 * k) / 3 + 1 : 0) +
+                    P + 128;
+  withDecimalBudget(need, [&](auto limbs) {
+    streamFromUnpacked<T, decltype(limbs)::value>(u, limit < 1 ? 1 : limit,
+                                                 sink, out);
+  });
+  return out;
+}
+
+// -----------------------------------------------------------------
+// Layout into a caller's buffer
+// -----------------------------------------------------------------
+// Every writer appends through a CharSink over [first, last); one
+// that runs out of room just stops, and toChars reports it as
+// std::errc::value_too_large, as std::to_chars does.
+struct CharSink {
+  char *p;
+  char *end;
+  bool full = false;
+
+  void put(char c) {
+    if (p == end)
+      full = true;
+    else
+      *p++ = c;
+  }
+  void put(std::string_view text) {
+    for (char c : text)
+      put(c);
+  }
+  void fill(char c, long n) {
+    for (; n > 0; --n)
+      put(c);
+  }
+  // "e+7", "e-300", "p+0": sign always, no zero padding.
+  void exponent(char mark, long v) {
+    put(mark);
+    put(v < 0 ? '-' : '+');
+    unsigned long a = v < 0 ? 0UL - (unsigned long)v : (unsigned long)v;
+    char tmp[24];
+    int n = 0;
+    do {
+      tmp[n++] = char('0' + a % 10);
+      a /= 10;
+    } while (a != 0);
+    while (n > 0)
+      put(tmp[--n]);
+  }
+};
+
+// The digit at decimal position 10^j of a value whose leading digit
+// sits at 10^k10; '0' outside the generated ones.
+inline char digitAt(std::string_view mant, long k10, long j) {
+  const long i = k10 - j;
+  return i >= 0 && i < long(mant.size()) ? mant[std::size_t(i)] : '0';
+}
+
+// %g-style layout of a decimal significand whose trailing zeros are
+// already trimmed: positional when the leading digit's exponent is
+// in [-4, precision), scientific otherwise.
+inline void writeGeneral(CharSink &out, bool neg, std::string_view mant,
+                         long k10, int precision) {
+  if (neg)
+    out.put('-');
+  if (k10 >= -4 && k10 < long(precision)) {
+    // Positional.
+    if (k10 >= 0) {
+      for (long j = k10; j >= 0; --j)
+        out.put(digitAt(mant, k10, j));
+      if (long(mant.size()) > k10 + 1) {
+        out.put('.');
+        out.put(mant.substr(std::size_t(k10 + 1)));
+      }
+    } else {
+      out.put("0.");
+      out.fill('0', -k10 - 1);
+      out.put(mant);
+    }
+  } else {
+    // Scientific: d.ddd e±k
+    out.put(mant[0]);
+    if (mant.size() > 1) {
+      out.put('.');
+      out.put(mant.substr(1));
+    }
+    out.exponent('e', k10);
+  }
+}
+
+// d.ddd e±k with exactly frac digits after the point (none: no
+// point), zero-filled past the generated digits.
+inline void writeScientific(CharSink &out, bool neg, std::string_view mant,
+                            long k10, long frac) {
+  if (neg)
+    out.put('-');
+  out.put(digitAt(mant, k10, k10));
+  if (frac > 0) {
+    out.put('.');
+    for (long j = 1; j <= frac; ++j)
+      out.put(digitAt(mant, k10, k10 - j));
+  }
+  out.exponent('e', k10);
+}
+
+// ddd.ddd with exactly frac digits after the point.
+inline void writeFixed(CharSink &out, bool neg, std::string_view mant,
+                       long k10, long frac) {
+  if (neg)
+    out.put('-');
+  for (long j = k10 > 0 ? k10 : 0; j >= 0; --j)
+    out.put(digitAt(mant, k10, j));
+  if (frac > 0) {
+    out.put('.');
+    for (long j = -1; j >= -frac; --j)
+      out.put(digitAt(mant, k10, j));
+  }
+}
+
+// C hex-float of a finite value: the leading semantic digit, then
+// the P-1 fraction bits in nibbles — all of them with trailing
+// zeros trimmed (precision < 0), or exactly `precision`, rounded to
+// nearest-even (a carry can make the leading digit 2, as in glibc).
+template <typename T>
+void writeHex(CharSink &out, const UnpackedFloat<typename T::storage_type> &u,
+              int precision) {
+  using Num = typename T::number;
+  using S = typename T::storage_type;
+  constexpr int P = Num::significand::digit_count;
   constexpr int FracBits = P - 1;
-  std::string frac;
-  for (int t = 0; t < (FracBits + 3) / 4; ++t) {
+  constexpr int Nibbles = (FracBits + 3) / 4;
+
+  const bool zero = u.category == ValueCategory::Zero;
+  char frac[Nibbles + 1];
+  int lead = !zero && testWordBit(u.significand, P - 1) ? 1 : 0;
+  for (int t = 0; t < Nibbles; ++t) {
     const int hi = FracBits - 1 - 4 * t; // top fraction bit of this nibble
     int nib = 0;
     for (int b = 0; b < 4; ++b) {
       const int idx = hi - b; // significand bit index
       nib = (nib << 1) |
-            ((idx >= 0 && detail::testWordBit(u.significand, idx)) ? 1 : 0);
+            ((!zero && idx >= 0 && testWordBit(u.significand, idx)) ? 1 : 0);
+    }
+    frac[t] = "0123456789abcdef"[nib];
+  }
+
+  int nd = Nibbles;
+  if (precision < 0) {
+    while (nd > 0 && frac[nd - 1] == '0')
+      --nd;
+  } else if (precision < Nibbles) {
+    nd = precision;
+    const int g = FracBits - 1 - 4 * precision; // first dropped bit
+    const bool guard = !zero && g >= 0 && testWordBit(u.significand, g);
+    const bool sticky =
+        !zero && g > 0 &&
+        !isZeroWord(andWords(u.significand, wordOnes<S>(g)));
+    const bool odd =
+        !zero && testWordBit(u.significand, g + 1 < P ? g + 1 : P - 1);
+    if (guard && (sticky || odd)) {
+      int t = nd - 1;
+      for (; t >= 0 && frac[t] == 'f'; --t)
+        frac[t] = '0';
+      if (t < 0)
+        ++lead;
+      else
+        frac[t] = frac[t] == '9' ? 'a' : char(frac[t] + 1);
     }
-    frac.push_back("0123456789abcdef"[nib]);
   }
-  while (!frac.empty() && frac.back() == '0')
-    frac.pop_back();
-  if (!frac.empty())
-    s += "." + frac;
 
-  const long e2 = long(eff) - Num::exponent_bias;
-  s += 'p';
-  if (e2 >= 0)
-    s += '+';
-  s += std::to_string(e2);
-  return s;
+  const int eff = (u.biased_exp == 0) ? 1 : u.biased_exp;
+  if (u.sign)
+    out.put('-');
+  out.put("0x");
+  out.put(char('0' + lead));
+  if (nd > 0 || precision > 0) {
+    out.put('.');
+    out.put(std::string_view(frac, std::size_t(nd)));
+    out.fill('0', long(precision) - nd);
+  }
+  out.exponent('p', zero ? 0 : long(eff) - Num::exponent_bias);
+}
+
+inline std::to_chars_result charsResult(const CharSink &out, char *last) {
+  if (out.full)
+    return {last, std::errc::value_too_large};
+  return {out.p, std::errc{}};
 }
 
-// -----------------------------------------------------------------
-// toString — correctly rounded decimal, %g-style
-// -----------------------------------------------------------------
+// Shared by every toChars form: nan / inf, and zeros in the
+// decimal layouts (hex handles its own). True when it wrote.
 template <typename T>
-std::string toString(typename T::storage_type bits,
-                     int digits = roundTripDigits<T>) {
-  if (digits < 1)
-    digits = 1;
-  if (digits > 1000)
-    digits = 1000; // digit-extraction buffer bound
-  const auto u = detail::unpackOperand<T>(bits);
+bool writeSpecial(CharSink &out,
+                  const UnpackedFloat<typename T::storage_type> &u,
+                  std::chars_format fmt, int precision) {
   switch (u.category) {
   case ValueCategory::NaN:
-    return "nan";
+    out.put("nan");
+    return true;
   case ValueCategory::Infinity:
-    return u.sign ? "-inf" : "inf";
+    out.put(u.sign ? "-inf" : "inf");
+    return true;
   case ValueCategory::Zero:
-    return u.sign ? "-0" : "0";
+    if (fmt == std::chars_format::hex)
+      return false;
+    if (fmt == std::chars_format::scientific)
+      writeScientific(out, u.sign, "0", 0, precision);
+    else if (fmt == std::chars_format::fixed)
+      writeFixed(out, u.sign, "0", 0, precision);
+    else
+      out.put(u.sign ? "-0" : "0");
+    return true;
   default:
-    break;
+    return false;
   }
+}
 
-  detail::DecimalDigits d = detail::decimalDigits<T>(bits, digits);
-  if (!d.ok)
-    return toHexString<T>(bits); // outside the decimal window: exact hex
+} // namespace detail
 
-  std::string mant = d.digits;
-  while (mant.size() > 1 && mant.back() == '0')
-    mant.pop_back();
+// -----------------------------------------------------------------
+// toChars — std::to_chars-style output into a caller's buffer
+// -----------------------------------------------------------------
+// Writes into [first, last) without allocating and without a
+// terminator; returns {one past the last character, errc{}}, or
+// {last, std::errc::value_too_large} when the text does not fit
+// (the buffer's contents are then unspecified). Every decimal is
+// correctly rounded to nearest, ties to even, whatever T's Rounding
+// axis says — the printf convention.
+//
+// Layouts follow printf, in this library's own spelling: the
+// exponent carries a sign and no zero padding ("1e+30", "0x1p-3"),
+// and general-format output is %g with trailing zeros trimmed, the
+// layout toString has always used.
+//
+//   toChars<T>(first, last, bits)       — shortest round-trip,
+//                                         general (toShortestString)
+//   toChars<T>(first, last, bits, fmt)  — shortest round-trip in
+//                                         fmt; hex is exact
+//   toChars<T>(..., fmt, precision)     — general: precision
+//                                         significant digits;
+//                                         scientific / fixed / hex:
+//                                         digits after the point
+//
+// A negative precision means 6, as in printf. Decimal digits past
+// the MaxDecimalDigits-th significant one print as zeros — exact for
+// every format through binary64, whose values have at most 767
+// significant digits. Values outside the decimal window print as
+// exact hex in every decimal format.
+template <typename T>
+  requires(!detail::is_decimal<typename T::number>)
+std::to_chars_result toChars(char *first, char *last,
+                             typename T::storage_type bits,
+                             std::chars_format fmt) {
+  const auto u = detail::unpackOperand<T>(bits);
+  detail::CharSink out{first, last};
+  if (detail::writeSpecial<T>(out, u, fmt, 0))
+    return detail::charsResult(out, last);
+  if (fmt == std::chars_format::hex) {
+    detail::writeHex<T>(out, u, -1);
+    return detail::charsResult(out, last);
+  }
 
-  std::string s = d.neg ? "-" : "";
-  if (d.k10 >= -4 && d.k10 < long(digits)) {
-    // Positional.
-    if (d.k10 >= 0) {
-      if (long(mant.size()) > d.k10 + 1) {
-        s += mant.substr(0, d.k10 + 1) + "." + mant.substr(d.k10 + 1);
-      } else {
-        s += mant + std::string(d.k10 + 1 - mant.size(), '0');
-      }
-    } else {
-      s += "0." + std::string(-d.k10 - 1, '0') + mant;
-    }
+  const detail::DecimalDigits d = detail::shortestDigits<T>(bits);
+  if (!d.ok) {
+    detail::writeHex<T>(out, u, -1); // outside the decimal window
+  } else if (fmt == std::chars_format::scientific) {
+    detail::writeScientific(out, d.neg, d.digits(), d.k10, d.len - 1);
+  } else if (fmt == std::chars_format::fixed) {
+    // Past the shortest digits the integer part has a fixed length
+    // anyway, and std::to_chars then prints the closest such text:
+    // the exact integer (which the value is, that large).
+    const long frac = long(d.len) - 1 - d.k10;
+    detail::DecimalDigits exact;
+    if (d.k10 >= d.len)
+      exact = detail::fixedDigits<T>(bits, 0);
+    const detail::DecimalDigits &f = exact.ok ? exact : d;
+    detail::writeFixed(out, f.neg, f.digits(), f.k10, frac > 0 ? frac : 0);
   } else {
-    // Scientific: d.ddd e±k
-    s += mant.substr(0, 1);
-    if (mant.size() > 1)
-      s += "." + mant.substr(1);
-    s += 'e';
-    if (d.k10 >= 0)
-      s += '+';
-    s += std::to_string(d.k10);
+    detail::writeGeneral(out, d.neg, d.digits(), d.k10, roundTripDigits<T>);
+  }
+  return detail::charsResult(out, last);
+}
+
+template <typename T>
+  requires(!detail::is_decimal<typename T::number>)
+std::to_chars_result toChars(char *first, char *last,
+                             typename T::storage_type bits) {
+  return toChars<T>(first, last, bits, std::chars_format::general);
+}
+
+template <typename T>
+  requires(!detail::is_decimal<typename T::number>)
+std::to_chars_result toChars(char *first, char *last,
+                             typename T::storage_type bits,
+                             std::chars_format fmt, int precision) {
+  using detail::MaxDecimalDigits;
+  if (precision < 0)
+    precision = 6;
+  const auto u = detail::unpackOperand<T>(bits);
+  detail::CharSink out{first, last};
+  if (detail::writeSpecial<T>(out, u, fmt, precision))
+    return detail::charsResult(out, last);
+  if (fmt == std::chars_format::hex) {
+    detail::writeHex<T>(out, u, precision);
+    return detail::charsResult(out, last);
+  }
+
+  if (fmt == std::chars_format::fixed) {
+    detail::DecimalDigits d = detail::fixedDigits<T>(bits, precision);
+    if (!d.ok) // too many digits: the leading ones, zero-filled
+      d = detail::decimalDigits<T>(bits, MaxDecimalDigits);
+    if (!d.ok)
+      detail::writeHex<T>(out, u, -1);
+    else
+      detail::writeFixed(out, d.neg, d.digits(), d.k10, precision);
+    return detail::charsResult(out, last);
+  }
+
+  const bool sci = fmt == std::chars_format::scientific;
+  long want = sci ? long(precision) + 1 : (precision < 1 ? 1 : precision);
+  const int D = int(want < MaxDecimalDigits ? want : MaxDecimalDigits);
+  const detail::DecimalDigits d = detail::decimalDigits<T>(bits, D);
+  if (!d.ok) {
+    detail::writeHex<T>(out, u, -1); // outside the decimal window
+  } else if (sci) {
+    detail::writeScientific(out, d.neg, d.digits(), d.k10, precision);
+  } else {
+    std::string_view mant = d.digits();
+    while (mant.size() > 1 && mant.back() == '0')
+      mant.remove_suffix(1);
+    detail::writeGeneral(out, d.neg, mant, d.k10, D);
   }
-  return s;
+  return detail::charsResult(out, last);
 }
 
 // -----------------------------------------------------------------
-// fromString — correctly rounded parse through the shared epilogue
+// String forms — toChars into a stack buffer
 // -----------------------------------------------------------------
 namespace detail {
+// Room for the longest text any of them can produce: a full
+// MaxDecimalDigits significand with its zeros, point, sign and
+// exponent, or the exact hex form of the widest significand.
+template <typename T>
+inline constexpr std::size_t string_chars =
+    std::size_t(MaxDecimalDigits + 48 +
+                (T::number::significand::digit_count + 3) / 4);
+} // namespace detail
+
+// toHexString — exact C hex-float, any width.
+template <typename T>
+  requires(!detail::is_decimal<typename T::number>)
+std::string toHexString(typename T::storage_type bits) {
+  char buf[detail::string_chars<T>];
+  auto r = toChars<T>(buf, buf + sizeof buf, bits, std::chars_format::hex);
+  return std::string(buf, r.ptr);
+}
+
+// toString — correctly rounded decimal, %g-style, digits
+// significant digits (clamped to [1, MaxDecimalDigits]).
+template <typename T>
+  requires(!detail::is_decimal<typename T::number>)
+std::string toString(typename T::storage_type bits,
+                     int digits = roundTripDigits<T>) {
+  if (digits < 1)
+    digits = 1;
+  if (digits > detail::MaxDecimalDigits)
+    digits = detail::MaxDecimalDigits;
+  char buf[detail::string_chars<T>];
+  auto r = toChars<T>(buf, buf + sizeof buf, bits,
+                      std::chars_format::general, digits);
+  return std::string(buf, r.ptr);
+}
+
+// toShortestString — the fewest significant digits that fromString
+// (under round-to-nearest) maps back to the identical bits — "0.1"
+// for the float32 nearest 0.1, where toString's fixed
+// roundTripDigits prints 0.100000001. Laid out like toString at its
+// default precision, so the two differ only in how many digits they
+// keep.
+template <typename T>
+  requires(!detail::is_decimal<typename T::number>)
+std::string toShortestString(typename T::storage_type bits) {
+  char buf[detail::string_chars<T>];
+  auto r = toChars<T>(buf, buf + sizeof buf, bits);
+  return std::string(buf, r.ptr);
+}
 
+// -----------------------------------------------------------------
+// streamDigits — exact decimal digits, chunk by chunk
+// -----------------------------------------------------------------
+// Hands the exact decimal significand of bits to sink, most
+// significant first, as string_views over a small internal buffer
+// (valid only during the call): sink(std::string_view) -> bool,
+// false to stop after that chunk. It also stops after limit digits
+// (at least one), or where the expansion ends. Memory stays bounded
+// whatever the count: no digit string is built, and the working
+// integers are sized by the value alone.
+//
+// The returned DigitStream gives the leading digit's exponent, the
+// count delivered, and how the dropped tail compares with half a
+// unit in the last place — so a caller taking the first N digits
+// rounds them itself, nearest-even through roundsUp() or any
+// directed mode through neg and inexact. ok is false (and nothing
+// is delivered) for zero, infinities, NaN, and values outside the
+// decimal window.
+template <typename T, typename Sink>
+  requires(!detail::is_decimal<typename T::number>)
+detail::DigitStream
+streamDigits(typename T::storage_type bits, Sink &&sink,
+             long limit = std::numeric_limits<long>::max()) {
+  return detail::streamDecimalDigits<T>(bits, limit, sink);
+}
+
+// -----------------------------------------------------------------
+// Decimal parsing core (fromChars / fromString)
+// -----------------------------------------------------------------
+namespace detail {
+
+// Hand a parsed magnitude to the shared epilogue: mag's MSB sits at
+// bit Target = P + GuardBits - 1 with sticky folded into bit 0, and
+// the value is mag · 2^(e2 - Target).
+template <typename T, typename DV>
+typename T::storage_type packParsed(bool neg, long e2, const DV &mag,
+                                    flags_t &flags) {
+  using Num = typename T::number;
+  constexpr int P = Num::significand::digit_count;
+  constexpr int GBits = GuardBits;
+
+  // Biased exponent for a magnitude whose MSB is the value's
+  // leading bit at position Target. Past two binades above the top
+  // one, or below every subnormal by more than the working bits, the
+  // result is an overflow or an underflow to zero whatever e2 is;
+  // clamping there keeps "1e999999999" from wrapping the int.
+  constexpr long Hi = long(max_biased_exp<T>) - Num::exponent_bias + 2;
+  constexpr long Lo = -long(Num::exponent_bias) - P - GBits - 2;
+  e2 = e2 > Hi ? Hi : e2 < Lo ? Lo : e2;
+  const int result_exp = int(e2) + Num::exponent_bias;
+
+  // Re-chunk to the platform's working geometry for the epilogue.
+  using WDV = WorkingDigits<T, P + GBits + 1>;
+  WDV wmag = digitsFromStorage<typename WDV::limb_type, WDV::limb_count>(
+      resizeDigits<(P + GBits + 64 + 63) / 64>(mag));
+  return roundAndPack<T>(neg, result_exp, wmag, flags);
+}
+
+// The significant digits of a decimal literal, read in place: count
+// digits from first, stepping over the '.' at point when it falls
+// inside — parsing never copies them.
+struct DecimalText {
+  const char *first = nullptr;
+  const char *point = nullptr; // the literal's '.', or nullptr
+  long count = 0;
+
+  const char *at(long i) const {
+    const char *p = first + i;
+    return point != nullptr && p >= point ? p + 1 : p;
+  }
+  char operator[](long i) const { return *at(i); }
+  DecimalText prefix(long n) const { return {first, point, n}; }
+  DecimalText dropFront() const {
+    DecimalText r{at(0) + 1, point, count - 1};
+    if (r.point != nullptr && r.first > r.point)
+      r.point = nullptr;
+    return r;
+  }
+};
+
+// -----------------------------------------------------------------
+// SWAR helpers: eight ASCII bytes per 64-bit word
+// -----------------------------------------------------------------
+// Portable SIMD-within-a-register — no intrinsics, so every
+// Platform gets the same code. They need a little-endian 8-byte
+// load; elsewhere swar_available is false and callers take their
+// byte loops.
+inline constexpr bool swar_available =
+    std::endian::native == std::endian::little;
+
+inline std::uint64_t loadWord8(const char *p) {
+  std::uint64_t w;
+  std::memcpy(&w, p, 8);
+  return w;
+}
+
+// All eight bytes are '0'-'9'.
+constexpr bool allDigits8(std::uint64_t w) {
+  return ((w & 0xF0F0F0F0F0F0F0F0ULL) |
+          (((w + 0x0606060606060606ULL) & 0xF0F0F0F0F0F0F0F0ULL) >> 4)) ==
+         0x3333333333333333ULL;
+}
+
+// The value of eight digits, first byte most significant: pairs,
+// then quads, then the whole, in three multiplies (Lemire).
+constexpr std::uint64_t digits8Value(std::uint64_t w) {
+  constexpr std::uint64_t Mask = 0x000000FF000000FFULL;
+  constexpr std::uint64_t Mul1 = 100 + (1000000ULL << 32);
+  constexpr std::uint64_t Mul2 = 1 + (10000ULL << 32);
+  w -= 0x3030303030303030ULL;
+  w = (w * 10) + (w >> 8);
+  return (((w & Mask) * Mul1) + (((w >> 16) & Mask) * Mul2)) >> 32;
+}
+
+// Index of the first separator byte — whitespace or any control
+// character (≤ ' '), or ',' — or 8 when there is none. The zero-byte
+// tests can misfire only above a true hit, so the lowest is exact.
+constexpr int firstSeparator8(std::uint64_t w) {
+  constexpr std::uint64_t Ones = 0x0101010101010101ULL;
+  constexpr std::uint64_t Highs = 0x8080808080808080ULL;
+  const std::uint64_t ctl = (w - Ones * 0x21) & ~w & Highs;
+  const std::uint64_t x = w ^ (Ones * std::uint64_t(','));
+  const std::uint64_t comma = (x - Ones) & ~x & Highs;
+  const std::uint64_t m = ctl | comma;
+  return m == 0 ? 8 : std::countr_zero(m) / 8;
+}
+
+// plus_one parses the digits plus one in their last place (the
+// upper end of a cut; see parseChars).
 template <typename T, int Limbs>
-typename T::storage_type
-parseFinite(bool neg, const std::string &digits, long q, bool tail_sticky,
-            flags_t &flags) {
+typename T::storage_type parseFinite(bool neg, const DecimalText &digits,
+                                     long q, bool tail_sticky, bool plus_one,
+                                     flags_t &flags) {
   using DV = DigitVector<std::uint64_t, Limbs>;
   using Num = typename T::number;
   constexpr int P = Num::significand::digit_count;
   constexpr int GBits = GuardBits;
   constexpr int Target = P + GBits - 1;
 
-  // The parsed significand as an integer.
-  DV n{};
-  const auto ten = digitsFrom<std::uint64_t, Limbs>(10);
-  for (char c : digits) {
-    n = resizeDigits<Limbs>(mulDigits(n, ten));
-    n = addDigits(n, digitsFrom<std::uint64_t, Limbs>(std::uint64_t(c - '0')));
-  }
+  using Mag = DigitVector<std::uint64_t, (Target + 64) / 64>;
 
   // value = n · 10^q · (1 + tail): fold everything into a magnitude
   // with G/R/S below the target position and hand it to the shared
-  // epilogue.
-  DV mag{};
-  long e2 = 0; // value = mag · 2^(e2 - Target) exactly-with-sticky
-  bool sticky = tail_sticky;
-
-  if (q >= 0) {
-    // value = (n · 5^q) · 2^q, exact. Normalize the MSB to Target;
-    // bits shifted out fold into sticky at bit 0, which sits below
-    // the guard/round positions the epilogue reads.
-    DV v = resizeDigits<Limbs>(mulDigits(n, pow5Digits<Limbs>(q)));
-    int msb = topBitPos(v);
-    e2 = q + msb;
-    if (msb > Target)
-      mag = shiftRightStickyDigits(v, msb - Target);
-    else
-      mag = shiftLeftDigits(v, Target - msb);
-    if (sticky)
-      mag = withBit(mag, 0);
-  } else {
+  // epilogue. Working integers n, x, y, z.
+  return withScratch<Limbs, 4>([&](DV *w) {
+    DV &n = w[0], &x = w[1], &y = w[2], &z = w[3];
+
+    // The parsed significand as an integer.
+    n = DV{};
+    for (long j = 0; j < digits.count; ++j)
+      mulAddSmallDigitsInPlace(n, std::uint64_t{10},
+                               std::uint64_t(digits[j] - '0'));
+    if (plus_one)
+      addSmallDigitsInPlace(n, std::uint64_t{1});
+
+    // Normalize v's MSB to Target; bits shifted out fold into sticky
+    // at bit 0, which sits below the guard/round positions the
+    // epilogue reads.
+    bool sticky = tail_sticky;
+    const auto normalize = [&](DV &v, int msb) {
+      Mag mag;
+      if (msb > Target) {
+        shiftRightStickyDigitsInPlace(v, msb - Target);
+        resizeDigitsInto(mag, v);
+      } else {
+        resizeDigitsInto(mag, v);
+        shiftLeftDigitsInPlace(mag, Target - msb);
+      }
+      return sticky ? withBit(mag, 0) : mag;
+    };
+
+    if (q >= 0) {
+      // value = (n · 5^q) · 2^q, exact.
+      pow5DigitsInto(x, q, y, z);
+      mulDigitsInto(y, n, x);
+      const int msb = topBitPos(y);
+      // value = mag · 2^(e2 - Target) exactly-with-sticky
+      return packParsed<T>(neg, q + msb, normalize(y, msb), flags);
+    }
     // value = n · 2^S / 5^(-q) · 2^(q - S): pick S so the quotient
     // carries at least Target + 2 significant bits.
-    DV den = pow5Digits<Limbs>(-q);
+    DV &den = x;
+    pow5DigitsInto(den, -q, y, z);
     const int need = Target + 2 + topBitPos(den) - topBitPos(n) + 1;
     const int S = need > 0 ? need : 0;
-    auto dm = divModDigits(shiftLeftDigits(n, S), den);
-    sticky = sticky || !isZero(dm.rem);
-    int msb = topBitPos(dm.quot);
-    e2 = q - S + msb;
-    if (msb > Target)
-      mag = shiftRightStickyDigits(dm.quot, msb - Target);
-    else
-      mag = shiftLeftDigits(dm.quot, Target - msb);
-    if (sticky)
-      mag = withBit(mag, 0);
+    shiftLeftDigitsInPlace(n, S);
+    divModLongDigitsInPlace(n, den, y); // n: the remainder
+    sticky = sticky || !isZero(n);
+    const int msb = topBitPos(y);
+    return packParsed<T>(neg, q - S + msb, normalize(y, msb), flags);
+  });
+}
+
+// Eisel–Lemire tier: for at most 19 significant digits and a
+// decimal exponent inside the power-of-five table, n · 10^q is
+// w · g · 2^(q + exp2 - lz) for the normalized 64-bit w = n << lz
+// and the 128-bit table entry g. One 64×128 multiply gives the
+// leading Target + 1 bits and — because the epilogue rounds in
+// every direction, not just to nearest — the sticky bit too:
+//
+//   - exact entries (0 ≤ q ≤ 55): the product is the value; sticky
+//     is whatever it shifts out.
+//   - inexact entries: the true product lies in [w·g, w·g + w), so
+//     the kept bits are right unless adding w to the discarded part
+//     could carry into them — then give up. The value itself is
+//     never a short binary fraction there (5^|q| cannot divide n
+//     once |q| > 27, and smaller |q| are screened by an exact
+//     division first), so sticky is 1.
+//
+// Returns false when it cannot decide; the caller then runs
+// parseFinite, which defines the same result.
+template <typename T>
+bool parseFast(bool neg, std::uint64_t n, long q,
+               typename T::storage_type &out, flags_t &flags) {
+  using Num = typename T::number;
+  constexpr int P = Num::significand::digit_count;
+  constexpr int Target = P + GuardBits - 1;
+  using DV1 = DigitVector<std::uint64_t, 1>;
+
+  if (n == 0 || q < Pow5TableMin || q > Pow5TableMax)
+    return false;
+
+  // A negative exponent that divides out exactly: n · 10^q is the
+  // integer n / 5^|q| times 2^q.
+  if (q < 0 && q >= -27) {
+    std::uint64_t p5 = 1;
+    for (long j = 0; j < -q; ++j)
+      p5 *= 5;
+    if (n % p5 == 0) {
+      const DV1 v = digitsFrom<std::uint64_t, 1>(n / p5);
+      const int msb = topBitPos(v);
+      const DV1 mag = msb > Target ? shiftRightStickyDigits(v, msb - Target)
+                                   : shiftLeftDigits(v, Target - msb);
+      out = packParsed<T>(neg, q + msb, mag, flags);
+      return true;
+    }
   }
 
-  // Biased exponent for a magnitude whose MSB is the value's
-  // leading bit at position Target.
-  const int result_exp = int(e2) + Num::exponent_bias;
+  const Pow5Entry &g = pow5Entry(int(q));
+  const int lz = 63 - topBitPos(digitsFrom<std::uint64_t, 1>(n));
+  const DV1 w = digitsFrom<std::uint64_t, 1>(n << lz);
+  const auto prod = mulDigits(w, g.sig); // 192 bits, top bit 190 or 191
+  using DV3 = decltype(prod);
+  const int msb = topBitPos(prod);
+  const int cut = msb - Target;
+  const DV3 low = andDigits(prod, maskLowDigits<std::uint64_t, 3>(cut));
+  bool sticky = !isZero(low);
+  if (!pow5EntryExact(int(q))) {
+    if (compareDigits(addDigits(low, resizeDigits<3>(w)),
+                      withBit(DV3{}, cut)) >= 0)
+      return false;
+    sticky = true;
+  }
+  DV1 mag = resizeDigits<1>(shiftRightDigits(prod, cut));
+  if (sticky)
+    mag = withBit(mag, 0);
+  out = packParsed<T>(neg, long(msb) + g.exp2 + q - lz, mag, flags);
+  return true;
+}
 
-  // Re-chunk to the platform's working geometry for the epilogue.
-  using WDV = WorkingDigits<T, P + GBits + 1>;
-  WDV wmag = digitsFromStorage<typename WDV::limb_type, WDV::limb_count>(
-      resizeDigits<(P + GBits + 64 + 63) / 64>(mag));
-  return roundAndPack<T>(neg, result_exp, wmag, flags);
+// The exact tier over the tiered working integers; false outside
+// the decimal window.
+template <typename T>
+bool parseExact(bool neg, const DecimalText &digits, long q, bool sticky,
+                bool plus_one, typename T::storage_type &out,
+                flags_t &flags) {
+  constexpr int P = T::number::significand::digit_count;
+  // Budget: n carries 3.33·digits bits; scaling by 10^q adds
+  // ≈ 3.33·|q| more (or the same again in shift for the division
+  // case).
+  const long qa = q < 0 ? -q : q;
+  const long need = (7 * (qa + digits.count + 1)) / 2 + P + 128;
+  return withDecimalBudget(need, [&](auto limbs) {
+    out = parseFinite<T, decltype(limbs)::value>(neg, digits, q, sticky,
+                                                 plus_one, flags);
+  });
 }
 
-} // namespace detail
+// The bounded tier (see Pow5Bound): value = n · 5^q · 2^q lies in
+// [lo, hi] · 2^(exp2 + q) — hi taking n + 1 when a tail was cut —
+// and both ends truncated above the magnitude's sticky bit agree:
+// then so does every value between, none of them on that grid
+// (lo is not), so one magnitude with sticky set rounds them all
+// alike in every mode, flags included. Digits past the first
+// Scale·P·log10(2) + 28 are cut into the sticky end first, which
+// leaves the interval under 2^-24 of a rounding cell. False when it
+// cannot decide; parseBounded then retries at four times the
+// precision — a decimal can sit arbitrarily close to a boundary —
+// and only then gives up.
+template <typename T, int Scale>
+bool parseBoundedAt(bool neg, DecimalText digits, long q,
+                    typename T::storage_type &out, flags_t &flags) {
+  constexpr int P = T::number::significand::digit_count;
+  constexpr int Target = P + GuardBits - 1;
+  constexpr long Keep =
+      long((std::int64_t(Scale) * P * 30103) / 100000) + 28;
+  constexpr int NL = int((Keep * 10) / 3 / 64) + 1; // 10^Keep fits
+  constexpr int Limbs = (Scale * Target + 192) / 64 + 1;
+  constexpr int PL = Limbs + 1 + NL;
+  using Prod = DigitVector<std::uint64_t, PL>;
 
-// Parses a decimal floating-point literal: [+-]? (ddd[.ddd] | .ddd)
-// ([eE][+-]?ddd)?, or inf / infinity / nan (case-insensitive).
-// Correctly rounded per T's Rounding axis; flags (inexact, overflow,
-// underflow; Invalid for malformed or out-of-window input) delivered
-// per T's Exceptions axis.
-template <typename T> auto fromString(std::string_view text) {
-  using detail::deliver;
-  using detail::packSpecial;
+  bool cut_tail = false;
+  if (digits.count > Keep) {
+    q += digits.count - Keep; // the tail is nonzero: trailing zeros
+    digits = digits.prefix(Keep); // were stripped
+    cut_tail = true;
+  }
+  DigitVector<std::uint64_t, NL> n{};
+  for (long j = 0; j < digits.count; ++j)
+    n = mulAddSmallDigits(n, std::uint64_t{10},
+                          std::uint64_t(digits[j] - '0'));
+  const auto n_hi =
+      cut_tail ? addDigits(n, digitsFrom<std::uint64_t, NL>(1)) : n;
 
-  auto invalid = [&] {
-    return deliver<T>(packSpecial<T>(ValueCategory::NaN, false), FlagInvalid);
-  };
+  Pow5Bound<Limbs> f;
+  if (!pow5Bound(q, f))
+    return false;
+  const auto f_hi = addDigits(resizeDigits<Limbs + 1>(f.sig),
+                              resizeDigits<Limbs + 1>(f.err));
+  const Prod lo = resizeDigits<PL>(mulDigits(f.sig, n));
+  const Prod hi = mulDigits(f_hi, n_hi);
+  const int msb = topBitPos(lo);
+  const int cut = msb - Target; // bit 0 of the magnitude is sticky
+  if (cut < 1 || topBitPos(hi) != msb ||
+      !(shiftRightDigits(lo, cut + 1) == shiftRightDigits(hi, cut + 1)) ||
+      !anyBitsBelow(lo, cut + 1))
+    return false;
+  const auto mag = withBit(shiftRightDigits(lo, cut), 0);
+  out = packParsed<T>(neg, long(msb) + f.exp2 + q, mag, flags);
+  return true;
+}
+
+template <typename T>
+bool parseBounded(bool neg, const DecimalText &digits, long q,
+                  typename T::storage_type &out, flags_t &flags) {
+  return parseBoundedAt<T, 1>(neg, digits, q, out, flags) ||
+         parseBoundedAt<T, 4>(neg, digits, q, out, flags);
+}
+
+// The most significant digits any representable value or rounding
+// midpoint of T has: the smallest midpoint is an integer of P + 1
+// bits times 2^-(bias + P - 1), whose decimal expansion is that
+// integer times 5^(bias + P - 1). Saturates for the widest formats,
+// whose inputs that long are outside the decimal window anyway.
+template <typename T>
+inline constexpr long exact_parse_digits = [] {
+  constexpr std::int64_t P = T::number::significand::digit_count;
+  constexpr std::int64_t F = std::int64_t(T::number::exponent_bias) + P - 1;
+  return F > 10000000 ? 10000000L
+                      : long(((P + 1) * 30103 + F * 69897) / 100000 + 2);
+}();
+
+// The value of at most 19 digits, eight at a time where they run
+// unbroken by the point.
+inline std::uint64_t smallDecimalValue(const DecimalText &t) {
+  std::uint64_t n = 0;
+  long j = 0;
+  if constexpr (swar_available) {
+    while (t.count - j >= 8) {
+      const char *a = t.at(j);
+      if (t.point != nullptr && a < t.point && a + 8 > t.point)
+        break;
+      n = n * 100000000 + digits8Value(loadWord8(a));
+      j += 8;
+    }
+  }
+  for (; j < t.count; ++j)
+    n = n * 10 + std::uint64_t(t[j] - '0');
+  return n;
+}
 
-  size_t i = 0;
+// The table tier needs the whole working magnitude in one limb.
+template <typename T>
+inline constexpr bool parse_fast_path =
+    T::number::significand::digit_count + GuardBits <= 64;
+
+// Hex-float literals, the C99 %a syntax toHexString writes: hex
+// digits with at most one point after the "0x", then an optional
+// binary exponent p[+-]ddd. The value is H · 2^(p - 4·f) for the
+// digit string H with f digits after the point, so the nibbles go
+// straight into the magnitude — no powers of five — until it holds
+// Target + 1 bits; nonzero nibbles past that are sticky, and one
+// roundAndPack rounds the lot per T's Rounding axis. first is just
+// past the "0x", at a hex digit or a point followed by one.
+inline int hexNibble(char c) {
+  if (c >= '0' && c <= '9')
+    return c - '0';
+  if (c >= 'a' && c <= 'f')
+    return c - 'a' + 10;
+  if (c >= 'A' && c <= 'F')
+    return c - 'A' + 10;
+  return -1;
+}
+
+template <typename T>
+std::from_chars_result parseHex(bool neg, const char *first, const char *last,
+                                typename T::storage_type &out,
+                                flags_t &flags) {
+  using Num = typename T::number;
+  constexpr int P = Num::significand::digit_count;
+  constexpr int Target = P + GuardBits - 1;
+  // Filling stops once the top bit reaches Target: at most three
+  // bits above it.
+  using DV = DigitVector<std::uint64_t, (Target + 4 + 64) / 64>;
+
+  DV mag{};
+  bool full = false, sticky = false, point = false;
+  long bexp = 0; // value = mag · 2^bexp so far
+  const char *i = first;
+  for (; i != last; ++i) {
+    if (*i == '.' && !point) {
+      point = true;
+      continue;
+    }
+    const int d = hexNibble(*i);
+    if (d < 0)
+      break;
+    if (!full) {
+      if (d == 0 && isZero(mag)) { // leading zero: weight only
+        bexp -= point ? 4 : 0;
+        continue;
+      }
+      mag = shiftLeftDigits(mag, 4);
+      mag.d[0] |= std::uint64_t(d);
+      bexp -= point ? 4 : 0;
+      full = topBitPos(mag) >= Target;
+    } else {
+      sticky = sticky || d != 0;
+      bexp += point ? 0 : 4;
+    }
+  }
+
+  // A binary exponent only counts when it has digits ("0x1p" is
+  // "0x1"); it saturates like the decimal one.
+  if (i != last && (*i == 'p' || *i == 'P')) {
+    const char *j = i + 1;
+    bool eneg = false;
+    if (j != last && (*j == '+' || *j == '-')) {
+      eneg = *j == '-';
+      ++j;
+    }
+    if (j != last && *j >= '0' && *j <= '9') {
+      long v = 0;
+      for (; j != last && *j >= '0' && *j <= '9'; ++j) {
+        if (v < 1000000000)
+          v = v * 10 + (*j - '0');
+      }
+      bexp += eneg ? -v : v;
+      i = j;
+    }
+  }
+
+  flags = FlagNone;
+  if (isZero(mag)) {
+    out = packSpecial<T>(ValueCategory::Zero, neg);
+    return {i, std::errc{}};
+  }
+  const int msb = topBitPos(mag);
+  if (msb > Target)
+    mag = shiftRightStickyDigits(mag, msb - Target);
+  else
+    mag = shiftLeftDigits(mag, Target - msb);
+  if (sticky)
+    mag = withBit(mag, 0);
+  // Far past every format's range either way; keeps the epilogue's
+  // int exponent from wrapping on absurd inputs.
+  constexpr long Clamp = long(1) << 30;
+  long e2 = bexp + msb;
+  e2 = e2 > Clamp ? Clamp : e2 < -Clamp ? -Clamp : e2;
+  out = packParsed<T>(neg, e2, mag, flags);
+  return {i, std::errc{}};
+}
+
+// The parse proper, shared by fromChars and fromString: reads the
+// longest literal at the front of [first, last) and leaves the
+// result and its flags for the caller to deliver.
+template <typename T>
+std::from_chars_result parseChars(const char *first, const char *last,
+                                  typename T::storage_type &out,
+                                  flags_t &flags) {
+  const char *i = first;
   bool neg = false;
-  if (i < text.size() && (text[i] == '+' || text[i] == '-')) {
-    neg = text[i] == '-';
+  if (i != last && (*i == '+' || *i == '-')) {
+    neg = *i == '-';
     ++i;
   }
 
-  auto ieq = [&](std::string_view word) {
-    if (text.size() - i != word.size())
+  // Case-insensitive match of a word at i.
+  auto word = [&](std::string_view w) {
+    if (std::size_t(last - i) < w.size())
       return false;
-    for (size_t j = 0; j < word.size(); ++j) {
-      char c = text[i + j];
+    for (std::size_t j = 0; j < w.size(); ++j) {
+      char c = i[j];
       if (c >= 'A' && c <= 'Z')
         c = char(c - 'A' + 'a');
-      if (c != word[j])
+      if (c != w[j])
         return false;
     }
     return true;
   };
-  if (ieq("inf") || ieq("infinity"))
-    return deliver<T>(packSpecial<T>(ValueCategory::Infinity, neg), FlagNone);
-  if (ieq("nan"))
-    return deliver<T>(packSpecial<T>(ValueCategory::NaN, false), FlagNone);
+  flags = FlagNone;
+  if (word("inf")) {
+    i += word("infinity") ? 8 : 3;
+    out = packSpecial<T>(ValueCategory::Infinity, neg);
+    return {i, std::errc{}};
+  }
+  if (word("nan")) {
+    out = packSpecial<T>(ValueCategory::NaN, false);
+    return {i + 3, std::errc{}};
+  }
+  if (last - i > 2 && i[0] == '0' && (i[1] == 'x' || i[1] == 'X') &&
+      (hexNibble(i[2]) >= 0 ||
+       (i[2] == '.' && last - i > 3 && hexNibble(i[3]) >= 0)))
+    return parseHex<T>(neg, i + 2, last, out, flags);
 
-  // Digits, with at most one point.
-  std::string digits;
+  // Digits, with at most one point; runs of eight a word at a time.
+  DecimalText digits{i, nullptr, 0};
   long point_shift = 0; // digits after the '.' seen so far
-  bool seen_point = false, seen_digit = false;
-  for (; i < text.size(); ++i) {
-    char c = text[i];
-    if (c >= '0' && c <= '9') {
-      seen_digit = true;
-      digits.push_back(c);
-      if (seen_point)
+  for (; i != last; ++i) {
+    if constexpr (swar_available) {
+      while (last - i >= 8 && allDigits8(loadWord8(i))) {
+        digits.count += 8;
+        if (digits.point != nullptr)
+          point_shift += 8;
+        i += 8;
+      }
+      if (i == last)
+        break;
+    }
+    if (*i >= '0' && *i <= '9') {
+      ++digits.count;
+      if (digits.point != nullptr)
         ++point_shift;
-    } else if (c == '.' && !seen_point) {
-      seen_point = true;
+    } else if (*i == '.' && digits.point == nullptr) {
+      digits.point = i;
     } else {
       break;
     }
   }
-  if (!seen_digit)
-    return invalid();
+  if (digits.count == 0)
+    return {first, std::errc::invalid_argument};
 
+  // An exponent only counts when it has digits ("1e" is "1").
   long exp10 = 0;
-  if (i < text.size() && (text[i] == 'e' || text[i] == 'E')) {
-    ++i;
+  if (i != last && (*i == 'e' || *i == 'E')) {
+    const char *j = i + 1;
     bool eneg = false;
-    if (i < text.size() && (text[i] == '+' || text[i] == '-')) {
-      eneg = text[i] == '-';
-      ++i;
-    }
-    if (i >= text.size() || text[i] < '0' || text[i] > '9')
-      return invalid();
-    long v = 0;
-    for (; i < text.size() && text[i] >= '0' && text[i] <= '9'; ++i) {
-      if (v < 100000000)
-        v = v * 10 + (text[i] - '0');
-    }
-    exp10 = eneg ? -v : v;
-  }
-  if (i != text.size())
-    return invalid();
-
-  // Normalize: strip leading zeros; cap kept digits, folding the
-  // excess into sticky (they sit strictly below the rounding
-  // position once the kept prefix carries P + margin bits).
-  size_t lead = 0;
-  while (lead + 1 < digits.size() && digits[lead] == '0')
-    ++lead;
-  digits.erase(0, lead);
-  constexpr int P = T::number::significand::digit_count;
-  const int keep = int((std::int64_t(P) * 30103) / 100000) + 8;
-  bool tail_sticky = false;
-  if (int(digits.size()) > keep) {
-    for (size_t j = keep; j < digits.size(); ++j)
-      tail_sticky = tail_sticky || digits[j] != '0';
-    exp10 += long(digits.size()) - keep;
-    digits.resize(keep);
+    if (j != last && (*j == '+' || *j == '-')) {
+      eneg = *j == '-';
+      ++j;
+    }
+    if (j != last && *j >= '0' && *j <= '9') {
+      long v = 0;
+      for (; j != last && *j >= '0' && *j <= '9'; ++j) {
+        if (v < 100000000)
+          v = v * 10 + (*j - '0');
+      }
+      exp10 = eneg ? -v : v;
+      i = j;
+    }
+  }
+  const std::from_chars_result done{i, std::errc{}};
+  const std::from_chars_result window{i, std::errc::result_out_of_range};
+
+  // Normalize: strip leading zeros, and trailing ones into the
+  // exponent.
+  while (digits.count > 1 && digits[0] == '0')
+    digits = digits.dropFront();
+  if (digits[0] == '0') {
+    out = packSpecial<T>(ValueCategory::Zero, neg);
+    return done;
+  }
+  while (digits[digits.count - 1] == '0') {
+    --digits.count;
+    ++exp10;
   }
   const long q = exp10 - point_shift;
 
-  if (digits == "0" || digits.find_first_not_of('0') == std::string::npos)
-    return deliver<T>(packSpecial<T>(ValueCategory::Zero, neg), FlagNone);
+  if constexpr (parse_fast_path<T>) {
+    if (digits.count <= 19) {
+      if (parseFast<T>(neg, smallDecimalValue(digits), q, out, flags))
+        return done;
+    }
+  }
 
-  // Budget: n carries 3.33·digits bits; scaling by 10^q adds
-  // ≈ 3.33·|q| more (or the same again in shift for the division
-  // case).
-  const long qa = q < 0 ? -q : q;
-  const long need = (7 * (qa + long(digits.size()))) / 2 + P + 128;
-  typename T::storage_type out{};
+  // Long inputs: cut to a short prefix D and bracket. The value lies
+  // strictly between D·10^s and (D+1)·10^s, and rounding is
+  // monotone: if D-plus-sticky and an inexact D+1 round the same way
+  // with the same flags — and the same toward zero, so no
+  // representable value sits between them to be hit exactly —
+  // everything between does too. Otherwise parse every digit up to
+  // exact_parse_digits: past those, no representable value or
+  // rounding boundary can sit inside the cut, and the rest is
+  // sticky.
+  constexpr int P = T::number::significand::digit_count;
+  const long keep = long((std::int64_t(P) * 30103) / 100000) + 8;
+  if (digits.count > keep) {
+    using TZ = Type<typename T::number, typename T::layout,
+                    rounding::TowardZero, typename T::exceptions,
+                    typename T::platform, typename T::compute_format>;
+    const long s = q + digits.count - keep;
+    const DecimalText lo = digits.prefix(keep);
+    typename T::storage_type hi_out{}, lo_tz{}, hi_tz{};
+    flags_t hi_flags = FlagNone, tz_flags = FlagNone;
+    if (!parseExact<T>(neg, lo, s, true, false, out, flags) ||
+        !parseExact<T>(neg, lo, s, false, true, hi_out, hi_flags) ||
+        !parseExact<TZ>(neg, lo, s, true, false, lo_tz, tz_flags) ||
+        !parseExact<TZ>(neg, lo, s, false, true, hi_tz, tz_flags)) {
+      flags = FlagNone;
+      return parseBounded<T>(neg, digits, q, out, flags) ? done : window;
+    }
+    if (out == hi_out && flags == hi_flags && (hi_flags & FlagInexact) &&
+        lo_tz == hi_tz)
+      return done;
+
+    const long cap = exact_parse_digits<T>;
+    bool tail_sticky = false;
+    long shift = 0;
+    if (digits.count > cap) {
+      for (long j = cap; j < digits.count && !tail_sticky; ++j)
+        tail_sticky = digits[j] != '0';
+      shift = digits.count - cap;
+      digits = digits.prefix(cap);
+    }
+    flags = FlagNone;
+    return parseExact<T>(neg, digits, q + shift, tail_sticky, false, out,
+                         flags)
+               ? done
+               : window;
+  }
+
+  return parseExact<T>(neg, digits, q, false, false, out, flags) ||
+                 parseBounded<T>(neg, digits, q, out, flags)
+             ? done
+             : window;
+}
+
+// What fromChars returns: std::from_chars_result's ptr and ec, plus
+// the parsed value as T's Exceptions axis delivers it (bits, or
+// WithStatus<T> under ReturnStatus).
+template <typename T>
+using DeliveredType =
+    decltype(deliver<T, Operation::Parse>(typename T::storage_type{},
+                                          FlagNone));
+
+} // namespace detail
+
+template <typename T> struct FromCharsResult {
+  const char *ptr;
+  std::errc ec;
+  detail::DeliveredType<T> value;
+};
+
+// -----------------------------------------------------------------
+// fromChars — std::from_chars-style parse of a character range
+// -----------------------------------------------------------------
+// Reads the longest decimal literal at the front of [first, last):
+// [+-]? (ddd[.ddd] | .ddd) ([eE][+-]?ddd)?, a hex-float
+// [+-]? 0x (hhh[.hhh] | .hhh) ([pP][+-]?ddd)? (the nibbles are the
+// significand, no decimal work at all), or inf / infinity / nan
+// (case-insensitive). Never allocates. On success ptr is one past
+// it and ec is errc{}; the value is correctly rounded per T's
+// Rounding axis, with its flags (inexact, overflow, underflow)
+// delivered per T's Exceptions axis — overflow is a rounded result,
+// not an error. Otherwise the value is a quiet NaN delivered with
+// Invalid, and ec says why: invalid_argument (nothing matched; ptr
+// is first) or result_out_of_range (outside the decimal window, see
+// the header; ptr is past the literal).
+template <typename T>
+  requires(!detail::is_decimal<typename T::number>)
+FromCharsResult<T> fromChars(const char *first, const char *last) {
+  typename T::storage_type bits{};
   flags_t flags = FlagNone;
-  bool fit = detail::withDecimalBudget(need, [&](auto limbs) {
-    out = detail::parseFinite<T, decltype(limbs)::value>(neg, digits, q,
-                                                         tail_sticky, flags);
-  });
-  if (!fit)
-    return invalid(); // outside the decimal window (see header)
-  return deliver<T>(out, flags);
+  const auto r = detail::parseChars<T>(first, last, bits, flags);
+  if (r.ec != std::errc{})
+    return {r.ptr, r.ec,
+            detail::deliver<T, Operation::Parse>(
+                detail::packSpecial<T>(ValueCategory::NaN, false),
+                FlagInvalid)};
+  return {r.ptr, r.ec, detail::deliver<T, Operation::Parse>(bits, flags)};
+}
+
+// -----------------------------------------------------------------
+// fromString — correctly rounded parse through the shared epilogue
+// -----------------------------------------------------------------
+// Parses exactly the whole of text as fromChars does. Correctly
+// rounded per T's Rounding axis; flags (inexact, overflow,
+// underflow; Invalid for malformed or out-of-window input)
+// delivered per T's Exceptions axis.
+template <typename T>
+  requires(!detail::is_decimal<typename T::number>)
+auto fromString(std::string_view text) {
+  const char *first = text.data();
+  const char *last = first + text.size();
+  typename T::storage_type bits{};
+  flags_t flags = FlagNone;
+  const auto r = detail::parseChars<T>(first, last, bits, flags);
+  if (r.ec != std::errc{} || r.ptr != last)
+    return detail::deliver<T, Operation::Parse>(
+        detail::packSpecial<T>(ValueCategory::NaN, false), FlagInvalid);
+  return detail::deliver<T, Operation::Parse>(bits, flags);
+}
+
+// -----------------------------------------------------------------
+// parseMany — bulk parse of delimited numeric text
+// -----------------------------------------------------------------
+// Parses the numbers in buffer into out, in order, until either
+// runs out. Fields are separated by whitespace (any byte ≤ ' ') and
+// commas; whitespace runs are skipped, and each comma closes a
+// field, so an empty one — a leading comma, or two with only
+// whitespace between — still takes a slot, keeping CSV columns
+// aligned. Every token goes through the same parser as fromChars
+// (table tier first, exact tier when it cannot decide) and must be
+// a whole literal; one that is not, and every empty field, yields a
+// quiet NaN flagged Invalid.
+//
+// Token boundaries are found eight bytes at a time, and digit runs
+// scanned and converted eight at a time, with the SWAR helpers
+// above. Per-token flags land in flags[i] when that side array is
+// long enough (ReturnStatus Types have no other place to put them);
+// each token's flags also go through T's Exceptions axis as they
+// would from fromString. The buffer is taken as complete: a token
+// touching its end is parsed as is, so split streamed input at a
+// separator.
+struct ParseManyResult {
+  std::size_t count = 0;    // values written to out
+  std::size_t consumed = 0; // bytes of buffer read
+};
+
+template <typename T>
+  requires(!detail::is_decimal<typename T::number>)
+ParseManyResult parseMany(std::string_view buffer,
+                          std::span<typename T::storage_type> out,
+                          std::span<flags_t> flags = {}) {
+  using detail::deliver;
+  const char *const begin = buffer.data();
+  const char *const end = begin + buffer.size();
+  const char *p = begin;
+  std::size_t n = 0;
+
+  auto emit = [&](typename T::storage_type bits, flags_t f) {
+    auto d = deliver<T, Operation::Parse>(bits, f);
+    if constexpr (std::is_same_v<decltype(d), WithStatus<T>>)
+      out[n] = d.bits;
+    else
+      out[n] = d;
+    if (n < flags.size())
+      flags[n] = f;
+    ++n;
+  };
+  const auto nan = detail::packSpecial<T>(ValueCategory::NaN, false);
+
+  bool field_start = true; // nothing parsed since the last comma
+  while (n < out.size()) {
+    while (p != end && static_cast<unsigned char>(*p) <= ' ')
+      ++p;
+    if (p == end)
+      break;
+    if (*p == ',') {
+      if (field_start)
+        emit(nan, FlagInvalid); // empty field
+      field_start = true;
+      ++p;
+      continue;
+    }
+
+    const char *tok = p;
+    if constexpr (detail::swar_available) {
+      while (end - p >= 8) {
+        const int k = detail::firstSeparator8(detail::loadWord8(p));
+        p += k;
+        if (k < 8)
+          break;
+      }
+    }
+    while (p != end && static_cast<unsigned char>(*p) > ' ' && *p != ',')
+      ++p;
+
+    typename T::storage_type bits{};
+    flags_t f = FlagNone;
+    const auto r = detail::parseChars<T>(tok, p, bits, f);
+    if (r.ec != std::errc{} || r.ptr != p)
+      emit(nan, FlagInvalid);
+    else
+      emit(bits, f);
+    field_start = false;
+  }
+  return {n, std::size_t(p - begin)};
 }
 
 } // namespace opine
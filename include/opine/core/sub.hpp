@@ -16,8 +16,11 @@
 namespace opine {
 
 template <typename T>
+  requires(!detail::is_decimal<typename T::number> &&
+           !detail::is_hex_float<typename T::number> &&
+           !detail::is_fixed_point<typename T::number>)
 constexpr auto sub(typename T::storage_type a, typename T::storage_type b) {
-  return detail::addWithSign<T>(a, b, true);
+  return detail::addWithSign<T, Operation::Sub>(a, b);
 }
 
 } // namespace opine
@@ -48,6 +48,63 @@ template <int N>
 struct StorageFor<N> {
   using type = DigitVector<std::uint64_t, (N + 63) / 64>;
 };
+
+// -------------------------------------------------------------
+// Number-Layout consistency
+// -------------------------------------------------------------
+// FloatingPoint composites: the stored significand width plus the
+// implicit digit, if any, must equal the semantic significand digit
+// count. The stored exponent width must equal the exponent digit
+// count. The sign field must exist iff value_sign is Explicit.
+//
+// RadixComplement and DiminishedRadixComplement value_signs may
+// share the IEEE-shaped layout (sign_bits == 1): the MSB acts as
+// the sign discriminator, and the complement scheme covers the
+// whole word — that is rbj's / PDP-10's structural choice.
+//
+// Posit composites take the PositLayout of the same word and
+// supplement widths; HexFloat composites the HexFloatLayout with
+// their fraction width; FixedPoint composites the FixedPointLayout
+// of their word.
+template <typename Number, typename Layout>
+constexpr bool layoutMatchesNumber() {
+  if constexpr (is_posit<Number>) {
+    static_assert(is_posit_layout<Layout> &&
+                      Layout::total_bits == Number::total_digits &&
+                      Layout::exp_supplement_bits == Number::exponent_digits,
+                  "a Posit Number needs the PositLayout of the same width "
+                  "and exponent supplement");
+  } else if constexpr (is_decimal<Number>) {
+    static_assert((is_bid_layout<Layout> || is_dpd_layout<Layout>) &&
+                      Layout::exp_bits == Number::exponent::digit_count &&
+                      Layout::total_bits ==
+                          (Number::significand::digit_count + 2) * 32 / 9,
+                  "a decimal Number needs the BIDLayout or DPDLayout of its "
+                  "own width");
+  } else if constexpr (is_hex_float<Number>) {
+    static_assert(is_hex_float_layout<Layout> &&
+                      Layout::fraction_digits == Number::fraction_digits,
+                  "a HexFloat Number needs the HexFloatLayout of its "
+                  "fraction width");
+  } else if constexpr (is_fixed_point<Number>) {
+    static_assert(is_fixed_point_layout<Layout> &&
+                      Layout::total_bits == Number::total_digits,
+                  "a FixedPoint Number needs the FixedPointLayout of its "
+                  "word");
+  } else if constexpr (Number::is_composite) {
+    static_assert(Layout::sig_bits + (Layout::implicit_digit ? 1 : 0) ==
+                      Number::significand::digit_count,
+                  "layout stored significand + implicit digit must equal "
+                  "number's semantic significand digit count");
+    static_assert(Layout::exp_bits == Number::exponent::digit_count,
+                  "layout exponent width must equal number's exponent "
+                  "digit count");
+    static_assert(Number::value_sign != SignMethod::Explicit ||
+                      Layout::sign_bits == 1,
+                  "Explicit value_sign requires a 1-bit sign field");
+  }
+  return true;
+}
 } // namespace detail
 
 template <typename Number, typename Layout,
@@ -72,30 +129,7 @@ struct Type {
   static constexpr int swar_lanes =
       Platform::machine_word_bits / Layout::total_bits;
 
-  // -------------------------------------------------------------
-  // Number-Layout consistency (FloatingPoint composites)
-  // -------------------------------------------------------------
-  // The stored significand width plus the implicit digit, if any,
-  // must equal the semantic significand digit count. The stored
-  // exponent width must equal the exponent digit count. The sign
-  // field must exist iff value_sign is Explicit.
-  static_assert(!Number::is_composite ||
-                    Layout::sig_bits + (Layout::implicit_digit ? 1 : 0) ==
-                        Number::significand::digit_count,
-                "layout stored significand + implicit digit must equal "
-                "number's semantic significand digit count");
-  static_assert(!Number::is_composite ||
-                    Layout::exp_bits == Number::exponent::digit_count,
-                "layout exponent width must equal number's exponent "
-                "digit count");
-  static_assert(!Number::is_composite ||
-                    Number::value_sign != SignMethod::Explicit ||
-                    Layout::sign_bits == 1,
-                "Explicit value_sign requires a 1-bit sign field");
-  // RadixComplement and DiminishedRadixComplement value_signs may
-  // share the IEEE-shaped layout (sign_bits == 1): the MSB acts as
-  // the sign discriminator, and the complement scheme covers the
-  // whole word — that is rbj's / PDP-10's structural choice.
+  static_assert(detail::layoutMatchesNumber<Number, Layout>());
 };
 
 // -----------------------------------------------------------------
@@ -139,6 +173,74 @@ template <int E, int M>
 using FastType = Type<numbers::Relaxed<E, M>, layouts::IEEE<E, M, true>,
                       rounding::TowardZero, exceptions::Silent>;
 
+// Posits. PositType<N, ES> is any width and supplement; the named
+// sizes are the 2022 Posit Standard's, which fixes ES = 2 (the
+// earlier posit<8,0> / <16,1> / <32,2> / <64,3> family is
+// PositType<8, 0> and so on). Rounding is to nearest, ties to the
+// even pattern; no posit rounds to zero or to NaR.
+template <int N, int ES>
+using PositType = Type<Posit<N, ES>, PositLayout<N, ES>>;
+
+using posit8 = PositType<8, 2>;
+using posit16 = PositType<16, 2>;
+using posit32 = PositType<32, 2>;
+using posit64 = PositType<64, 2>;
+
+// IEEE 754 decimal, BID-encoded (the encoding x86 and most software
+// use). Arithmetic rounds per the Rounding axis like binary Types;
+// results carry IEEE 754's preferred exponent, so trailing zeros are
+// kept where exact (2.40 / 2 = 1.20).
+template <int K>
+using DecimalType = Type<numbers::IEEE754Decimal<K>, BIDLayout<K, K / 16 + 6>>;
+
+using decimal32 = DecimalType<32>;
+using decimal64 = DecimalType<64>;
+using decimal128 = DecimalType<128>;
+
+// The same formats DPD-encoded (IBM's hardware and data interchange).
+// Same Number, so the arithmetic is shared; convert between the two
+// encodings of one format is exact and flag-free.
+template <int K>
+using DecimalDPDType =
+    Type<numbers::IEEE754Decimal<K>, DPDLayout<K, K / 16 + 6>>;
+
+using decimal32dpd = DecimalDPDType<32>;
+using decimal64dpd = DecimalDPDType<64>;
+using decimal128dpd = DecimalDPDType<128>;
+
+// IBM hexadecimal floating point: short (6 fraction digits), long
+// (14) and extended (28). Rounding is TowardZero, which is how
+// System/360 through z/Architecture deliver HFP results — the
+// fraction is truncated; WithRounding gives the same format under
+// another mode (a rounding converter's ToNearestTiesAway, say).
+template <int N>
+using HexFloatType = Type<HexFloat<HexFloatLayout<N>::fraction_digits>,
+                          HexFloatLayout<N>, rounding::TowardZero>;
+
+using hfp32 = HexFloatType<32>;
+using hfp64 = HexFloatType<64>;
+using hfp128 = HexFloatType<128>;
+
+// Fixed point, Qm.n: m integer and n fraction bits under a sign
+// bit (UFixedPointType: no sign bit), saturating by default —
+// FixedPointType<0, 15, OverflowMode::Wrap> is plain int16_t
+// arithmetic read as Q15. Products and quotients round per the
+// Rounding axis; WithRounding<q15, rounding::TowardNegative> is the
+// arithmetic-shift truncation most DSP code does.
+template <int M, int N, OverflowMode Ov = OverflowMode::Saturate>
+using FixedPointType =
+    Type<FixedPoint<M, N, SignMethod::RadixComplement, Ov>,
+         FixedPointLayout<1 + M + N>>;
+
+template <int M, int N, OverflowMode Ov = OverflowMode::Saturate>
+using UFixedPointType = Type<FixedPoint<M, N, SignMethod::Unsigned, Ov>,
+                             FixedPointLayout<M + N>>;
+
+using q7 = FixedPointType<0, 7>;
+using q15 = FixedPointType<0, 15>;
+using q31 = FixedPointType<0, 31>;
+using q15_16 = FixedPointType<15, 16>;
+
 // The same Type computing at only K significand bits: operands are
 // truncated to their top K bits on the way into every arithmetic
 // operation, while storage, layout, and interchange stay identical
@@ -153,6 +255,22 @@ using WithComputePrecision =
          ComputeFormat<T::number::exponent::digit_count + 2, K,
                        T::rounding::guard_bits>>;
 
+// The same Type rounding per R. The compute format is R's default
+// (its guard bits are part of it), so WithRounding<T, R> is the
+// Type one would have spelled with R in the first place.
+template <typename T, typename R>
+using WithRounding = Type<typename T::number, typename T::layout, R,
+                          typename T::exceptions, typename T::platform>;
+
+// The same Type with another Exceptions policy: identical results,
+// with the flags handled as E says. WithExceptions<T,
+// exceptions::ReturnStatus> is how library code reads an
+// operation's flags whatever T does with them.
+template <typename T, typename E>
+using WithExceptions =
+    Type<typename T::number, typename T::layout, typename T::rounding, E,
+         typename T::platform, typename T::compute_format>;
+
 } // namespace opine
 
 #endif // OPINE_CORE_TYPE_HPP
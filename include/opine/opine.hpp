@@ -2,23 +2,32 @@
 #define OPINE_HPP
 
 #include "opine/core/add.hpp"
+#include "opine/core/batch.hpp"
 #include "opine/core/bits.hpp"
 #include "opine/core/classify.hpp"
 #include "opine/core/compare.hpp"
 #include "opine/core/compute_format.hpp"
 #include "opine/core/convert.hpp"
+#include "opine/core/counting.hpp"
+#include "opine/core/decimal.hpp"
 #include "opine/core/div.hpp"
+#include "opine/core/dynamic.hpp"
 #include "opine/core/exceptions.hpp"
 #include "opine/core/extremes.hpp"
+#include "opine/core/fixed_point.hpp"
 #include "opine/core/fma.hpp"
+#include "opine/core/hfp.hpp"
+#include "opine/core/integer.hpp"
 #include "opine/core/layout.hpp"
 #include "opine/core/mul.hpp"
 #include "opine/core/neg_abs.hpp"
 #include "opine/core/number.hpp"
 #include "opine/core/pack_unpack.hpp"
 #include "opine/core/platform.hpp"
+#include "opine/core/posit.hpp"
 #include "opine/core/round_pack.hpp"
 #include "opine/core/rounding.hpp"
+#include "opine/core/scratch.hpp"
 #include "opine/core/sqrt.hpp"
 #include "opine/core/string.hpp"
 #include "opine/core/sub.hpp"
@@ -19,6 +19,14 @@
 //   - Round-trip theorems: where exact_conversion<Src, Dst> holds,
 //     convert<Src, Dst>(convert<Dst, Src>(x)) == x for every
 //     non-NaN pattern, and NaN patterns come back as Src's NaN.
+//   - The exact-pair fast path against the rounding kernel, bits
+//     and flags, over every FP8 and 16-bit source pattern.
+//   - Table conversion (convertByTable) against convert, bits and
+//     flags, over every FP8 and 16-bit source pattern.
+//   - convertVia against the direct conversion, bits and flags:
+//     every 16-bit source through a to-odd intermediate into FP8
+//     under each rounding mode, and sampled float64 → FP8 through
+//     float32.
 
 #define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
 #include <doctest/doctest.h>
@@ -250,6 +258,222 @@ TEST_CASE("convert: round-trip identity where exact_conversion holds") {
   verifyRoundTrip<bfloat16, float32>("bf16<->f32");
 }
 
+// -----------------------------------------------------------------
+// Exact-pair fast path
+// -----------------------------------------------------------------
+// field_copy_conversion pairs skip the rounding kernel for finite
+// values; over every source pattern they must give the kernel's
+// bits AND flags.
+static_assert(opine::detail::field_copy_conversion<float16, float32>);
+static_assert(opine::detail::field_copy_conversion<fp8_e4m3, bfloat16>);
+static_assert(opine::detail::field_copy_conversion<float32, float64>);
+static_assert(!opine::detail::field_copy_conversion<extFloat80, float128>);
+static_assert(!opine::detail::field_copy_conversion<float128, float256>);
+static_assert(!opine::detail::field_copy_conversion<float32, float16>);
+
+template <typename Src, typename Dst> void verifyFastPath(const char *Name) {
+  static_assert(opine::detail::field_copy_conversion<Src, Dst>);
+  using DstS = Type<typename Dst::number, typename Dst::layout,
+                    typename Dst::rounding, exceptions::ReturnStatus>;
+  using SrcBits = typename Src::storage_type;
+  constexpr uint64_t Count = uint64_t{1} << Src::layout::total_bits;
+
+  int Failed = 0;
+  for (uint64_t I = 0; I < Count; ++I) {
+    const auto Fast = convert<DstS, Src>(SrcBits(I));
+    const auto Slow = opine::detail::convertRounded<DstS, Src>(SrcBits(I));
+    if (Fast.bits != Slow.bits || Fast.flags != Slow.flags) {
+      if (Failed < 5)
+        std::fprintf(stderr, "  FAIL %s fast path: x=0x%llx\n", Name,
+                     (unsigned long long)I);
+      ++Failed;
+    }
+  }
+  CHECK(Failed == 0);
+}
+
+TEST_CASE("convert: exact-pair fast path matches the kernel (exhaustive)") {
+  verifyFastPath<fp8_e5m2, float16>("e5m2->f16");
+  verifyFastPath<fp8_e4m3, float16>("e4m3->f16");
+  verifyFastPath<fp8_e4m3fnuz, float16>("e4m3fnuz->f16");
+  verifyFastPath<RbjType<4, 3>, float16>("rbj43->f16");
+  verifyFastPath<FastType<4, 3>, bfloat16>("fast43->bf16");
+  verifyFastPath<fp8_e4m3, bfloat16>("e4m3->bf16");
+  verifyFastPath<fp8_e5m2, float32>("e5m2->f32");
+  verifyFastPath<float16, float32>("f16->f32");
+  verifyFastPath<bfloat16, float32>("bf16->f32");
+  verifyFastPath<float16, float64>("f16->f64");
+  verifyFastPath<float16, float128>("f16->f128");
+}
+
+// -----------------------------------------------------------------
+// Table conversion
+// -----------------------------------------------------------------
+// convertByTable must be convert, bits and flags, on every pattern:
+// 8-bit tables built at compile time, 16-bit ones on first use.
+static_assert(convertByTable<float32, fp8_e4m3>(0x38) ==
+              convert<float32, fp8_e4m3>(0x38));
+
+// A source narrower than its storage word: bits above the Layout
+// are ignored, as convert ignores them, and never index past the
+// table (out of bounds would not be a constant expression).
+using fp6_e3m2 = IEEE754Type<3, 2>;
+static_assert(convertByTable<float32, fp6_e3m2>(0xC0 | 0x0C) ==
+              convert<float32, fp6_e3m2>(0x0C));
+static_assert(convertByTable<float32, fp6_e3m2>(0xFF) ==
+              convert<float32, fp6_e3m2>(0xFF));
+
+template <typename Src, typename Dst> void verifyTable(const char *Name) {
+  using DstS = WithExceptions<Dst, exceptions::ReturnStatus>;
+  using SrcBits = typename Src::storage_type;
+  constexpr uint64_t Count = uint64_t{1} << Src::layout::total_bits;
+
+  int Failed = 0;
+  for (uint64_t I = 0; I < Count; ++I) {
+    const auto Table = convertByTable<DstS, Src>(SrcBits(I));
+    const auto Kernel = convert<DstS, Src>(SrcBits(I));
+    if (Table.bits != Kernel.bits || Table.flags != Kernel.flags) {
+      if (Failed < 5)
+        std::fprintf(stderr, "  FAIL %s table: x=0x%llx\n", Name,
+                     (unsigned long long)I);
+      ++Failed;
+    }
+  }
+  CHECK(Failed == 0);
+}
+
+TEST_CASE("convert: table conversion matches the kernel (exhaustive)") {
+  verifyTable<fp8_e4m3, float32>("e4m3->f32");
+  verifyTable<fp8_e5m2, fp8_e4m3>("e5m2->e4m3");
+  verifyTable<RbjType<4, 3>, fp8_e4m3fnuz>("rbj43->e4m3fnuz");
+  verifyTable<float16, float32>("f16->f32");
+  verifyTable<float16, fp8_e4m3>("f16->e4m3");
+  verifyTable<bfloat16, fp8_e5m2>("bf16->e5m2");
+  verifyTable<bfloat16, float16>("bf16->f16");
+
+  // Flags go through Dst's own axis; the table is shared.
+  using F = WithExceptions<fp8_e4m3, exceptions::StatusFlags>;
+  clearStatusFlags();
+  convertByTable<F, float16>(0x7BFF); // 65504: overflows e4m3
+  CHECK(statusFlags() == (FlagOverflow | FlagInexact));
+  clearStatusFlags();
+  CHECK(&conversionTable<F, float16>() ==
+        &conversionTable<fp8_e4m3, float16>());
+
+  // A 12-bit source in a 16-bit word, with garbage above bit 11.
+  using Fp12 = IEEE754Type<5, 6>;
+  using F32S = WithExceptions<float32, exceptions::ReturnStatus>;
+  int Failed = 0;
+  for (uint32_t I = 0; I < 0x1000; ++I) {
+    const uint16_t X = uint16_t(I | 0xA000);
+    const auto Table = convertByTable<F32S, Fp12>(X);
+    const auto Kernel = convert<F32S, Fp12>(X);
+    Failed += Table.bits != Kernel.bits || Table.flags != Kernel.flags ||
+              Table.bits != convert<F32S, Fp12>(uint16_t(I)).bits;
+  }
+  CHECK(Failed == 0);
+}
+
+// -----------------------------------------------------------------
+// Conversion through a to-odd intermediate
+// -----------------------------------------------------------------
+static_assert(via_correctly_rounded<float32, fp8_e4m3>);
+static_assert(via_correctly_rounded<float16, fp8_e5m2>);
+static_assert(via_correctly_rounded<bfloat16, fp8_e4m3fnuz>);
+static_assert(via_correctly_rounded<float32, bfloat16>);
+static_assert(!via_correctly_rounded<bfloat16, float16>); // precision
+static_assert(!via_correctly_rounded<float16, bfloat16>); // range
+static_assert(!via_correctly_rounded<bfloat16, IEEE754Type<5, 6>>); // one short
+static_assert(!via_correctly_rounded<FastType<8, 23>, fp8_e4m3>); // flushes
+
+template <typename Src, typename Mid, typename Dst, typename Iter>
+void verifyVia(const char *Name, Iter &&Values) {
+  using DstS = WithExceptions<Dst, exceptions::ReturnStatus>;
+  using SrcBits = typename Src::storage_type;
+
+  int Failed = 0;
+  Values([&](SrcBits X) {
+    const auto Via = convertVia<DstS, Mid, Src>(X);
+    const auto Direct = convert<DstS, Src>(X);
+    if (Via.bits != Direct.bits || Via.flags != Direct.flags) {
+      if (Failed < 5) {
+        std::fprintf(stderr, "  FAIL %s via: x=0x", Name);
+        printHex(stderr, X, (Src::layout::total_bits + 3) / 4);
+        std::fprintf(stderr, "\n");
+      }
+      ++Failed;
+    }
+  });
+  CHECK(Failed == 0);
+}
+
+template <typename Src, typename Mid, typename Dst>
+void verifyViaExhaustive(const char *Name) {
+  verifyVia<Src, Mid, Dst>(
+      Name, ExhaustiveSingles<typename Src::storage_type,
+                              Src::layout::total_bits>{});
+}
+
+// Each rounding mode of Dst; to odd included.
+template <typename Src, typename Mid, typename Dst>
+void verifyViaAllModes(const char *Name) {
+  verifyViaExhaustive<Src, Mid, Dst>(Name);
+  verifyViaExhaustive<Src, Mid, WithRounding<Dst, rounding::TowardZero>>(
+      Name);
+  verifyViaExhaustive<Src, Mid,
+                      WithRounding<Dst, rounding::TowardPositive>>(Name);
+  verifyViaExhaustive<Src, Mid,
+                      WithRounding<Dst, rounding::TowardNegative>>(Name);
+  verifyViaExhaustive<Src, Mid,
+                      WithRounding<Dst, rounding::ToNearestTiesAway>>(Name);
+  verifyViaExhaustive<Src, Mid, WithRounding<Dst, rounding::ToOdd>>(Name);
+}
+
+TEST_CASE("convert: convertVia matches the direct conversion") {
+  verifyViaAllModes<float16, bfloat16, fp8_e4m3>("f16->bf16->e4m3");
+  verifyViaAllModes<float16, bfloat16, fp8_e5m2>("f16->bf16->e5m2");
+  verifyViaAllModes<bfloat16, float16, fp8_e4m3fnuz>("bf16->f16->e4m3fnuz");
+  verifyViaAllModes<bfloat16, float16, RbjType<4, 3>>("bf16->f16->rbj43");
+  verifyViaAllModes<float16, float32, fp8_e4m3>("f16->f32->e4m3");
+
+  // float64 → FP8 through float32, the hardware-assisted route.
+  std::vector<uint64_t> Values;
+  ExponentStratifiedSingles<float64, 2>{0xC0417E47ULL}(
+      [&](uint64_t X) { Values.push_back(X); });
+  RandomSingles<uint64_t, 64>{0x0417E5EEDULL, 20000}(
+      [&](uint64_t X) { Values.push_back(X); });
+  // Just above and below every FP8 rounding boundary, as float64.
+  for (uint64_t Y = 0; Y < 0x100; ++Y) {
+    const uint64_t B = convert<float64, fp8_e4m3>(uint8_t(Y));
+    const uint64_t Half = uint64_t{1} << 48; // below e4m3's last place
+    for (uint64_t D : {Half - 1, Half, Half + 1})
+      for (uint64_t X : {B + D, B - D})
+        Values.push_back(X);
+  }
+  auto Sampled = [&](auto &&Callback) {
+    for (uint64_t X : Values)
+      Callback(X);
+  };
+  verifyVia<float64, float32, fp8_e4m3>("f64->f32->e4m3", Sampled);
+  verifyVia<float64, float32, fp8_e5m2>("f64->f32->e5m2", Sampled);
+  verifyVia<float64, float32,
+            WithRounding<fp8_e4m3, rounding::TowardNegative>>(
+      "f64->f32->e4m3 down", Sampled);
+  // bfloat16 shares float32's top binade: a float64 beyond it
+  // saturates at float32 and must still overflow.
+  verifyVia<float64, float32,
+            WithRounding<bfloat16, rounding::TowardZero>>(
+      "f64->f32->bf16 truncating", Sampled);
+
+  // The plain chain double-rounds: a float16 tie in FP8 that bfloat16
+  // rounding had already moved.
+  int Differ = 0;
+  for (uint32_t X = 0; X < 0x10000; ++X)
+    Differ += convert<fp8_e4m3, bfloat16>(convert<bfloat16, float16>(
+                  uint16_t(X))) != convert<fp8_e4m3, float16>(uint16_t(X));
+  CHECK(Differ > 0);
+}
+
 // -----------------------------------------------------------------
 // binary256/512/1024 (DigitVector storage — both compilers)
 // -----------------------------------------------------------------
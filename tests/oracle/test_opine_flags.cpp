@@ -10,11 +10,22 @@
 // which shares code with the library's G/R/S-based flag path.
 //
 // A StatusFlags case checks the other delivery policy: sticky
-// per-thread accumulation, cleared on demand.
+// per-thread accumulation, cleared on demand. A Trap case checks
+// handler dispatch: enabled flags only, substitution, and the
+// default-handling fallback. A Scoped case checks FlagScope
+// nesting, the merge on exit and the §9.3 save/restore operations.
+// A Counting case checks the per-Operation counters across threads
+// and their dumps. An Alternate case checks §8 substitution and
+// abrupt underflow against a second pass over ReturnStatus results.
+// A batch case checks the *Many forms: per-element
+// flags (dense and sparse) equal to the scalar ops', and the SWAR
+// flag-array reductions against byte loops.
 
 #define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
 #include <doctest/doctest.h>
 
+#include <thread>
+
 #include "harness/impl_mpfr.hpp"
 #include "harness/impl_opine.hpp"
 #include "harness/test_harness.hpp"
@@ -120,3 +131,357 @@ TEST_CASE("flags: ReturnStatus returns {bits, flags}") {
   auto boom = div<T>(one.bits, fromNative<T>(0.0f).bits);
   CHECK(boom.flags == FlagDivByZero);
 }
+
+// -----------------------------------------------------------------
+// Trap policy: handlers per flag, per Type, per thread
+// -----------------------------------------------------------------
+namespace {
+using TrapT = Type<numbers::IEEE754<4, 3>, layouts::IEEE<4, 3, true>,
+                   rounding::Default, exceptions::Trap>;
+using InexactTrapT =
+    Type<numbers::IEEE754<4, 3>, layouts::IEEE<4, 3, true>, rounding::Default,
+         exceptions::TrapOn<FlagInexact>>;
+using Plain = Type<numbers::IEEE754<4, 3>, layouts::IEEE<4, 3, true>>;
+
+int trapCalls = 0;
+flags_t trapSeen = FlagNone;
+
+TrapT::storage_type recordTrap(TrapT::storage_type r, flags_t f) {
+  ++trapCalls;
+  trapSeen = f;
+  return r;
+}
+TrapT::storage_type clampTrap(TrapT::storage_type r, flags_t) {
+  return opine::detail::packMaxFinite<TrapT>((r & 0x80) != 0);
+}
+} // namespace
+
+TEST_CASE("flags: Trap policy calls handlers on enabled flags only") {
+  const auto one = fromNative<Plain>(1.0f);
+  const auto maxf = opine::detail::packMaxFinite<TrapT>(false);
+  const auto zero = fromNative<Plain>(0.0f);
+  const auto three = fromNative<Plain>(3.0f);
+
+  // Same bits as the untrapped Type, handler or not.
+  CHECK(add<TrapT>(maxf, maxf) == add<Plain>(maxf, maxf));
+
+  clearStatusFlags();
+  CHECK(setTrapHandler<TrapT>(FlagOverflow | FlagDivByZero, recordTrap) ==
+        nullptr);
+  trapCalls = 0;
+  add<TrapT>(one, one); // exact
+  div<TrapT>(one, three); // inexact only: not enabled
+  CHECK(trapCalls == 0);
+  add<TrapT>(maxf, maxf);
+  CHECK(trapCalls == 1);
+  CHECK(trapSeen == (FlagOverflow | FlagInexact));
+  div<TrapT>(one, zero);
+  CHECK(trapCalls == 2);
+  CHECK(trapSeen == FlagDivByZero);
+  CHECK(statusFlags() == FlagNone); // handled: nothing raised
+
+  // A substitute result: overflow clamps instead of going to Inf.
+  CHECK(setTrapHandler<TrapT>(FlagOverflow, clampTrap) == recordTrap);
+  CHECK(add<TrapT>(maxf, maxf) == maxf);
+  CHECK(mul<TrapT>(maxf ^ 0x80, maxf) ==
+        opine::detail::packMaxFinite<TrapT>(true));
+
+  // Invalid is enabled but unhandled: §7 default handling.
+  sub<TrapT>(add<Plain>(maxf, maxf), add<Plain>(maxf, maxf)); // Inf - Inf
+  CHECK(statusFlags() == FlagInvalid);
+  clearStatusFlags();
+
+  // Handlers belong to the Type: another Type's table is empty.
+  int before = trapCalls;
+  div<InexactTrapT>(one, three);
+  CHECK(trapCalls == before);
+  CHECK(statusFlags() == FlagInexact);
+  clearStatusFlags();
+
+  setTrapHandler<TrapT>(FlagOverflow | FlagDivByZero, nullptr);
+  CHECK(add<TrapT>(maxf, maxf) == add<Plain>(maxf, maxf));
+  CHECK(statusFlags() == (FlagOverflow | FlagInexact));
+  clearStatusFlags();
+}
+
+// -----------------------------------------------------------------
+// Scoped policy: flags into the innermost FlagScope
+// -----------------------------------------------------------------
+TEST_CASE("flags: Scoped policy raises into the innermost FlagScope") {
+  using T = Type<numbers::IEEE754<4, 3>, layouts::IEEE<4, 3, true>,
+                 rounding::Default, exceptions::Scoped>;
+  const auto one = fromNative<Plain>(1.0f);
+  const auto three = fromNative<Plain>(3.0f);
+  const auto zero = fromNative<Plain>(0.0f);
+  const auto maxf = opine::detail::packMaxFinite<T>(false);
+
+  // Outside any scope: the sticky set, as StatusFlags.
+  clearStatusFlags();
+  CHECK(div<T>(one, three) == div<Plain>(one, three));
+  CHECK(statusFlags() == FlagInexact);
+  clearStatusFlags();
+
+  {
+    FlagScope outer;
+    add<T>(maxf, maxf);
+    CHECK(outer.raised == (FlagOverflow | FlagInexact));
+    {
+      FlagScope inner;
+      div<T>(one, zero);
+      CHECK(inner.raised == FlagDivByZero);
+      CHECK(saveAllFlags() == FlagDivByZero);
+      CHECK_FALSE(outer.test(FlagDivByZero)); // not yet merged
+    }
+    CHECK(outer.raised == (FlagOverflow | FlagInexact | FlagDivByZero));
+    CHECK(statusFlags() == FlagNone); // deferred, not lost
+
+    // §9.3: save, run, restore one group.
+    const flags_t saved = saveAllFlags();
+    outer.clear();
+    sub<T>(add<Plain>(maxf, maxf), add<Plain>(maxf, maxf)); // Inf - Inf
+    CHECK(saveAllFlags() == FlagInvalid);
+    restoreFlags(saved, FlagOverflow | FlagDivByZero);
+    CHECK(saveAllFlags() == (FlagInvalid | FlagOverflow | FlagDivByZero));
+    CHECK(testSavedFlags(saved, FlagInexact));
+    CHECK_FALSE(testSavedFlags(saved, FlagInvalid | FlagUnderflow));
+
+    // As a context object: ReturnStatus results, no thread binding.
+    outer.clear();
+    FlagScope local;
+    CHECK(local(div<IeeeS<4, 3>>(one, three)) == div<Plain>(one, three));
+    CHECK(local.raised == FlagInexact);
+    local.clear(FlagInexact);
+    CHECK(local.raised == FlagNone);
+    local.raise(FlagUnderflow);
+  }
+  CHECK(statusFlags() == FlagUnderflow);
+  clearStatusFlags();
+}
+
+// -----------------------------------------------------------------
+// Counting policy: per-Type, per-Operation counters
+// -----------------------------------------------------------------
+TEST_CASE("flags: Counting policy counts ops and flags across threads") {
+  using C = Type<numbers::IEEE754<4, 3>, layouts::IEEE<4, 3, true>,
+                 rounding::Default, exceptions::Counting<>>;
+  using CS = Type<numbers::IEEE754<4, 3>, layouts::IEEE<4, 3, true>,
+                  rounding::Default,
+                  exceptions::Counting<exceptions::ReturnStatus>>;
+  const auto one = fromNative<Plain>(1.0f);
+  const auto three = fromNative<Plain>(3.0f);
+  const auto zero = fromNative<Plain>(0.0f);
+  const auto maxf = opine::detail::packMaxFinite<C>(false);
+
+  auto work = [&] {
+    add<C>(one, one);          // exact
+    sub<C>(maxf ^ 0x80, maxf); // overflows
+    div<C>(one, three);        // inexact
+    div<C>(one, zero);         // divides by zero
+  };
+  work();
+  std::thread other(work);
+  other.join(); // its shard retires into the totals
+
+  const FlagCounts c = flagCounts<C>();
+  CHECK(c.calls[int(Operation::Add)] == 2);
+  CHECK(c.calls[int(Operation::Sub)] == 2);
+  CHECK(c.calls[int(Operation::Div)] == 4);
+  CHECK(c.calls[int(Operation::Mul)] == 0);
+  CHECK(c.count(Operation::Sub, FlagOverflow) == 2);
+  CHECK(c.count(Operation::Sub, FlagInexact) == 2);
+  CHECK(c.count(Operation::Div, FlagInexact) == 2);
+  CHECK(c.count(Operation::Div, FlagDivByZero) == 2);
+  CHECK(c.count(Operation::Add, FlagInexact) == 0);
+  CHECK(add<C>(one, three) == add<Plain>(one, three));
+
+  // The wrapped policy still applies; each Type counts apart.
+  const auto r = div<CS>(one, zero);
+  CHECK(r.flags == FlagDivByZero);
+  CHECK(flagCounts<CS>().calls[int(Operation::Div)] == 1);
+  CHECK(flagCounts<C>().calls[int(Operation::Div)] == 4);
+
+  CHECK(toText(flagCounts<CS>()) ==
+        "div calls=1 invalid=0 divByZero=1 overflow=0 underflow=0 "
+        "inexact=0\n");
+  CHECK(toJson(flagCounts<CS>()) ==
+        "{\"div\": {\"calls\": 1, \"invalid\": 0, \"divByZero\": 1, "
+        "\"overflow\": 0, \"underflow\": 0, \"inexact\": 0}}");
+}
+
+// -----------------------------------------------------------------
+// Alternate policy: §8 substitution and abrupt underflow
+// -----------------------------------------------------------------
+namespace {
+// The second pass Alternate replaces: a ReturnStatus result
+// rewritten after the fact.
+template <typename T>
+std::pair<std::uint8_t, flags_t> postProcess(WithStatus<T> r) {
+  using P = Type<typename T::number, typename T::layout>;
+  std::uint8_t bits = r.bits;
+  flags_t f = r.flags;
+  const bool minus = isSignMinus<P>(bits);
+  if (!isZero<P>(bits) && isFinite<P>(bits) &&
+      (isSubnormal<P>(bits) || (f & FlagUnderflow) != 0)) {
+    bits = minus ? 0x80 : 0x00;
+    f |= FlagUnderflow | FlagInexact;
+  }
+  if ((f & FlagOverflow) != 0)
+    bits = opine::detail::packMaxFinite<P>(minus);
+  else if ((f & FlagInvalid) != 0)
+    bits = 0x00;
+  return {bits, f};
+}
+} // namespace
+
+TEST_CASE("flags: Alternate policy substitutes in place of a second pass") {
+  using namespace exceptions;
+  using A = Type<numbers::IEEE754<4, 3>, layouts::IEEE<4, 3, true>,
+                 rounding::Default,
+                 Alternate<SubstituteXor<FlagOverflow, substitutes::MaxFinite>,
+                           Substitute<FlagInvalid, substitutes::Zero>,
+                           AbruptUnderflow, RecordException>>;
+  using S = IeeeS<4, 3>;
+
+  // Every ordered FP8 pair through mul and div.
+  for (int x = 0; x < 256; ++x)
+    for (int y = 0; y < 256; ++y) {
+      const std::uint8_t a = std::uint8_t(x), b = std::uint8_t(y);
+      for (int op = 0; op < 2; ++op) {
+        clearStatusFlags();
+        const std::uint8_t got = op == 0 ? mul<A>(a, b) : div<A>(a, b);
+        const auto want =
+            postProcess<S>(op == 0 ? mul<S>(a, b) : div<S>(a, b));
+        REQUIRE(got == want.first);
+        REQUIRE(statusFlags() == want.second);
+      }
+    }
+  clearStatusFlags();
+
+  // Constant evaluation applies the substitution too.
+  constexpr auto maxf = opine::detail::packMaxFinite<A>(false);
+  static_assert(add<A>(maxf, maxf) == maxf);
+  static_assert(mul<A>(maxf ^ 0x80, maxf) == (maxf ^ 0x80));
+
+  // SubstituteXor signs its substitute; Substitute does not. Bits<>
+  // is an exact pattern.
+  using B = Type<numbers::IEEE754<4, 3>, layouts::IEEE<4, 3, true>,
+                 rounding::Default,
+                 Alternate<Substitute<FlagOverflow | FlagDivByZero,
+                                      substitutes::Infinity>,
+                           Substitute<FlagInvalid, substitutes::Bits<0x55>>>>;
+  const auto one = fromNative<Plain>(1.0f);
+  const auto zero = fromNative<Plain>(0.0f);
+  const auto inf = add<Plain>(maxf, maxf);
+  CHECK(div<B>(one ^ 0x80, zero) == inf);
+  CHECK(sub<B>(inf, inf) == 0x55);
+  CHECK(statusFlags() == FlagNone); // nothing recorded without it
+
+  // An invalid product or quotient's default NaN is positive, but
+  // SubstituteXor gives it §8.3's XOR of the operands' signs, in the
+  // scalar kernels and the batch loop alike.
+  using C = Type<numbers::IEEE754<4, 3>, layouts::IEEE<4, 3, true>,
+                 rounding::Default,
+                 Alternate<SubstituteXor<FlagInvalid, substitutes::Zero>>>;
+  CHECK(mul<C>(zero ^ 0x80, inf) == 0x80);
+  CHECK(mul<C>(inf ^ 0x80, zero ^ 0x80) == 0x00);
+  CHECK(div<C>(zero ^ 0x80, zero) == 0x80);
+  CHECK(div<C>(inf, inf ^ 0x80) == 0x80);
+  CHECK(div<C>(inf, inf) == 0x00);
+  const std::uint8_t a[] = {std::uint8_t(zero ^ 0x80), inf, zero};
+  const std::uint8_t m[] = {inf, std::uint8_t(zero ^ 0x80), inf};
+  const std::uint8_t d[] = {zero, std::uint8_t(inf ^ 0x80), zero};
+  std::uint8_t prod[3], quot[3];
+  mulMany<C>(std::span(a), std::span(m), std::span(prod));
+  divMany<C>(std::span(a), std::span(d), std::span(quot));
+  CHECK(prod[0] == 0x80);
+  CHECK(prod[1] == 0x80);
+  CHECK(prod[2] == 0x00);
+  CHECK(quot[0] == 0x80);
+  CHECK(quot[1] == 0x80);
+  CHECK(quot[2] == 0x00);
+}
+
+// -----------------------------------------------------------------
+// Batch operations: per-element flags
+// -----------------------------------------------------------------
+TEST_CASE("flags: batch ops keep per-element flags") {
+  using S = IeeeS<4, 3>;
+  using B = Plain::storage_type;
+
+  // Every ordered pair of FP8 operands, as two columns.
+  std::vector<B> a, b;
+  for (int x = 0; x < 256; ++x)
+    for (int y = 0; y < 256; ++y) {
+      a.push_back(B(x));
+      b.push_back(B(y));
+    }
+  const std::size_t n = a.size();
+  std::vector<B> out(n), out3(n);
+  std::vector<flags_t> flags(n);
+
+  CHECK(divMany<Plain>(a, b, out, std::span(flags)) == n);
+  for (std::size_t i = 0; i < n; ++i) {
+    const auto r = div<S>(a[i], b[i]);
+    REQUIRE(out[i] == r.bits);
+    REQUIRE(flags[i] == r.flags);
+  }
+  CHECK(fmaMany<Plain>(a, b, b, out3) == n);
+  for (std::size_t i = 0; i < n; ++i)
+    REQUIRE(out3[i] == fma<Plain>(a[i], b[i], b[i]));
+
+  // The reductions agree with byte loops, over every tail length.
+  for (std::size_t len : {std::size_t(0), std::size_t(5), std::size_t(8),
+                          std::size_t(61), n}) {
+    const std::span<const flags_t> f(flags.data(), len);
+    flags_t any = FlagNone;
+    std::size_t hits = 0;
+    std::vector<std::size_t> want;
+    for (std::size_t i = 0; i < len; ++i) {
+      any = flags_t(any | f[i]);
+      if ((f[i] & (FlagDivByZero | FlagOverflow)) != 0) {
+        ++hits;
+        want.push_back(i);
+      }
+    }
+    CHECK(anyFlags(f) == any);
+    CHECK(countFlags(f, FlagDivByZero | FlagOverflow) == hits);
+    std::vector<std::size_t> got(hits);
+    CHECK(findFlags(f, FlagDivByZero | FlagOverflow, got) == hits);
+    CHECK(got == want);
+  }
+
+  // Sparse form: the same indices, in the same pass, and a count
+  // that runs past a short index array.
+  std::vector<std::size_t> index(8);
+  FlagList list{index, FlagDivByZero};
+  divMany<Plain>(a, b, out, list);
+  std::vector<std::size_t> all(n);
+  const std::size_t dz = findFlags(flags, FlagDivByZero, all);
+  CHECK(list.count == dz);
+  CHECK(list.count > index.size());
+  CHECK(std::equal(index.begin(), index.end(), all.begin()));
+  CHECK(list.any == anyFlags(flags));
+
+  // T's own axis still sees every element's flags.
+  using SF = Type<numbers::IEEE754<4, 3>, layouts::IEEE<4, 3, true>,
+                  rounding::Default, exceptions::StatusFlags>;
+  clearStatusFlags();
+  std::vector<B> sq(n);
+  CHECK(sqrtMany<SF>(std::span<const B>(b.data(), 256), sq) == 256);
+  CHECK(statusFlags() == (FlagInvalid | FlagInexact));
+  clearStatusFlags();
+
+  // convertMany: float32 to FP8, flags as convert<S, float32> gives.
+  const float xs[] = {1.0f, 0.1f, 1e6f, -1e-9f, 240.0f};
+  std::vector<float32::storage_type> src;
+  for (float x : xs)
+    src.push_back(fromNative<float32>(x));
+  std::vector<B> dst(src.size());
+  std::vector<flags_t> cf(src.size());
+  CHECK(convertMany<Plain, float32>(src, dst, std::span(cf)) == src.size());
+  for (std::size_t i = 0; i < src.size(); ++i) {
+    const auto r = convert<S, float32>(src[i]);
+    CHECK(dst[i] == r.bits);
+    CHECK(cf[i] == r.flags);
+  }
+}
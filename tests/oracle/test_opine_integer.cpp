@@ -0,0 +1,376 @@
+// OPINE-vs-MPFR integer conversion tests: fromInt and toInt.
+//
+// The oracle for fromInt<T>(i) is mpfr_set_z (exact at working
+// precision) followed by mpfrRoundToFormat<T>, with the flags from
+// mpfrFlags — the same two halves convert's oracle composes. The
+// oracle for toInt<Int, T>(x) is decodeToMpfr<T>, an MPFR
+// round-to-integer in T's mode, and a range check in mpz: nothing
+// shared with the library's shift-and-round path.
+//
+// Coverage:
+//   - Every 8- and 16-bit integer, signed and unsigned, into the FP8
+//     encodings, float16 and bfloat16, bits and flags, under each
+//     rounding mode.
+//   - Every FP8, float16 and bfloat16 pattern into 8- and 16-bit
+//     integers, value and flags, under each rounding mode.
+//   - Sampled 32/64/128-bit integers to and from float32 through
+//     binary256.
+//   - Flag delivery through the other Exceptions policies, the
+//     saturating forms, and the batch forms against the scalar ones.
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <doctest/doctest.h>
+
+#include <cstdint>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+#include "harness/impl_mpfr.hpp"
+#include "harness/test_harness.hpp"
+#include "opine/core/batch.hpp"
+#include "opine/core/integer.hpp"
+
+using namespace opine;
+using namespace opine::testing;
+
+using int128 = __int128;
+using uint128 = unsigned __int128;
+
+template <typename T>
+using StatusOf = WithExceptions<T, exceptions::ReturnStatus>;
+
+// -----------------------------------------------------------------
+// Oracle
+// -----------------------------------------------------------------
+template <typename Int> void intToMpz(mpz_t Z, Int V) {
+  using U = opine::detail::IntMagnitude<Int>;
+  bool Neg = false;
+  if constexpr (opine::detail::int_signed<Int>)
+    Neg = V < Int(0);
+  bitsToMpz(Z, Neg ? U(U{0} - U(V)) : U(V));
+  if (Neg)
+    mpz_neg(Z, Z);
+}
+
+template <typename Int> Int mpzToInt(const mpz_t Z) {
+  using U = opine::detail::IntMagnitude<Int>;
+  mpz_t A;
+  mpz_init(A);
+  mpz_abs(A, Z);
+  const U Mag = mpzToBits<U>(A);
+  mpz_clear(A);
+  return mpz_sgn(Z) < 0 ? Int(U(U{0} - Mag)) : Int(Mag);
+}
+
+template <typename T, typename Int> WithStatus<T> fromIntOracle(Int V) {
+  MpfrFloat Exact{oraclePrecision<T>};
+  mpz_t Z;
+  mpz_init(Z);
+  intToMpz(Z, V);
+  mpfr_set_z(Exact, Z, MPFR_RNDN); // exact: at least 256 bits
+  mpz_clear(Z);
+  const auto Bits = mpfrRoundToFormat<T>(Exact);
+  // A unary op with no invalid cases: only the rounding flags.
+  return {Bits, mpfrFlags<T>(Op::Abs, Exact, Exact, Exact, Bits)};
+}
+
+// V rounded to an integer in Rnd, in place.
+template <typename Rnd>
+void mpfrRoundToInteger(MpfrFloat &R, const MpfrFloat &V) {
+  if constexpr (std::is_same_v<Rnd, rounding::ToNearestTiesAway>) {
+    mpfr_round(R, V);
+  } else if constexpr (std::is_same_v<Rnd, rounding::ToOdd>) {
+    mpfr_rint(R, V, MPFR_RNDZ);
+    if (!mpfr_equal_p(R, V)) {
+      mpz_t Z;
+      mpz_init(Z);
+      mpfr_get_z(Z, R, MPFR_RNDN);
+      if (mpz_even_p(Z)) {
+        if (mpfr_signbit(V))
+          mpz_sub_ui(Z, Z, 1);
+        else
+          mpz_add_ui(Z, Z, 1);
+      }
+      mpfr_set_z(R, Z, MPFR_RNDN);
+      mpz_clear(Z);
+    }
+  } else {
+    mpfr_rint(R, V, mpfrSignedMode<Rnd>());
+  }
+}
+
+template <typename Int, typename T>
+IntWithStatus<Int> toIntOracle(typename T::storage_type X) {
+  MpfrFloat V = decodeToMpfr<T>(X);
+  const Int Lo = opine::detail::saturatedInt<Int>(true);
+  const Int Hi = opine::detail::saturatedInt<Int>(false);
+  if (V.isNan())
+    return {Int(0), FlagInvalid};
+  if (V.isInf())
+    return {V.isNegative() ? Lo : Hi, FlagInvalid};
+
+  MpfrFloat R{mpfr_get_prec(V)};
+  mpfrRoundToInteger<typename T::rounding>(R, V);
+  mpz_t Z, ZLo, ZHi;
+  mpz_inits(Z, ZLo, ZHi, nullptr);
+  mpfr_get_z(Z, R, MPFR_RNDN);
+  intToMpz(ZLo, Lo);
+  intToMpz(ZHi, Hi);
+  IntWithStatus<Int> Want;
+  if (mpz_cmp(Z, ZLo) < 0 || mpz_cmp(Z, ZHi) > 0)
+    Want = {V.isNegative() ? Lo : Hi, FlagInvalid};
+  else
+    Want = {mpzToInt<Int>(Z),
+            mpfr_equal_p(R, V) ? FlagNone : FlagInexact};
+  mpz_clears(Z, ZLo, ZHi, nullptr);
+  return Want;
+}
+
+// -----------------------------------------------------------------
+// verifyFromInt / verifyToInt
+// -----------------------------------------------------------------
+template <typename T, typename Int, typename Iter>
+void verifyFromInt(const char *Name, Iter &&Values) {
+  constexpr int HexWidth = (T::layout::total_bits + 3) / 4;
+  int Failed = 0, Total = 0;
+  Values([&](Int V) {
+    ++Total;
+    const auto Got = fromInt<StatusOf<T>>(V);
+    const auto Want = fromIntOracle<T>(V);
+    if (Got.bits != Want.bits || Got.flags != Want.flags) {
+      if (Failed < 5) {
+        std::fprintf(stderr, "  FAIL %s: i=%lld opine=0x", Name,
+                     (long long)V);
+        printHex(stderr, Got.bits, HexWidth);
+        std::fprintf(stderr, "/%02x oracle=0x", unsigned(Got.flags));
+        printHex(stderr, Want.bits, HexWidth);
+        std::fprintf(stderr, "/%02x\n", unsigned(Want.flags));
+      }
+      ++Failed;
+    }
+  });
+  std::printf("%s: %d/%d passed\n", Name, Total - Failed, Total);
+  CHECK(Failed == 0);
+}
+
+template <typename Int, typename T, typename Iter>
+void verifyToInt(const char *Name, Iter &&Values) {
+  constexpr int HexWidth = (T::layout::total_bits + 3) / 4;
+  int Failed = 0, Total = 0;
+  Values([&](typename T::storage_type X) {
+    ++Total;
+    const auto Got = toInt<Int, StatusOf<T>>(X);
+    const auto Want = toIntOracle<Int, T>(X);
+    if (Got.value != Want.value || Got.flags != Want.flags ||
+        toIntSaturating<Int, T>(X) != Want.value) {
+      if (Failed < 5) {
+        std::fprintf(stderr, "  FAIL %s: x=0x", Name);
+        printHex(stderr, X, HexWidth);
+        std::fprintf(stderr, " opine=%lld/%02x oracle=%lld/%02x\n",
+                     (long long)Got.value, unsigned(Got.flags),
+                     (long long)Want.value, unsigned(Want.flags));
+      }
+      ++Failed;
+    }
+  });
+  std::printf("%s: %d/%d passed\n", Name, Total - Failed, Total);
+  CHECK(Failed == 0);
+}
+
+template <typename Int> auto allInts() {
+  return [](auto &&Callback) {
+    using U = opine::detail::IntMagnitude<Int>;
+    constexpr uint64_t Count = uint64_t{1} << opine::detail::int_bits<Int>;
+    for (uint64_t I = 0; I < Count; ++I)
+      Callback(Int(U(I)));
+  };
+}
+
+template <typename T> auto allPatterns() {
+  return ExhaustiveSingles<typename T::storage_type, T::layout::total_bits>{};
+}
+
+// Random integers of every magnitude: a random word shifted right by
+// a random amount, plus the extremes and their neighbours.
+template <typename Int> auto sampledInts() {
+  return [](auto &&Callback) {
+    using U = opine::detail::IntMagnitude<Int>;
+    constexpr int N = opine::detail::int_bits<Int>;
+    for (Int E : {opine::detail::saturatedInt<Int>(true),
+                  opine::detail::saturatedInt<Int>(false), Int(0), Int(1)}) {
+      Callback(E);
+      Callback(Int(U(U(E) + U{1})));
+      Callback(Int(U(U(E) - U{1})));
+    }
+    std::mt19937_64 Rng(0x1A7E6E5ULL);
+    for (int I = 0; I < 20000; ++I) {
+      U V = U(Rng());
+      if constexpr (N > 64)
+        V = U(V << 64) | U(Rng());
+      Callback(Int(U(V >> (Rng() % N))));
+    }
+  };
+}
+
+template <typename T> auto sampledPatterns() {
+  using S = typename T::storage_type;
+  return [](auto &&Callback) {
+    for (S X : structuralValues<T>())
+      Callback(X);
+    ExponentStratifiedSingles<T, 4>{0x1A7E6E5ULL}(Callback);
+  };
+}
+
+template <typename T, typename Rnd>
+using Rounded = WithRounding<T, Rnd>;
+
+// Every rounding mode of T.
+template <typename T, typename F> void forEachMode(F &&f) {
+  f.template operator()<T>();
+  f.template operator()<Rounded<T, rounding::TowardZero>>();
+  f.template operator()<Rounded<T, rounding::TowardPositive>>();
+  f.template operator()<Rounded<T, rounding::TowardNegative>>();
+  f.template operator()<Rounded<T, rounding::ToNearestTiesAway>>();
+  f.template operator()<Rounded<T, rounding::ToOdd>>();
+}
+
+// -----------------------------------------------------------------
+// fromInt
+// -----------------------------------------------------------------
+static_assert(opine::detail::exact_from_int<float32, int16_t>);
+static_assert(opine::detail::exact_from_int<bfloat16, int8_t>);
+static_assert(opine::detail::exact_from_int<float64, uint32_t>);
+static_assert(!opine::detail::exact_from_int<bfloat16, int16_t>);
+static_assert(!opine::detail::exact_from_int<float32, int32_t>);
+static_assert(fromInt<float32>(int16_t(-3)) == 0xC0400000u);
+
+template <typename T> void fromSmallInts(const char *Name) {
+  forEachMode<T>([&]<typename R>() {
+    verifyFromInt<R, int8_t>(Name, allInts<int8_t>());
+    verifyFromInt<R, uint8_t>(Name, allInts<uint8_t>());
+    verifyFromInt<R, int16_t>(Name, allInts<int16_t>());
+    verifyFromInt<R, uint16_t>(Name, allInts<uint16_t>());
+  });
+}
+
+TEST_CASE("integer: fromInt, every 8- and 16-bit integer (exhaustive)") {
+  fromSmallInts<fp8_e5m2>("->e5m2");
+  fromSmallInts<fp8_e4m3>("->e4m3");
+  fromSmallInts<fp8_e4m3fnuz>("->e4m3fnuz");
+  fromSmallInts<RbjType<4, 3>>("->rbj43");
+  fromSmallInts<float16>("->f16");
+  fromSmallInts<bfloat16>("->bf16");
+  verifyFromInt<FastType<4, 3>, int16_t>("->fast43", allInts<int16_t>());
+}
+
+TEST_CASE("integer: fromInt, 32- to 128-bit integers (sampled)") {
+  verifyFromInt<float32, int32_t>("i32->f32", sampledInts<int32_t>());
+  verifyFromInt<float32, uint64_t>("u64->f32", sampledInts<uint64_t>());
+  verifyFromInt<float64, int64_t>("i64->f64", sampledInts<int64_t>());
+  verifyFromInt<Rounded<float64, rounding::TowardNegative>, int64_t>(
+      "i64->f64 down", sampledInts<int64_t>());
+  verifyFromInt<float64, int128>("i128->f64", sampledInts<int128>());
+  verifyFromInt<float128, uint128>("u128->f128", sampledInts<uint128>());
+  verifyFromInt<float256, int128>("i128->f256", sampledInts<int128>());
+  verifyFromInt<fp8_e4m3, int64_t>("i64->e4m3", sampledInts<int64_t>());
+}
+
+// -----------------------------------------------------------------
+// toInt
+// -----------------------------------------------------------------
+static_assert(toIntSaturating<int8_t, float32>(0x3FC00000) == 2); // 1.5
+static_assert(toIntSaturating<int8_t, float32, rounding::TowardZero>(
+                  0xBFC00000) == -1); // -1.5
+static_assert(toIntSaturating<uint8_t, float32>(0x43800000) == 255); // 256
+static_assert(toIntSaturating<int32_t, float32>(0x7FC00000) == 0);    // NaN
+
+template <typename T> void toSmallInts(const char *Name) {
+  forEachMode<T>([&]<typename R>() {
+    verifyToInt<int8_t, R>(Name, allPatterns<R>());
+    verifyToInt<uint8_t, R>(Name, allPatterns<R>());
+    verifyToInt<int16_t, R>(Name, allPatterns<R>());
+    verifyToInt<uint16_t, R>(Name, allPatterns<R>());
+  });
+}
+
+TEST_CASE("integer: toInt, every FP8 and 16-bit pattern (exhaustive)") {
+  toSmallInts<fp8_e5m2>("e5m2->");
+  toSmallInts<fp8_e4m3>("e4m3->");
+  toSmallInts<fp8_e4m3fnuz>("e4m3fnuz->");
+  toSmallInts<RbjType<5, 2>>("rbj52->");
+  toSmallInts<float16>("f16->");
+  toSmallInts<bfloat16>("bf16->");
+  verifyToInt<int16_t, FastType<5, 2>>("fast52->",
+                                       allPatterns<FastType<5, 2>>());
+}
+
+TEST_CASE("integer: toInt, 32- to 128-bit integers (sampled)") {
+  verifyToInt<int32_t, float32>("f32->i32", sampledPatterns<float32>());
+  verifyToInt<uint32_t, float32>("f32->u32", sampledPatterns<float32>());
+  verifyToInt<int64_t, float64>("f64->i64", sampledPatterns<float64>());
+  verifyToInt<int64_t, Rounded<float64, rounding::ToOdd>>(
+      "f64->i64 odd", sampledPatterns<float64>());
+  verifyToInt<uint64_t, extFloat80>("f80->u64", sampledPatterns<extFloat80>());
+  verifyToInt<int128, float64>("f64->i128", sampledPatterns<float64>());
+  verifyToInt<uint128, float128>("f128->u128", sampledPatterns<float128>());
+  verifyToInt<int128, float256>("f256->i128", sampledPatterns<float256>());
+  verifyToInt<int8_t, float256>("f256->i8", sampledPatterns<float256>());
+}
+
+// -----------------------------------------------------------------
+// Flag delivery, batch forms
+// -----------------------------------------------------------------
+TEST_CASE("integer: flags through the Exceptions axis") {
+  using F = WithExceptions<float32, exceptions::StatusFlags>;
+  clearStatusFlags();
+  CHECK(toInt<int8_t, F>(0x43800000) == 127); // 256: saturates
+  CHECK(statusFlags() == FlagInvalid);
+  clearStatusFlags();
+  CHECK(fromInt<WithExceptions<fp8_e4m3, exceptions::StatusFlags>>(1000) ==
+        convert<fp8_e4m3, float32>(0x447A0000)); // 1000.0f: overflows
+  CHECK(statusFlags() == (FlagOverflow | FlagInexact));
+  clearStatusFlags();
+
+  // A trap has no pattern to substitute; the flag is recorded.
+  using Tr = WithExceptions<float32, exceptions::TrapOn<FlagInvalid>>;
+  CHECK(toInt<int8_t, Tr>(0x7FC00000) == 0);
+  CHECK(statusFlags() == FlagInvalid);
+  CHECK(toInt<int8_t, Tr>(0x3FC00000) == 2); // inexact: not enabled
+  CHECK(statusFlags() == FlagInvalid);
+  clearStatusFlags();
+
+  using C = WithExceptions<float32, exceptions::Counting<>>;
+  toInt<int32_t, C>(0x3FC00000);
+  fromInt<C>(16777217);
+  const FlagCounts N = flagCounts<C>();
+  CHECK(N.calls[int(Operation::Convert)] == 2);
+  CHECK(N.count(Operation::Convert, FlagInexact) == 2);
+}
+
+TEST_CASE("integer: batch forms match the scalar ones") {
+  std::vector<int16_t> Ints;
+  allInts<int16_t>()([&](int16_t V) { Ints.push_back(V); });
+  std::vector<uint8_t> Fp8(Ints.size());
+  std::vector<flags_t> Flags(Ints.size());
+  CHECK(fromIntMany<fp8_e5m2, int16_t>(Ints, Fp8, std::span(Flags)) ==
+        Ints.size());
+  std::vector<int8_t> Back(Ints.size()), Sat(Ints.size());
+  std::vector<flags_t> BackFlags(Ints.size());
+  toIntMany<int8_t, fp8_e5m2>(Fp8, Back, std::span(BackFlags));
+  toIntSaturatingMany<int8_t, fp8_e5m2>(Fp8, Sat);
+
+  int Failed = 0;
+  for (std::size_t I = 0; I < Ints.size(); ++I) {
+    const auto F = fromInt<StatusOf<fp8_e5m2>>(Ints[I]);
+    const auto T = toInt<int8_t, StatusOf<fp8_e5m2>>(Fp8[I]);
+    Failed += F.bits != Fp8[I] || F.flags != Flags[I] ||
+              T.value != Back[I] || T.flags != BackFlags[I] ||
+              Sat[I] != T.value;
+  }
+  CHECK(Failed == 0);
+
+  FlagList Invalid{std::span<std::size_t>{}, FlagInvalid};
+  toIntMany<int8_t, fp8_e5m2>(Fp8, Back, Invalid);
+  CHECK(Invalid.count == countFlags(BackFlags, FlagInvalid));
+}
@@ -4,20 +4,46 @@
 //     correctly rounded D-digit decimals from the same exact value,
 //     so the digit strings and exponents must match exactly.
 //   - fromString vs mpfr_set_str + mpfrRoundToFormat: bit-exact.
+//   - fromString's table tier vs its exact tier, every rounding
+//     mode, bits and flags.
 //   - Round-trip theorem: fromString(toString(x)) == x for every
 //     non-NaN pattern (roundTripDigits guarantees it), exhaustively
-//     at FP8/FP16 and sampled at wider widths including binary1024.
+//     at FP8/FP16 and sampled at wider widths including binary1024,
+//     in and past the decimal window.
+//   - The bounded tier (past the window) vs the exact tiers, forced
+//     on at float64/float128; exponents near 10^±9 and beyond at
+//     every tier overflow or underflow; the tier's give-up at an exact
+//     boundary.
+//   - toShortestString: table tier == exact tier, round-trips, and
+//     is minimal; digits match std::to_chars for float/double.
+//   - streamDigits: the whole exact expansion, and its first D digits
+//     rounded from the tail report, vs decimalDigits.
+//   - Conversions in a ScratchScope: the same text and parses as on
+//     the stack, within decimalScratchLimbs.
 //   - toHexString vs strtod("%a"): exact by construction.
+//   - Hex-float parse: toHexString reads back bit-exact at every
+//     width, and narrowing through hex matches convert.
+//   - pow5Digits (table-assembled powers) vs repeated ×5;
+//     integerDigits (divide and conquer) vs digit peeling.
+//   - toChars layouts vs printf / std::to_chars; fromChars prefix
+//     semantics.
+//   - parseMany vs per-token fromString; its SWAR helpers vs byte
+//     loops.
 //   - Flags through the parse path (inexact / overflow / underflow /
 //     invalid), since fromString feeds the shared epilogue.
 
 #define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
 #include <doctest/doctest.h>
 
+#include <algorithm>
+#include <charconv>
+#include <cmath>
 #include <cstdint>
 #include <cstdlib>
+#include <cstring>
 #include <random>
 #include <string>
+#include <vector>
 
 #include "harness/impl_mpfr.hpp"
 #include "harness/test_harness.hpp"
@@ -56,12 +82,12 @@ void verifyDigitsVsMpfr(const char *Name, int D, int samples,
     std::string want(str[0] == '-' ? str + 1 : str);
     bool wneg = str[0] == '-';
     mpfr_free_str(str);
-    if (mine.digits != want || mine.k10 != long(exp10) - 1 ||
+    if (mine.digits() != want || mine.k10 != long(exp10) - 1 ||
         mine.neg != wneg) {
       if (failed < 5)
         std::fprintf(stderr, "  FAIL %s: got %s e%ld want %s e%ld\n", Name,
-                     mine.digits.c_str(), mine.k10, want.c_str(),
-                     long(exp10) - 1);
+                     std::string(mine.digits()).c_str(), mine.k10,
+                     want.c_str(), long(exp10) - 1);
       ++failed;
     }
   };
@@ -107,12 +133,70 @@ TEST_CASE("string: toString digits vs mpfr_get_str") {
     char *str = mpfr_get_str(nullptr, &exp10, 10, 40, v, MPFR_RNDN);
     std::string want(str[0] == '-' ? str + 1 : str);
     mpfr_free_str(str);
-    if (!mine.ok || mine.digits != want || mine.k10 != long(exp10) - 1)
+    if (!mine.ok || mine.digits() != want || mine.k10 != long(exp10) - 1)
       ++failed;
   }
   CHECK(failed == 0);
 }
 
+// -----------------------------------------------------------------
+// Exact powers of five
+// -----------------------------------------------------------------
+// pow5Digits assembles 5^n from the tables (and, past them, squares
+// of the top block); walk 5^n up by exact ×5 at each working width
+// and compare every n the tier can hold, sampled at the widest.
+template <int Limbs> int checkPow5(long max_n, long stride) {
+  using namespace opine::detail;
+  auto p = digitsFrom<std::uint64_t, Limbs>(1);
+  int failed = 0;
+  for (long n = 0; n <= max_n; ++n) {
+    if (n % stride == 0 || n % Pow5ExactTableLimit < 2)
+      failed += !(pow5Digits<Limbs>(n) == p);
+    p = mulSmallDigits(p, std::uint64_t{5});
+  }
+  return failed;
+}
+
+TEST_CASE("string: pow5Digits vs repeated x5") {
+  CHECK(checkPow5<32>(881, 1) == 0);       // 5^881 < 2^2048
+  CHECK(checkPow5<320>(8818, 7) == 0);     // < 2^20480
+  CHECK(checkPow5<1024>(28200, 211) == 0); // < 2^65536
+}
+
+// integerDigits splits by powers of ten and recurses; peel digits one
+// short division at a time for the reference, at every bit length up
+// to the 1000-digit bound and at the halving boundaries' neighbours.
+TEST_CASE("string: divide-and-conquer integerDigits vs digit peeling") {
+  using namespace opine::detail;
+  using DV = DigitVector<std::uint64_t, 64>;
+  std::mt19937_64 rng(0x56);
+  int failed = 0;
+  auto check = [&](const DV &n) {
+    std::string want;
+    for (DV v = n; !isZero(v);) {
+      auto dm = divModSmallDigits(v, std::uint64_t{10});
+      want.insert(want.begin(), char('0' + dm.rem));
+      v = dm.quot;
+    }
+    char buf[MaxDecimalDigits + 300];
+    const int len = integerDigits(n, buf);
+    failed += std::string(buf, std::size_t(len)) != want;
+  };
+  for (int bits = 0; bits <= 3321; ++bits) {
+    DV n{};
+    for (int i = 0; i < 64; ++i)
+      n.d[i] = rng();
+    n = bits == 0 ? DV{} : shiftRightDigits(n, DV::total_bits - bits);
+    check(n);
+  }
+  for (int k : {72, 73, 144, 145, 288, 289, 576, 577, 999}) {
+    const DV p = shiftLeftDigits(pow5Digits<64>(k), k); // 10^k
+    check(p);
+    check(subDigits(p, digitsFrom<std::uint64_t, 64>(1)));
+  }
+  CHECK(failed == 0);
+}
+
 // -----------------------------------------------------------------
 // fromString vs mpfr_set_str + round-to-format
 // -----------------------------------------------------------------
@@ -171,6 +255,323 @@ TEST_CASE("string: fromString vs mpfr_set_str") {
   verifyParseVsMpfr<F32Dn>("f32/RZ", 3000, 0x67);
 }
 
+// -----------------------------------------------------------------
+// fromString table tier vs the exact tier
+// -----------------------------------------------------------------
+// The Eisel–Lemire pass must reproduce parseFinite bit for bit and
+// flag for flag, in every rounding mode: random short decimals
+// (mostly 1–19 digits, some up to 40 to exercise the long-input
+// bracket), exponents across and past the format's range, plus
+// decimals that are exactly binary fractions.
+template <typename Num, typename Lay, typename Rnd>
+int verifyParseTierRnd(std::uint64_t seed, int samples) {
+  using T = Type<Num, Lay, Rnd, exceptions::ReturnStatus>;
+  constexpr int P = Num::significand::digit_count;
+  std::mt19937_64 rng(seed);
+  int failed = 0;
+  auto check = [&](bool neg, const std::string &digits, long exp10) {
+    std::string text =
+        (neg ? "-" : "") + digits + "e" + std::to_string(exp10);
+    auto fast = fromString<T>(text);
+    std::string d = digits;
+    long q = exp10;
+    d.erase(0, std::min(d.find_first_not_of('0'), d.size() - 1));
+    flags_t flags = FlagNone;
+    typename T::storage_type want{};
+    if (d.find_first_not_of('0') == std::string::npos)
+      return;
+    const opine::detail::DecimalText text_digits{d.data(), nullptr,
+                                                 long(d.size())};
+    opine::detail::parseExact<T>(neg, text_digits, q, false, false, want,
+                                 flags);
+    if (!(fast.bits == want) || fast.flags != flags) {
+      if (failed < 5)
+        std::fprintf(stderr, "  FAIL parse tier: \"%s\"\n", text.c_str());
+      ++failed;
+    }
+  };
+  const int qlo = -(P / 2 + 330), qhi = 320;
+  for (int i = 0; i < samples; ++i) {
+    const int nd = 1 + int(rng() % (i % 4 == 0 ? 40 : 19));
+    std::string digits;
+    for (int j = 0; j < nd; ++j)
+      digits.push_back(char('0' + rng() % 10));
+    const long exp10 = qlo + long(rng() % std::uint64_t(qhi - qlo + 1));
+    check(rng() & 1, digits, exp10);
+  }
+  // Decimals that divide out exactly, and short ones near the
+  // format's own range.
+  for (int i = 0; i < samples / 4; ++i) {
+    const int k = int(rng() % 28);
+    std::uint64_t p5 = 1;
+    for (int j = 0; j < k; ++j)
+      p5 *= 5;
+    const std::uint64_t n = (1 + rng() % 1000) * p5;
+    check(false, std::to_string(n), -k);
+    check(true, std::to_string(1 + rng() % 999), long(rng() % 90) - 45);
+  }
+  return failed;
+}
+
+template <typename Num, typename Lay>
+void verifyParseTier(const char *Name, std::uint64_t seed, int samples) {
+  static_assert(opine::detail::parse_fast_path<
+                Type<Num, Lay, rounding::Default, exceptions::ReturnStatus>>);
+  int failed = 0;
+  failed += verifyParseTierRnd<Num, Lay, rounding::ToNearestTiesToEven>(
+      seed, samples);
+  failed += verifyParseTierRnd<Num, Lay, rounding::ToNearestTiesAway>(
+      seed + 1, samples);
+  failed +=
+      verifyParseTierRnd<Num, Lay, rounding::TowardZero>(seed + 2, samples);
+  failed +=
+      verifyParseTierRnd<Num, Lay, rounding::TowardPositive>(seed + 3, samples);
+  failed +=
+      verifyParseTierRnd<Num, Lay, rounding::TowardNegative>(seed + 4, samples);
+  failed += verifyParseTierRnd<Num, Lay, rounding::ToOdd>(seed + 5, samples);
+  std::printf("%s: parse tiers agree (%d failures)\n", Name, failed);
+  CHECK(failed == 0);
+}
+
+TEST_CASE("string: fromString table tier matches exact tier") {
+  verifyParseTier<numbers::IEEE754<4, 3>, layouts::IEEE<4, 3, true>>(
+      "e4m3", 0xb1, 2000);
+  verifyParseTier<numbers::IEEE754<5, 2>, layouts::IEEE<5, 2, true>>(
+      "e5m2", 0xb2, 2000);
+  verifyParseTier<numbers::IEEE754<8, 7>, layouts::IEEE<8, 7, true>>(
+      "bf16", 0xb3, 5000);
+  verifyParseTier<numbers::IEEE754<8, 23>, layouts::IEEE<8, 23, true>>(
+      "f32", 0xb4, 5000);
+  verifyParseTier<numbers::IEEE754<11, 52>, layouts::IEEE<11, 52, true>>(
+      "f64", 0xb5, 5000);
+
+  // A 20-digit decimal that is exactly a float32: cutting it to a
+  // short prefix must not make it inexact, in any direction.
+  using TZ = Type<numbers::IEEE754<8, 23>, layouts::IEEE<8, 23, true>,
+                  rounding::TowardZero, exceptions::ReturnStatus>;
+  auto r = fromString<TZ>("10907649993896484375e-24");
+  CHECK(r.flags == FlagNone);
+  CHECK(r.bits == 0x37370000u);
+}
+
+// -----------------------------------------------------------------
+// Bounded tier vs the exact tiers
+// -----------------------------------------------------------------
+// The bounded tier only runs past the decimal window in production,
+// where nothing exact can check it; but it is format-agnostic, so
+// force it on in-window float64/float128 values and hold it to the
+// exact tiers: whatever it decides must match, digits, bits, and
+// flags, in every rounding mode. (Exactly representable and tie
+// cases are where it is designed to give up; the inputs here are
+// random, and it must decide nearly all of them.)
+template <typename T> void verifyBoundedTier(const char *Name, int samples,
+                                             std::uint64_t seed) {
+  using namespace opine::detail;
+  using Bits = typename T::storage_type;
+  using Nearest = Type<typename T::number, typename T::layout,
+                       rounding::ToNearestTiesToEven, exceptions::ReturnStatus>;
+  using Up = Type<typename T::number, typename T::layout,
+                  rounding::TowardPositive, exceptions::ReturnStatus>;
+  using Zero = Type<typename T::number, typename T::layout,
+                    rounding::TowardZero, exceptions::ReturnStatus>;
+  constexpr int P = T::number::significand::digit_count;
+  std::mt19937_64 rng(seed);
+  int failed = 0, undecided = 0, total = 0;
+
+  auto parseBoth = [&]<typename R>(bool neg, const std::string &d, long q) {
+    const DecimalText text{d.data(), nullptr, long(d.size())};
+    Bits want{}, got{};
+    flags_t want_flags = FlagNone, got_flags = FlagNone;
+    parseExact<R>(neg, text, q, false, false, want, want_flags);
+    const bool exact = !(want_flags & FlagInexact); // gives up by design
+    total += !exact;
+    if (!parseBounded<R>(neg, text, q, got, got_flags))
+      undecided += !exact;
+    else if (!(got == want) || got_flags != want_flags) {
+      if (failed < 5)
+        std::fprintf(stderr, "  FAIL %s bounded parse: %se%ld\n", Name,
+                     d.c_str(), q);
+      ++failed;
+    }
+  };
+  const int qlo = -(P / 2 + 330), qhi = 320;
+  for (int i = 0; i < samples; ++i) {
+    std::string d(1 + rng() % 60, '0');
+    for (char &c : d)
+      c = char('1' + rng() % 9);
+    const long q = qlo + long(rng() % std::uint64_t(qhi - qlo + 1));
+    const bool neg = rng() & 1;
+    parseBoth.template operator()<Nearest>(neg, d, q);
+    parseBoth.template operator()<Up>(neg, d, q);
+    parseBoth.template operator()<Zero>(neg, d, q);
+  }
+
+  RandomSingles<Bits, T::layout::total_bits> rnd{seed + 1, samples};
+  rnd([&](Bits x) {
+    const auto u = unpackOperand<T>(x);
+    if (u.category != ValueCategory::Finite)
+      return;
+    const int D = 1 + int(rng() % 40);
+    const DecimalDigits want = decimalDigits<T>(x, D);
+    DecimalDigits got;
+    withBoundedBudget<T>(D, [&](auto limbs) {
+      decimalFromBounds<T, decltype(limbs)::value>(u, D, got);
+      return got.ok;
+    });
+    const DecimalDigits want_s = shortestDigitsExact<T>(x);
+    DecimalDigits got_s;
+    shortestFromBounds<T>(u, got_s);
+    total += 2;
+    undecided += !got.ok + !got_s.ok;
+    // At a binade boundary the exact tier may pick a longer-side
+    // candidate the correctly rounded one misses; skip those.
+    const bool boundary =
+        u.biased_exp > 1 &&
+        !anyBitsBelow(digitsFromStorage<std::uint64_t, (P + 63) / 64>(
+                          u.significand),
+                      P - 1);
+    if ((got.ok && (got.digits() != want.digits() || got.k10 != want.k10)) ||
+        (got_s.ok && !boundary &&
+         (got_s.digits() != want_s.digits() || got_s.k10 != want_s.k10))) {
+      if (failed < 5)
+        std::fprintf(stderr, "  FAIL %s bounded print: %s\n", Name,
+                     toHexString<T>(x).c_str());
+      ++failed;
+    }
+  });
+  std::printf("%s: bounded tier agrees (%d failures, %d/%d undecided)\n",
+              Name, failed, undecided, total);
+  CHECK(failed == 0);
+  CHECK(undecided * 100 <= total);
+}
+
+TEST_CASE("string: bounded tier matches exact tiers") {
+  verifyBoundedTier<float64>("f64", 3000, 0xb0);
+  verifyBoundedTier<float128>("f128", 300, 0xb8);
+}
+
+TEST_CASE("string: past the decimal window") {
+  using F32 = Type<numbers::IEEE754<8, 23>, layouts::IEEE<8, 23, true>,
+                   rounding::Default, exceptions::ReturnStatus>;
+  auto tiny = fromString<F32>("1e-100000");
+  CHECK(tiny.bits == 0u);
+  CHECK(tiny.flags == (FlagUnderflow | FlagInexact));
+  auto huge = fromString<F32>("-1e100000");
+  CHECK(huge.bits == 0xFF800000u);
+  CHECK(huge.flags == (FlagOverflow | FlagInexact));
+
+  CHECK(toString<float1024>(fromString<float1024>("-1e30000"), 20) ==
+        "-1e+30000");
+  CHECK(toShortestString<float256>(fromString<float256>("4.5e-78000")) ==
+        "4.5e-78000");
+  const std::string pi = "3.14159265358979323846264338327950288e+12345678";
+  CHECK(toString<float1024>(fromString<float1024>(pi), 36) == pi);
+}
+
+// Exponents past every format's range, at every tier a literal can
+// reach: the table tier's short digits, the long-input bracket, the
+// exact tier (which gives up out here) and the bounded tier, which
+// decides — through fromString, fromChars and parseMany. The
+// parser saturates the exponent it reads near 10^9, and the epilogue
+// must see an overflow or a total underflow, never a wrapped int.
+template <typename T> void verifyHugeExponents(const char *Name) {
+  using namespace opine::detail;
+  using R = WithExceptions<T, exceptions::ReturnStatus>;
+  using Z = WithRounding<R, rounding::TowardZero>;
+  using Bits = typename T::storage_type;
+  const std::string mantissas[] = {"1", "9.87654321", "1234567890123456789",
+                                   std::string(40, '7'),
+                                   "0." + std::string(700, '3')};
+  const char *exponents[] = {"999999999", "2147483648", "99999999999999"};
+  int failed = 0;
+  auto expect = [&](const std::string &text, bool neg, bool big) {
+    const Bits want_r = big ? packInfOrSaturate<T>(neg)
+                            : packSpecial<T>(ValueCategory::Zero, neg);
+    const Bits want_z = big ? packMaxFinite<T>(neg) : want_r;
+    const flags_t want_f = big ? flags_t(FlagOverflow | FlagInexact)
+                               : flags_t(FlagUnderflow | FlagInexact);
+    const auto r = fromString<R>(text);
+    const auto z = fromString<Z>(text);
+    const auto c = fromChars<R>(text.data(), text.data() + text.size());
+    Bits many[1];
+    flags_t many_f[1];
+    parseMany<R>(text, many, many_f);
+    if (!(r.bits == want_r) || r.flags != want_f || !(z.bits == want_z) ||
+        z.flags != want_f || c.ec != std::errc{} || !(c.value.bits == want_r) ||
+        !(many[0] == want_r) || many_f[0] != want_f) {
+      if (failed < 5)
+        std::fprintf(stderr, "  FAIL %s huge exponent: %.60s\n", Name,
+                     text.c_str());
+      ++failed;
+    }
+  };
+  for (const std::string &m : mantissas)
+    for (const char *e : exponents)
+      for (const bool neg : {false, true})
+        for (const bool big : {false, true})
+          expect((neg ? "-" : "") + m + (big ? "e" : "e-") + e, neg, big);
+
+  // The bounded tier alone, at the saturated exponent.
+  const DecimalText one{"1", nullptr, 1};
+  Bits out{}, exact_out{};
+  flags_t flags = FlagNone, exact_flags = FlagNone;
+  CHECK_FALSE(parseExact<R>(false, one, 999999999, false, false, exact_out,
+                            exact_flags));
+  CHECK(parseBounded<R>(false, one, 999999999, out, flags));
+  CHECK(out == packInfOrSaturate<T>(false));
+  CHECK(flags == (FlagOverflow | FlagInexact));
+  flags = FlagNone;
+  CHECK(parseBounded<R>(false, one, -999999999, out, flags));
+  CHECK(out == packSpecial<T>(ValueCategory::Zero, false));
+  CHECK(flags == (FlagUnderflow | FlagInexact));
+  CHECK(failed == 0);
+}
+
+TEST_CASE("string: exponents past every format's range") {
+  verifyHugeExponents<float32>("f32");
+  verifyHugeExponents<float64>("f64");
+  verifyHugeExponents<float128>("f128");
+  verifyHugeExponents<float1024>("f1024");
+}
+
+// The bounded tier's one documented give-up: a literal that agrees
+// with a rounding boundary past its kept digits. The exact float256
+// midpoint 2^69763 · (2^237 + 1) has 21,073 digits, past the exact
+// tiers' budget. It parses as a quiet NaN with Invalid, and
+// fromChars consumes it and reports result_out_of_range. A cut of
+// it that keeps 400 digits is still within the interval of the
+// boundary and gives up the same way.
+TEST_CASE("string: bounded tier gives up only at a boundary") {
+  using R = WithExceptions<float256, exceptions::ReturnStatus>;
+  mpz_t v;
+  mpz_init(v);
+  mpz_ui_pow_ui(v, 2, 237);
+  mpz_add_ui(v, v, 1);
+  mpz_mul_2exp(v, v, 69763);
+  std::vector<char> text(mpz_sizeinbase(v, 10) + 2);
+  const std::string mid(mpz_get_str(text.data(), 10, v));
+  mpz_clear(v);
+  REQUIRE(mid.size() == 21073);
+
+  const auto r = fromString<R>(mid);
+  CHECK(unpack<float256>(r.bits).category == ValueCategory::NaN);
+  CHECK(r.flags == FlagInvalid);
+  const auto c = fromChars<R>(mid.data(), mid.data() + mid.size());
+  CHECK(c.ec == std::errc::result_out_of_range);
+  CHECK(c.ptr == mid.data() + mid.size());
+
+  const std::string near400 =
+      mid.substr(0, 400) + "e" + std::to_string(mid.size() - 400);
+  CHECK(fromString<R>(near400).flags == FlagInvalid);
+
+  // Cut to 60 digits it moves many ulps off the midpoint and decides.
+  const std::string far60 =
+      mid.substr(0, 60) + "e" + std::to_string(mid.size() - 60);
+  const auto d = fromString<R>(far60);
+  CHECK(d.flags == FlagInexact);
+  CHECK(unpack<float256>(d.bits).category == ValueCategory::Finite);
+}
+
 // -----------------------------------------------------------------
 // Round-trip theorem
 // -----------------------------------------------------------------
@@ -244,6 +645,559 @@ TEST_CASE("string: round-trip identity at roundTripDigits") {
   }
   std::printf("f1024/embedded: %d/%d round-trips\n", total - failed, total);
   CHECK(failed == 0);
+  // And random patterns, nearly all past the window.
+  verifyRoundTrip<float256>("f256", 300, 0x76);
+  verifyRoundTrip<float1024>("f1024", 30, 0x77);
+}
+
+// -----------------------------------------------------------------
+// Shortest round-trip (toShortestString)
+// -----------------------------------------------------------------
+// Three properties per pattern: the table tier (where the format
+// takes it) agrees with the exact Burger–Dybvig tier digit for digit;
+// the string parses back to the identical bits; and it is minimal —
+// the correctly rounded decimal one digit shorter does not.
+template <typename T>
+void verifyShortest(const char *Name, int samples, std::uint64_t seed) {
+  using Bits = typename T::storage_type;
+  using Nearest = Type<typename T::number, typename T::layout,
+                       rounding::ToNearestTiesToEven, typename T::exceptions,
+                       typename T::platform>;
+  int failed = 0, total = 0;
+  auto check = [&](Bits x) {
+    const auto u = opine::detail::unpackOperand<T>(x);
+    if (u.category != ValueCategory::Finite)
+      return;
+    ++total;
+    auto fast = opine::detail::shortestDigits<T>(x);
+    auto exact = opine::detail::shortestDigitsExact<T>(x);
+    std::string s = toShortestString<T>(x);
+    bool ok = fast.ok && exact.ok && fast.digits() == exact.digits() &&
+              fast.k10 == exact.k10 && fast.neg == exact.neg;
+    ok = ok && fromString<Nearest>(s) == pack<T>(u);
+    const int n = int(exact.len);
+    if (ok && n > 1)
+      ok = !(fromString<Nearest>(toString<T>(x, n - 1)) == pack<T>(u));
+    if (!ok) {
+      if (failed < 5)
+        std::fprintf(stderr, "  FAIL %s shortest: \"%s\" (exact %s e%ld)\n",
+                     Name, s.c_str(), std::string(exact.digits()).c_str(),
+                     exact.k10);
+      ++failed;
+    }
+  };
+  if constexpr (T::layout::total_bits <= 16) {
+    constexpr std::uint64_t N = std::uint64_t{1} << T::layout::total_bits;
+    for (std::uint64_t i = 0; i < N; ++i)
+      check(Bits(std::uint64_t(i)));
+    (void)samples;
+    (void)seed;
+  } else {
+    for (Bits x : structuralValues<T>())
+      check(x);
+    RandomSingles<Bits, T::layout::total_bits> rnd{seed, samples};
+    rnd([&](Bits x) { check(x); });
+  }
+  std::printf("%s: %d/%d shortest\n", Name, total - failed, total);
+  CHECK(failed == 0);
+}
+
+TEST_CASE("string: toShortestString is shortest and round-trips") {
+  verifyShortest<fp8_e5m2>("e5m2", 0, 0);
+  verifyShortest<fp8_e4m3>("e4m3", 0, 0);
+  verifyShortest<float16>("f16", 0, 0);
+  verifyShortest<bfloat16>("bf16", 0, 0);
+  verifyShortest<float32>("f32", 20000, 0x91);
+  verifyShortest<float64>("f64", 20000, 0x92);
+  verifyShortest<extFloat80>("extF80", 2000, 0x93);
+  verifyShortest<float128>("f128", 1000, 0x94);
+  verifyShortest<float256>("f256", 100, 0x95); // mostly past the window
+}
+
+// std::to_chars without a precision is the C++17 shortest
+// round-trip form; its digits must match exactly.
+TEST_CASE("string: toShortestString digits vs std::to_chars") {
+  auto digitsOf = [](const char *b, const char *e, long &k10) {
+    std::string mant;
+    long exp = 0, point = -1;
+    const char *p = b;
+    if (*p == '-')
+      ++p;
+    for (; p != e && *p != 'e'; ++p) {
+      if (*p == '.')
+        point = long(mant.size());
+      else
+        mant.push_back(*p);
+    }
+    if (p != e)
+      exp = std::stol(std::string(p + 1, e));
+    if (point < 0)
+      point = long(mant.size());
+    std::size_t lead = mant.find_first_not_of('0');
+    mant = mant.substr(lead);
+    k10 = exp + point - long(lead) - 1;
+    while (mant.size() > 1 && mant.back() == '0')
+      mant.pop_back();
+    return mant;
+  };
+  int failed = 0;
+  auto check = [&](auto native, auto bits, auto shortest) {
+    if (!(native == native) || native == 0 || std::isinf(native))
+      return;
+    char buf[64];
+    auto r = std::to_chars(buf, buf + sizeof buf, native,
+                           std::chars_format::scientific);
+    long want_k = 0;
+    std::string want = digitsOf(buf, r.ptr, want_k);
+    auto got = shortest(bits);
+    if (got.digits() != want || got.k10 != want_k)
+      ++failed;
+  };
+  RandomSingles<float32::storage_type, 32> r32{0xa1, 50000};
+  r32([&](float32::storage_type x) {
+    check(toFloat<float32>(x), x, [](auto b) {
+      return opine::detail::shortestDigits<float32>(b);
+    });
+  });
+  RandomSingles<float64::storage_type, 64> r64{0xa2, 50000};
+  r64([&](float64::storage_type x) {
+    check(toDouble<float64>(x), x, [](auto b) {
+      return opine::detail::shortestDigits<float64>(b);
+    });
+  });
+  CHECK(failed == 0);
+}
+
+TEST_CASE("string: toShortestString spot checks") {
+  auto f = [](double v) {
+    return toShortestString<float64>(fromNative<float64>(v));
+  };
+  CHECK(f(0.1) == "0.1");
+  CHECK(f(1.5) == "1.5");
+  CHECK(f(-0.0) == "-0");
+  CHECK(f(1024.0) == "1024");
+  CHECK(f(1e23) == "1e+23");
+  CHECK(f(5e-324) == "5e-324");
+  CHECK(f(1.7976931348623157e308) == "1.7976931348623157e+308");
+  CHECK(f(123456.0) == "123456");
+  CHECK(f(0.0001) == "0.0001");
+  CHECK(f(0.00001) == "1e-5");
+  CHECK(toShortestString<float32>(fromNative<float32>(0.1f)) == "0.1");
+  CHECK(toShortestString<float32>(fromNative<float32>(16777216.0f)) ==
+        "16777216");
+  CHECK(toShortestString<float64>(fromNative<float64>(2.0 / 3.0)) ==
+        toString<float64>(fromNative<float64>(2.0 / 3.0), 16));
+}
+
+// -----------------------------------------------------------------
+// streamDigits
+// -----------------------------------------------------------------
+// The full expansion must end (exactly, nothing dropped) and, where
+// it fits MaxDecimalDigits, equal decimalDigits at its own length;
+// the first D digits rounded by the stream's own tail report must
+// equal decimalDigits at D, carries included; and stopping from the
+// sink must report the same tail as the equivalent limit.
+template <typename T>
+void verifyStream(const char *Name, int samples, std::uint64_t seed) {
+  using namespace opine::detail;
+  using Bits = typename T::storage_type;
+  std::mt19937_64 rng(seed);
+  int failed = 0, total = 0;
+  auto check = [&](Bits x) {
+    if (unpackOperand<T>(x).category != ValueCategory::Finite)
+      return;
+    ++total;
+    std::string all;
+    const DigitStream full = streamDigits<T>(x, [&](std::string_view c) {
+      all += c;
+      return true;
+    });
+    bool ok = full.ok && full.count == long(all.size()) && !full.inexact &&
+              all.front() != '0' && all.back() != '0';
+    if (ok && full.count <= MaxDecimalDigits) {
+      const DecimalDigits d = decimalDigits<T>(x, int(full.count));
+      ok = d.digits() == all && d.k10 == full.k10 && d.neg == full.neg;
+    }
+
+    const int D = 1 + int(rng() % 60);
+    std::string head;
+    const DigitStream part = streamDigits<T>(
+        x,
+        [&](std::string_view c) {
+          head += c;
+          return true;
+        },
+        D);
+    long k10 = part.k10;
+    if (part.roundsUp()) {
+      int i = int(head.size()) - 1;
+      for (; i >= 0 && head[i] == '9'; --i)
+        head[i] = '0';
+      if (i >= 0) {
+        ++head[i];
+      } else {
+        head.insert(head.begin(), '1');
+        head.pop_back();
+        ++k10;
+      }
+    }
+    head.resize(std::size_t(D), '0');
+    const DecimalDigits want = decimalDigits<T>(x, D);
+    ok = ok && head == want.digits() && k10 == want.k10 &&
+         part.inexact == (full.count > D);
+
+    int chunks = 0;
+    long taken = 0;
+    const DigitStream stop = streamDigits<T>(x, [&](std::string_view c) {
+      taken += long(c.size());
+      return ++chunks < 2;
+    });
+    if (full.count > taken) {
+      const DigitStream same = streamDigits<T>(
+          x, [](std::string_view) { return true; }, taken);
+      ok = ok && stop.count == taken && stop.tail == same.tail &&
+           stop.inexact == same.inexact && stop.last_odd == same.last_odd;
+    }
+    if (!ok) {
+      if (failed < 5)
+        std::fprintf(stderr, "  FAIL %s stream: %s (D=%d)\n", Name,
+                     toHexString<T>(x).c_str(), D);
+      ++failed;
+    }
+  };
+  for (Bits x : structuralValues<T>())
+    check(x);
+  RandomSingles<Bits, T::layout::total_bits> rnd{seed, samples};
+  rnd([&](Bits x) { check(x); });
+  std::printf("%s: %d/%d streamed\n", Name, total - failed, total);
+  CHECK(failed == 0);
+}
+
+TEST_CASE("string: streamDigits vs decimalDigits") {
+  verifyStream<float16>("f16", 2000, 0x5a);
+  verifyStream<float32>("f32", 2000, 0x5b);
+  verifyStream<float64>("f64", 2000, 0x5c);
+  verifyStream<float128>("f128", 100, 0x5d);
+
+  // Example 13's 0.1, whole, and the float64 minimum subnormal.
+  std::string s;
+  auto take = [&](std::string_view c) {
+    s += c;
+    return true;
+  };
+  auto d = streamDigits<float64>(fromString<float64>("0.1"), take);
+  CHECK(s == "1000000000000000055511151231257827021181583404541015625");
+  CHECK(d.k10 == -1);
+  s.clear();
+  d = streamDigits<float64>(float64::storage_type{1}, take);
+  CHECK(d.count == 751);
+  CHECK(d.k10 == -324);
+  CHECK(s.substr(0, 12) == "494065645841");
+  CHECK(!streamDigits<float64>(float64::storage_type{0}, take).ok);
+}
+
+// -----------------------------------------------------------------
+// Scratch workspace
+// -----------------------------------------------------------------
+// Every conversion run under a ScratchScope must give the text (and
+// parse) it gives on the stack, fit decimalScratchLimbs, and hand
+// the workspace back empty; a buffer too small for a tier, and a
+// nested scope, change nothing either.
+template <typename T>
+void verifyScratch(const char *Name, int samples, std::uint64_t seed) {
+  using namespace opine::detail;
+  using Bits = typename T::storage_type;
+  std::vector<std::uint64_t> buf(decimalScratchLimbs);
+  std::uint64_t tiny[64];
+  std::mt19937_64 rng(seed);
+  int failed = 0, total = 0;
+  std::size_t peak = 0;
+  auto texts = [&](Bits x, int D) {
+    char fixed[2048];
+    const auto r = toChars<T>(fixed, fixed + sizeof fixed, x,
+                              std::chars_format::fixed, D % 40);
+    std::string streamed;
+    streamDigits<T>(
+        x,
+        [&](std::string_view c) {
+          streamed += c;
+          return true;
+        },
+        D * 20);
+    const std::string shortest = toShortestString<T>(x);
+    typename T::storage_type back{};
+    flags_t flags = FlagNone;
+    const std::string lit = toString<T>(x, D) + "1";
+    parseChars<T>(lit.data(), lit.data() + lit.size(), back, flags);
+    return shortest + " " + toString<T>(x, D) + " " +
+           std::string(fixed, r.ptr) + " " + streamed + " " +
+           toHexString<T>(back) + std::to_string(int(flags));
+  };
+  auto check = [&](Bits x) {
+    if (unpackOperand<T>(x).category != ValueCategory::Finite)
+      return;
+    ++total;
+    const int D = 1 + int(rng() % 100);
+    const std::string want = texts(x, D);
+    bool ok;
+    {
+      ScratchScope scope(buf);
+      ok = texts(x, D) == want && scope.arena.used == 0;
+      {
+        ScratchScope small(tiny); // too small: the stack again
+        ok = ok && texts(x, D) == want && small.peakLimbs() == 0;
+      }
+      ok = ok && installedScratch() == &scope.arena;
+      if (scope.peakLimbs() > peak)
+        peak = scope.peakLimbs();
+    }
+    ok = ok && installedScratch() == nullptr;
+    if (!ok) {
+      if (failed < 5)
+        std::fprintf(stderr, "  FAIL %s scratch: %s (D=%d)\n", Name,
+                     toHexString<T>(x).c_str(), D);
+      ++failed;
+    }
+  };
+  for (Bits x : structuralValues<T>())
+    check(x);
+  RandomSingles<Bits, T::layout::total_bits> rnd{seed, samples};
+  rnd([&](Bits x) { check(x); });
+  std::printf("%s: %d/%d in a workspace, peak %zu limbs\n", Name,
+              total - failed, total, peak);
+  CHECK(failed == 0);
+  CHECK(peak > 0);
+  CHECK(peak <= decimalScratchLimbs);
+}
+
+TEST_CASE("string: conversions in a ScratchScope") {
+  verifyScratch<float64>("f64", 1000, 0x6a);
+  verifyScratch<float128>("f128", 60, 0x6b); // through the 1024 tier
+}
+
+// -----------------------------------------------------------------
+// toChars / fromChars
+// -----------------------------------------------------------------
+// Layouts against the C library: %.*e, %.*f and %.*a at random
+// precisions, and std::to_chars' shortest forms. printf pads the
+// exponent to two digits and OPINE does not, so its exponents are
+// compared by value. NaN prints unsigned here, so it is skipped.
+namespace {
+std::string unpadExponent(std::string s) {
+  const bool hex = s.find("0x") != std::string::npos;
+  const auto p = s.find_last_of(hex ? 'p' : 'e');
+  if (p == std::string::npos || p + 2 > s.size())
+    return s;
+  std::size_t z = p + 2;
+  while (z + 1 < s.size() && s[z] == '0')
+    ++z;
+  return s.substr(0, p + 2) + s.substr(z);
+}
+} // namespace
+
+TEST_CASE("string: toChars layouts vs printf and std::to_chars (f64)") {
+  std::mt19937_64 rng(0xc1);
+  char buf[2048], ref[2048];
+  int failed = 0;
+  auto check = [&](std::to_chars_result r, std::string want) {
+    if (r.ec != std::errc{} || std::string(buf, r.ptr) != want) {
+      if (failed < 5)
+        std::fprintf(stderr, "  FAIL toChars: \"%s\" want \"%s\"\n",
+                     std::string(buf, r.ptr).c_str(), want.c_str());
+      ++failed;
+    }
+  };
+  for (int i = 0; i < 50000; ++i) {
+    std::uint64_t b = rng();
+    if (i % 3 == 0) // short binary fractions: ties and exact cases
+      b = fromNative<float64>(
+          double(std::int64_t(rng() % 2000000) - 1000000) /
+          double(1 << (rng() % 20)));
+    const double d = toDouble<float64>(b);
+    if (d != d)
+      continue;
+    const int p = int(rng() % 30);
+    using std::chars_format;
+    char *const end = buf + sizeof buf;
+
+    std::snprintf(ref, sizeof ref, "%.*e", p, d);
+    check(toChars<float64>(buf, end, b, chars_format::scientific, p),
+          unpadExponent(ref));
+    std::snprintf(ref, sizeof ref, "%.*f", p, d);
+    check(toChars<float64>(buf, end, b, chars_format::fixed, p), ref);
+    std::snprintf(ref, sizeof ref, "%.*a", p % 15, d);
+    check(toChars<float64>(buf, end, b, chars_format::hex, p % 15),
+          unpadExponent(ref));
+
+    auto r = std::to_chars(ref, ref + sizeof ref, d, chars_format::scientific);
+    check(toChars<float64>(buf, end, b, chars_format::scientific),
+          unpadExponent(std::string(ref, r.ptr)));
+    r = std::to_chars(ref, ref + sizeof ref, d, chars_format::fixed);
+    check(toChars<float64>(buf, end, b, chars_format::fixed),
+          std::string(ref, r.ptr));
+  }
+  // Long fixed output: every digit of the exact value.
+  for (int i = 0; i < 500; ++i) {
+    const std::uint64_t b = rng();
+    const double d = toDouble<float64>(b);
+    if (d != d || d - d != 0)
+      continue;
+    const int p = 700 + int(rng() % 300);
+    std::snprintf(ref, sizeof ref, "%.*f", p, d);
+    check(toChars<float64>(buf, buf + sizeof buf, b, std::chars_format::fixed,
+                           p),
+          ref);
+  }
+  CHECK(failed == 0);
+
+  // No room: value_too_large, ptr == last, as std::to_chars.
+  auto small = toChars<float64>(buf, buf + 3, fromNative<float64>(3.14159));
+  CHECK(small.ec == std::errc::value_too_large);
+  CHECK(small.ptr == buf + 3);
+  auto fits = toChars<float64>(buf, buf + 7, fromNative<float64>(3.14159));
+  CHECK(fits.ec == std::errc{});
+  CHECK(std::string(buf, fits.ptr) == "3.14159");
+}
+
+TEST_CASE("string: fromChars reads a prefix in place") {
+  auto parse = [](std::string_view s) {
+    return fromChars<float64>(s.data(), s.data() + s.size());
+  };
+  const std::string_view trailing = "1.5e3xyz";
+  auto r = parse(trailing);
+  CHECK(r.ec == std::errc{});
+  CHECK(r.ptr == trailing.data() + 5);
+  CHECK(toDouble<float64>(r.value) == 1500.0);
+
+  const std::string_view dangling = "1e+";
+  r = parse(dangling); // the exponent has no digits: just "1"
+  CHECK(r.ptr == dangling.data() + 1);
+  CHECK(toDouble<float64>(r.value) == 1.0);
+
+  const std::string_view inf = "infinityx";
+  r = parse(inf);
+  CHECK(r.ptr == inf.data() + 8);
+
+  const std::string_view bad = "-.e1";
+  r = parse(bad);
+  CHECK(r.ec == std::errc::invalid_argument);
+  CHECK(r.ptr == bad.data());
+
+  r = parse("00012.50");
+  CHECK(toDouble<float64>(r.value) == 12.5);
+
+  // Flags travel with the value under ReturnStatus.
+  using T = Type<numbers::IEEE754<8, 23>, layouts::IEEE<8, 23, true>,
+                 rounding::Default, exceptions::ReturnStatus>;
+  const std::string_view tenth = "0.1,";
+  auto s = fromChars<T>(tenth.data(), tenth.data() + tenth.size());
+  CHECK(s.ptr == tenth.data() + 3);
+  CHECK((s.value.flags & FlagInexact) != 0);
+}
+
+// -----------------------------------------------------------------
+// parseMany vs per-token fromString
+// -----------------------------------------------------------------
+// The SWAR helpers against byte loops on random words biased toward
+// digits and separators, then parseMany on random CSV / whitespace
+// text — short, long, and point-straddling digit runs, empty fields,
+// junk tokens — value for value and flag for flag against fromString
+// on each field.
+TEST_CASE("string: SWAR helpers vs byte loops") {
+  std::mt19937_64 rng(0x54);
+  const char alphabet[] = "0123456789 \t\n,.-e/:\x01\x7f";
+  int failed = 0;
+  for (int n = 0; n < 200000; ++n) {
+    char b[8];
+    for (char &c : b)
+      c = (rng() & 3) ? char('0' + rng() % 10)
+                      : alphabet[rng() % (sizeof alphabet - 1)];
+    if (rng() % 8 == 0)
+      b[rng() % 8] = char(rng());
+    std::uint64_t w;
+    std::memcpy(&w, b, 8);
+    bool all = true;
+    std::uint64_t v = 0;
+    int sep = 8;
+    for (int j = 0; j < 8; ++j) {
+      all = all && b[j] >= '0' && b[j] <= '9';
+      v = v * 10 + std::uint64_t(b[j] - '0');
+      if (sep == 8 && (static_cast<unsigned char>(b[j]) <= ' ' || b[j] == ','))
+        sep = j;
+    }
+    failed += detail::allDigits8(w) != all;
+    failed += all && detail::digits8Value(w) != v;
+    failed += detail::firstSeparator8(w) != sep;
+  }
+  CHECK(failed == 0);
+}
+
+TEST_CASE("string: parseMany matches per-token fromString") {
+  using T = Type<numbers::IEEE754<11, 52>, layouts::IEEE<11, 52, true>,
+                 rounding::Default, exceptions::ReturnStatus>;
+  std::mt19937_64 rng(0x540);
+  auto digits = [&](int n) {
+    std::string s;
+    for (int j = 0; j < n; ++j)
+      s += char('0' + rng() % 10);
+    return s;
+  };
+  int failed = 0;
+  for (int round = 0; round < 200; ++round) {
+    std::string text;
+    std::vector<std::string> fields; // what each slot should parse as
+    bool field_open = false;
+    for (int k = 0; k < 64; ++k) {
+      switch (rng() % 8) {
+      case 0: // empty CSV field
+        if (!field_open)
+          fields.push_back("");
+        text += rng() % 2 ? "," : " ,";
+        field_open = false;
+        continue;
+      case 1: // junk
+        fields.push_back(rng() % 2 ? "1.5x" : "--3");
+        break;
+      case 2: // long, point somewhere inside
+      {
+        std::string d = digits(1 + int(rng() % 40));
+        d.insert(rng() % (d.size() + 1), ".");
+        fields.push_back(d == "." ? "0.5" : d);
+        break;
+      }
+      default: {
+        std::string t = rng() % 4 == 0 ? "-" : "";
+        t += digits(1 + int(rng() % 19));
+        if (rng() % 2)
+          t += "e" + std::to_string(int(rng() % 640) - 320);
+        fields.push_back(t);
+      }
+      }
+      text += fields.back();
+      field_open = true;
+      switch (rng() % 3) {
+      case 0: text += ","; field_open = false; break;
+      case 1: text += " "; break;
+      default: text += "\t\n"; break;
+      }
+    }
+    std::vector<float64::storage_type> out(fields.size() + 4);
+    std::vector<flags_t> flags(out.size());
+    auto r = parseMany<T>(text, out, flags);
+    failed += r.count != fields.size() || r.consumed != text.size();
+    for (std::size_t i = 0; i < fields.size() && i < r.count; ++i) {
+      auto want = fromString<T>(fields[i]);
+      failed += out[i] != want.bits || flags[i] != want.flags;
+    }
+  }
+  CHECK(failed == 0);
+
+  // out bounds the work; the side array may be shorter.
+  std::vector<float64::storage_type> two(2);
+  auto r = parseMany<float64>("1 2 3", two);
+  CHECK(r.count == 2);
+  CHECK(r.consumed == 3);
+  CHECK(toDouble<float64>(two[1]) == 2.0);
 }
 
 // -----------------------------------------------------------------
@@ -264,6 +1218,108 @@ TEST_CASE("string: toHexString round-trips through strtod (f64)") {
   CHECK(failed == 0);
 }
 
+// -----------------------------------------------------------------
+// Hex-float parsing
+// -----------------------------------------------------------------
+// toHexString is exact, so reading it back must give the identical
+// bits at every width; and a wider format's hex read into a narrower
+// one must round exactly as convert does, bits and flags, in every
+// mode.
+template <typename T>
+void verifyHexRoundTrip(const char *Name, int samples, std::uint64_t seed) {
+  using Bits = typename T::storage_type;
+  int failed = 0, total = 0;
+  auto check = [&](Bits x) {
+    const auto u = unpack<T>(x);
+    if (u.category == ValueCategory::NaN)
+      return;
+    ++total;
+    const std::string s = toHexString<T>(x);
+    if (!(fromString<T>(s) == pack<T>(u))) {
+      if (failed < 5)
+        std::fprintf(stderr, "  FAIL %s hex round-trip: %s\n", Name,
+                     s.c_str());
+      ++failed;
+    }
+  };
+  if constexpr (T::layout::total_bits <= 16) {
+    constexpr std::uint64_t N = std::uint64_t{1} << T::layout::total_bits;
+    for (std::uint64_t i = 0; i < N; ++i)
+      check(Bits(std::uint64_t(i)));
+    (void)samples;
+    (void)seed;
+  } else {
+    for (Bits x : structuralValues<T>())
+      check(x);
+    RandomSingles<Bits, T::layout::total_bits> rnd{seed, samples};
+    rnd([&](Bits x) { check(x); });
+  }
+  std::printf("%s: %d/%d hex round-trips\n", Name, total - failed, total);
+  CHECK(failed == 0);
+}
+
+template <typename R> int verifyHexNarrowing(std::uint64_t seed) {
+  using F32 = Type<numbers::IEEE754<8, 23>, layouts::IEEE<8, 23, true>, R,
+                   exceptions::ReturnStatus>;
+  int failed = 0;
+  RandomSingles<float64::storage_type, 64> rnd{seed, 5000};
+  rnd([&](float64::storage_type x) {
+    if (unpack<float64>(x).category == ValueCategory::NaN)
+      return;
+    const auto got = fromString<F32>(toHexString<float64>(x));
+    const auto want = convert<F32, float64>(x);
+    if (!(got.bits == want.bits) || got.flags != want.flags)
+      ++failed;
+  });
+  return failed;
+}
+
+TEST_CASE("string: hex-float parse") {
+  verifyHexRoundTrip<fp8_e4m3>("e4m3", 0, 0);
+  verifyHexRoundTrip<float16>("f16", 0, 0);
+  verifyHexRoundTrip<float32>("f32", 5000, 0xe1);
+  verifyHexRoundTrip<float64>("f64", 5000, 0xe2);
+  verifyHexRoundTrip<extFloat80>("extF80", 2000, 0xe3);
+  verifyHexRoundTrip<float128>("f128", 2000, 0xe4);
+  verifyHexRoundTrip<float256>("f256", 500, 0xe5);
+  verifyHexRoundTrip<float1024>("f1024", 200, 0xe6);
+
+  CHECK(verifyHexNarrowing<rounding::ToNearestTiesToEven>(0xe7) == 0);
+  CHECK(verifyHexNarrowing<rounding::TowardPositive>(0xe8) == 0);
+  CHECK(verifyHexNarrowing<rounding::TowardZero>(0xe9) == 0);
+
+  using F64 = Type<numbers::IEEE754<11, 52>, layouts::IEEE<11, 52, true>,
+                   rounding::Default, exceptions::ReturnStatus>;
+  auto f = [](const char *s) { return fromString<F64>(s); };
+  CHECK(f("0x1.8p+3").bits == fromNative<float64>(12.0));
+  CHECK(f("-0X.8P-1").bits == fromNative<float64>(-0.25));
+  CHECK(f("0x18").bits == fromNative<float64>(24.0));
+  CHECK(f("0x0.0").bits == fromNative<float64>(0.0));
+  CHECK(f("0x1p-1074").bits == 1u);
+  CHECK(f("0x1.8p-1075").bits == 1u);
+  auto tie = f("0x1p-1075"); // halfway to the min subnormal: even, 0
+  CHECK(tie.bits == 0u);
+  CHECK(tie.flags == (FlagUnderflow | FlagInexact));
+  auto over = f("0x1p+1024");
+  CHECK(over.bits == fromNative<float64>(HUGE_VAL));
+  CHECK(over.flags == (FlagOverflow | FlagInexact));
+  // Past 53 bits: the nibbles beyond are sticky.
+  auto up = f("0x1.00000000000008000000000001p0");
+  CHECK(up.bits == fromNative<float64>(1.0) + 1u);
+  CHECK(up.flags == FlagInexact);
+  CHECK(f("0x1.00000000000008p0").bits == fromNative<float64>(1.0));
+
+  // A binary exponent needs digits, and "0x" alone is a zero.
+  const char *text = "0x1p";
+  auto r = fromChars<F64>(text, text + 4);
+  CHECK(r.ptr == text + 3);
+  CHECK(r.value.bits == fromNative<float64>(1.0));
+  text = "0xg";
+  r = fromChars<F64>(text, text + 3);
+  CHECK(r.ptr == text + 1);
+  CHECK(r.value.bits == fromNative<float64>(0.0));
+}
+
 // -----------------------------------------------------------------
 // Formatting spot checks + flags through the parse path
 // -----------------------------------------------------------------
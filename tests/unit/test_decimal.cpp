@@ -0,0 +1,798 @@
+// BID decimal Types.
+//
+// The reference is independent of the library's limb kernels: a
+// field-by-field BID decoder and encoder, exact arithmetic on digit
+// strings, and the IEEE 754 §5.2 / §7 rounding rule stated on those
+// strings — the P-digit coefficient nearest the exact value at the
+// smallest exponent that holds it, the cohort member nearest the
+// preferred exponent when exact, tininess before rounding.
+//
+//   1. Codec: known encodings in both combination-field forms,
+//      non-canonical coefficients as zero, unpack/pack round trips.
+//   2. Known answers: quotients and sums with their preferred
+//      exponents.
+//   3. Arithmetic: add/sub/mul/div/fma sampled for decimal32/64/128
+//      in all five rounding modes against the reference, flags
+//      included.
+//   4. Specials and flags: x ÷ 0, invalid operations, overflow to
+//      Inf or max finite, the sign of an exact zero sum.
+//   5. Compare and classify across cohorts.
+//   6. Binary ↔ decimal conversions against strtod and printf, the
+//      string API's exclusion of decimal Types, fromInt/toInt and the
+//      native bridges.
+//   7. DPD: published encodings, the declet tables, BID ↔ DPD
+//      transcoding (scalar and convertMany) and arithmetic on DPD
+//      Types against the same operation on BID.
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <doctest/doctest.h>
+
+#include <algorithm>
+#include <bit>
+#include <charconv>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "opine/opine.hpp"
+
+using namespace opine;
+
+namespace {
+
+using U128 = unsigned __int128;
+
+struct Geometry {
+  int K, P, exp_bits, trailing, bias, qmin, qmax;
+};
+
+constexpr Geometry geometry(int K) {
+  const int P = 9 * K / 32 - 2, exp_bits = K / 16 + 6;
+  const int bias = 3 * (1 << (K / 16 + 3)) + P - 2;
+  return {K,       P,           exp_bits, K - 1 - exp_bits - 3,
+          bias,    -bias,       3 * (1 << (exp_bits - 2)) - 1 - bias};
+}
+
+// A decoded value: sign, coefficient digits (most significant
+// first, no leading zeros; empty for zero) and exponent.
+struct Ref {
+  enum Kind { Finite, Inf, NaN } kind = Finite;
+  bool neg = false;
+  std::string digits;
+  int q = 0;
+};
+
+std::string toDigits(U128 c) {
+  std::string s;
+  for (; c != 0; c /= 10)
+    s.insert(s.begin(), char('0' + int(c % 10)));
+  return s;
+}
+
+U128 fromDigits(const std::string &s) {
+  U128 c = 0;
+  for (char ch : s)
+    c = c * 10 + U128(ch - '0');
+  return c;
+}
+
+Ref refDecode(const Geometry &g, U128 x) {
+  Ref r;
+  r.neg = ((x >> (g.K - 1)) & 1) != 0;
+  const unsigned top5 = unsigned(x >> (g.K - 6)) & 0x1F;
+  if (top5 == 0x1E)
+    r.kind = Ref::Inf;
+  if (top5 == 0x1F)
+    r.kind = Ref::NaN;
+  if (r.kind != Ref::Finite)
+    return r;
+  const U128 exp_mask = (U128(1) << g.exp_bits) - 1;
+  U128 c;
+  int e;
+  if (((x >> (g.K - 3)) & 3) == 3) {
+    e = int((x >> (g.trailing + 1)) & exp_mask);
+    c = (U128(1) << (g.trailing + 3)) |
+        (x & ((U128(1) << (g.trailing + 1)) - 1));
+  } else {
+    e = int((x >> (g.trailing + 3)) & exp_mask);
+    c = x & ((U128(1) << (g.trailing + 3)) - 1);
+  }
+  r.digits = toDigits(c);
+  if (int(r.digits.size()) > g.P)
+    r.digits.clear(); // non-canonical: zero
+  r.q = e - g.bias;
+  return r;
+}
+
+U128 refEncode(const Geometry &g, const Ref &r) {
+  const U128 sign = U128(r.neg) << (g.K - 1);
+  if (r.kind == Ref::Inf)
+    return sign | (U128(0x1E) << (g.K - 6));
+  if (r.kind == Ref::NaN)
+    return U128(0x1F) << (g.K - 6);
+  const U128 c = fromDigits(r.digits), e = U128(r.q + g.bias);
+  if (c < (U128(1) << (g.trailing + 3)))
+    return sign | (e << (g.trailing + 3)) | c;
+  return sign | (U128(3) << (g.K - 3)) | (e << (g.trailing + 1)) |
+         (c & ((U128(1) << (g.trailing + 1)) - 1));
+}
+
+// Digit-string arithmetic on magnitudes.
+std::string strip(std::string s) {
+  const auto nz = s.find_first_not_of('0');
+  return nz == std::string::npos ? std::string() : s.substr(nz);
+}
+
+int cmpMag(const std::string &a, const std::string &b) {
+  if (a.size() != b.size())
+    return a.size() < b.size() ? -1 : 1;
+  return a.compare(b) < 0 ? -1 : a == b ? 0 : 1;
+}
+
+std::string addMag(const std::string &a, const std::string &b) {
+  std::string r;
+  int carry = 0;
+  for (int i = 0; i < int(std::max(a.size(), b.size())) || carry; ++i) {
+    const int x = i < int(a.size()) ? a[a.size() - 1 - i] - '0' : 0;
+    const int y = i < int(b.size()) ? b[b.size() - 1 - i] - '0' : 0;
+    r.insert(r.begin(), char('0' + (x + y + carry) % 10));
+    carry = (x + y + carry) / 10;
+  }
+  return strip(r);
+}
+
+std::string subMag(const std::string &a, const std::string &b) { // a >= b
+  std::string r;
+  int borrow = 0;
+  for (int i = 0; i < int(a.size()); ++i) {
+    int x = a[a.size() - 1 - i] - '0' - borrow;
+    const int y = i < int(b.size()) ? b[b.size() - 1 - i] - '0' : 0;
+    borrow = x < y;
+    r.insert(r.begin(), char('0' + x + 10 * borrow - y));
+  }
+  return strip(r);
+}
+
+std::string mulMag(const std::string &a, const std::string &b) {
+  if (a.empty() || b.empty())
+    return {};
+  std::string r(a.size() + b.size(), '0');
+  for (int i = int(a.size()) - 1; i >= 0; --i) {
+    int carry = 0;
+    for (int j = int(b.size()) - 1; j >= 0; --j) {
+      const int t = (r[i + j + 1] - '0') + (a[i] - '0') * (b[j] - '0') + carry;
+      r[i + j + 1] = char('0' + t % 10);
+      carry = t / 10;
+    }
+    r[i] = char(r[i] + carry);
+  }
+  return strip(r);
+}
+
+// The exact sum, except that an addend below every digit that can
+// matter is replaced by a one placed just there — the same rounding.
+Ref refAdd(const Geometry &g, Ref a, Ref b) {
+  const int preferred = std::min(a.q, b.q);
+  if (a.digits.empty() && b.digits.empty())
+    return {Ref::Finite, a.neg && b.neg, {}, preferred};
+  if (a.digits.empty() || b.digits.empty()) {
+    Ref r = a.digits.empty() ? b : a;
+    return r;
+  }
+  if (a.q < b.q)
+    std::swap(a, b);
+  const int floor_q = a.q - (g.P + 3 + int(b.digits.size()));
+  if (b.q < floor_q && b.q + int(b.digits.size()) < floor_q) {
+    b.digits = "1";
+    b.q = floor_q;
+  }
+  a.digits += std::string(a.q - b.q, '0');
+  Ref r{Ref::Finite, a.neg, {}, b.q};
+  if (a.neg == b.neg) {
+    r.digits = addMag(a.digits, b.digits);
+  } else if (cmpMag(a.digits, b.digits) >= 0) {
+    r.digits = subMag(a.digits, b.digits);
+  } else {
+    r.digits = subMag(b.digits, a.digits);
+    r.neg = b.neg;
+  }
+  return r;
+}
+
+struct Rounded {
+  U128 bits;
+  flags_t flags;
+};
+
+// The IEEE rule on an exact value (or, with sticky, one a little
+// past it), for a mode given as 0 RNE, 1 down, 2 up, 3 RZ, 4 RNA.
+Rounded refRound(const Geometry &g, Ref v, bool sticky, int preferred,
+                 int mode, bool zero_neg) {
+  auto clampQ = [&](int q) { return std::clamp(q, g.qmin, g.qmax); };
+  if (v.digits.empty() && !sticky)
+    return {refEncode(g, {Ref::Finite, zero_neg, {}, clampQ(preferred)}),
+            FlagNone};
+  const int n = int(v.digits.size());
+  int e = std::max(v.q + n - g.P, g.qmin);
+  auto overflow = [&] {
+    const bool to_inf = mode == 0 || mode == 4 || (mode == 1 && v.neg) ||
+                        (mode == 2 && !v.neg);
+    Ref r{to_inf ? Ref::Inf : Ref::Finite, v.neg, std::string(g.P, '9'),
+          g.qmax};
+    return Rounded{refEncode(g, r), flags_t(FlagOverflow | FlagInexact)};
+  };
+  if (!sticky) {
+    int tz = 0;
+    while (tz < n && v.digits[n - 1 - tz] == '0')
+      ++tz;
+    if (e <= v.q + tz) {
+      int q = std::clamp(preferred, e, v.q + tz);
+      if (q > g.qmax) {
+        if (e > g.qmax)
+          return overflow();
+        q = g.qmax;
+      }
+      Ref r = v;
+      if (q >= v.q)
+        r.digits.resize(n - (q - v.q));
+      else
+        r.digits += std::string(v.q - q, '0');
+      r.q = q;
+      return {refEncode(g, r), FlagNone};
+    }
+  }
+  const int drop = e - v.q; // digits below the result
+  std::string keep = drop > 0 ? v.digits.substr(0, std::max(n - drop, 0))
+                              : v.digits + std::string(-drop, '0');
+  const char rd = drop > 0 && n - drop >= 0 ? v.digits[n - drop] : '0';
+  bool rest = sticky;
+  for (int i = std::max(n - drop + 1, 0); i < n; ++i)
+    rest = rest || v.digits[i] != '0';
+  const bool odd = !keep.empty() && (keep.back() - '0') % 2 == 1;
+  const bool above = rd > '5' || (rd == '5' && rest);
+  const bool tie = rd == '5' && !rest;
+  bool up = false;
+  switch (mode) {
+  case 0: up = above || (tie && odd); break;
+  case 1: up = v.neg; break;
+  case 2: up = !v.neg; break;
+  case 3: up = false; break;
+  case 4: up = above || tie; break;
+  }
+  keep = strip(keep);
+  if (up) {
+    keep = addMag(keep, "1");
+    if (int(keep.size()) > g.P) {
+      keep.pop_back();
+      ++e;
+    }
+  }
+  flags_t flags = FlagInexact;
+  if (v.q + n - 1 < g.qmin + g.P - 1)
+    flags |= FlagUnderflow;
+  if (e > g.qmax)
+    return overflow();
+  Ref r{Ref::Finite, v.neg, keep, e};
+  return {refEncode(g, r), flags};
+}
+
+int failures = 0;
+
+void check(const char *label, const char *op, U128 a, U128 b, Rounded got,
+           Rounded want) {
+  if (got.bits == want.bits && got.flags == want.flags)
+    return;
+  if (++failures <= 10)
+    std::fprintf(stderr,
+                 "  FAIL %s %s a=0x%016llx%016llx b=0x%016llx%016llx: "
+                 "0x%016llx%016llx/%x, want 0x%016llx%016llx/%x\n",
+                 label, op, (unsigned long long)(a >> 64),
+                 (unsigned long long)a, (unsigned long long)(b >> 64),
+                 (unsigned long long)b, (unsigned long long)(got.bits >> 64),
+                 (unsigned long long)got.bits, unsigned(got.flags),
+                 (unsigned long long)(want.bits >> 64),
+                 (unsigned long long)want.bits, unsigned(want.flags));
+}
+
+template <typename R> constexpr int modeOf() {
+  if constexpr (std::is_same_v<R, rounding::TowardNegative>)
+    return 1;
+  else if constexpr (std::is_same_v<R, rounding::TowardPositive>)
+    return 2;
+  else if constexpr (std::is_same_v<R, rounding::TowardZero>)
+    return 3;
+  else if constexpr (std::is_same_v<R, rounding::ToNearestTiesAway>)
+    return 4;
+  else
+    return 0;
+}
+
+// Finite operands with exponents near zero, near either end and
+// anywhere; coefficients of every length, often all nines.
+template <int K> U128 sample(std::mt19937_64 &rng) {
+  constexpr Geometry g = geometry(K);
+  Ref r;
+  r.neg = (rng() & 1) != 0;
+  switch (rng() % 4) {
+  case 0: r.q = g.qmin + int(rng() % (2 * g.P + 2)); break;
+  case 1: r.q = g.qmax - int(rng() % (2 * g.P + 2)); break;
+  case 2: r.q = g.qmin + int(rng() % (g.qmax - g.qmin + 1)); break;
+  default: r.q = int(rng() % (4 * g.P + 4)) - 2 * g.P - 2; break;
+  }
+  const int n = int(rng() % (g.P + 1));
+  for (int i = 0; i < n; ++i)
+    r.digits += char('0' + (rng() % 4 == 0 ? 9 : rng() % 10));
+  r.digits = strip(r.digits);
+  return refEncode(g, r);
+}
+
+template <typename T, int K, typename Rnd> void verifySampled(const char *label) {
+  using S = WithExceptions<WithRounding<T, Rnd>, exceptions::ReturnStatus>;
+  using St = typename T::storage_type;
+  constexpr Geometry g = geometry(K);
+  constexpr int mode = modeOf<Rnd>();
+  const bool zero_sum_neg = mode == 1;
+  std::mt19937_64 rng(0xDEC + K + mode);
+  auto got = [](auto r) { return Rounded{U128(r.bits), r.flags}; };
+  for (int i = 0; i < 4000; ++i) {
+    const U128 a = sample<K>(rng), b = sample<K>(rng), c = sample<K>(rng);
+    const Ref ra = refDecode(g, a), rb = refDecode(g, b),
+              rc = refDecode(g, c);
+    Ref nb = rb;
+    nb.neg = !nb.neg;
+
+    auto sum = [&](const Ref &x, const Ref &y) {
+      const Ref s = refAdd(g, x, y);
+      const bool zneg = x.neg == y.neg ? x.neg : zero_sum_neg;
+      return refRound(g, s, false, std::min(x.q, y.q), mode, zneg);
+    };
+    check(label, "add", a, b, got(add<S>(St(a), St(b))), sum(ra, rb));
+    check(label, "sub", a, b, got(sub<S>(St(a), St(b))), sum(ra, nb));
+
+    Ref p{Ref::Finite, ra.neg != rb.neg, mulMag(ra.digits, rb.digits),
+          ra.q + rb.q};
+    check(label, "mul", a, b, got(mul<S>(St(a), St(b))),
+          refRound(g, p, false, p.q, mode, p.neg));
+
+    if (!rb.digits.empty()) {
+      // Schoolbook long division to P + 1 significant digits and a
+      // sticky remainder; the remainder stays below the divisor.
+      const U128 den = fromDigits(rb.digits);
+      U128 rem = 0;
+      std::string quot;
+      int pos = 0, scale = 0;
+      while ((int(strip(quot).size()) < g.P + 1 || pos < int(ra.digits.size())) &&
+             !(ra.digits.empty())) {
+        rem = rem * 10 + U128(pos < int(ra.digits.size()) ? ra.digits[pos] - '0' : 0);
+        if (pos++ >= int(ra.digits.size()))
+          ++scale;
+        quot += char('0' + int(rem / den));
+        rem %= den;
+      }
+      Ref qv{Ref::Finite, ra.neg != rb.neg, strip(quot),
+             ra.q - rb.q - scale};
+      check(label, "div", a, b, got(div<S>(St(a), St(b))),
+            refRound(g, qv, rem != 0, ra.q - rb.q, mode, qv.neg));
+    }
+
+    if (i % 2 == 0) {
+      const Ref s = refAdd(g, p, rc);
+      const bool zneg = p.neg == rc.neg ? p.neg : zero_sum_neg;
+      check(label, "fma", a, b, got(fma<S>(St(a), St(b), St(c))),
+            refRound(g, s, false, std::min(p.q, rc.q), mode, zneg));
+    }
+  }
+}
+
+template <typename T, int K> void verifyAllModes(const char *label) {
+  verifySampled<T, K, rounding::ToNearestTiesToEven>(label);
+  verifySampled<T, K, rounding::TowardNegative>(label);
+  verifySampled<T, K, rounding::TowardPositive>(label);
+  verifySampled<T, K, rounding::TowardZero>(label);
+  verifySampled<T, K, rounding::ToNearestTiesAway>(label);
+}
+
+} // namespace
+
+// -----------------------------------------------------------------
+// 1. Codec
+// -----------------------------------------------------------------
+TEST_CASE("decimal: BID encodings in both combination-field forms") {
+  static_assert(decimal32::number::exponent_bias == 101);
+  static_assert(decimal64::number::exponent_bias == 398);
+  static_assert(decimal128::number::exponent_bias == 6176);
+
+  const auto one = unpack<decimal32>(0x32800001u);
+  CHECK(one.category == ValueCategory::Finite);
+  CHECK(one.biased_exp == 101);
+  CHECK(one.significand == 1);
+  const auto nines = unpack<decimal32>(0x6CB8967Fu); // large form
+  CHECK(nines.significand == 9999999);
+  CHECK(nines.biased_exp == 101);
+  CHECK(unpack<decimal32>(0x77F8967Fu).biased_exp == 191); // max finite
+  CHECK(unpack<decimal32>(0x78000000u).category == ValueCategory::Infinity);
+  CHECK(unpack<decimal32>(0x7C000000u).category == ValueCategory::NaN);
+  // Coefficients at or above 10^P read as zero, keeping the exponent.
+  const auto nc = unpack<decimal32>(0x6CBFFFFFu);
+  CHECK(nc.category == ValueCategory::Zero);
+  CHECK(nc.biased_exp == 101);
+
+  constexpr Geometry g32 = geometry(32), g64 = geometry(64),
+                     g128 = geometry(128);
+  std::mt19937_64 rng(0xB1D);
+  for (int i = 0; i < 20000; ++i) {
+    const U128 x32 = sample<32>(rng), x64 = sample<64>(rng),
+               x128 = sample<128>(rng);
+    REQUIRE(pack<decimal32>(unpack<decimal32>(std::uint32_t(x32))) == x32);
+    REQUIRE(pack<decimal64>(unpack<decimal64>(std::uint64_t(x64))) == x64);
+    REQUIRE(pack<decimal128>(unpack<decimal128>(x128)) == x128);
+    CHECK(refEncode(g32, refDecode(g32, x32)) == x32);
+    CHECK(refEncode(g64, refDecode(g64, x64)) == x64);
+    CHECK(refEncode(g128, refDecode(g128, x128)) == x128);
+  }
+  const U128 max128 = (U128(0x5FFFED09BEAD87C0ull) << 64) | 0x378D8E63FFFFFFFFull;
+  CHECK(refDecode(g128, max128).digits == std::string(34, '9'));
+  CHECK(unpack<decimal128>(max128).biased_exp == 12287);
+}
+
+// -----------------------------------------------------------------
+// 2. Known answers
+// -----------------------------------------------------------------
+TEST_CASE("decimal: known answers and preferred exponents") {
+  using S = WithExceptions<decimal64, exceptions::ReturnStatus>;
+  constexpr std::uint64_t One = 0x31C0000000000001, Two = 0x31C0000000000002,
+                          Three = 0x31C0000000000003;
+
+  const auto third = div<S>(One, Three);
+  CHECK(third.bits == 0x2FCBD7A625405555); // 0.3333333333333333
+  CHECK(third.flags == FlagInexact);
+  // 2.40 / 2 = 1.20: an exact quotient keeps the preferred exponent.
+  CHECK(div<S>(0x31800000000000F0, Two).bits == 0x3180000000000078);
+  // 1 / 4 = 25E−2: the exact quotient nearest exponent 0.
+  CHECK(div<S>(One, 0x31C0000000000004).bits == 0x3180000000000019);
+  // 1E+2 + 1E+4 = 101E+2, not 10100.
+  const auto s = add<S>(0x3200000000000001, 0x3240000000000001);
+  CHECK(s.bits == 0x3200000000000065);
+  CHECK(s.flags == FlagNone);
+  // 1.20 × 2 = 2.40, exponents add.
+  CHECK(mul<S>(0x3180000000000078, Two).bits == 0x31800000000000F0);
+  CHECK(fma<S>(Two, Three, One).bits == 0x31C0000000000007);
+}
+
+// -----------------------------------------------------------------
+// 3. Arithmetic
+// -----------------------------------------------------------------
+TEST_CASE("decimal: sampled decimal32/64/128 against the digit-string reference") {
+  failures = 0;
+  verifyAllModes<decimal32, 32>("decimal32");
+  verifyAllModes<decimal64, 64>("decimal64");
+  verifyAllModes<decimal128, 128>("decimal128");
+  CHECK(failures == 0);
+}
+
+// -----------------------------------------------------------------
+// 4. Specials and flags
+// -----------------------------------------------------------------
+TEST_CASE("decimal: specials, overflow and flags") {
+  using S = WithExceptions<decimal32, exceptions::ReturnStatus>;
+  using SZ = WithExceptions<WithRounding<decimal32, rounding::TowardZero>,
+                            exceptions::ReturnStatus>;
+  using SD = WithExceptions<WithRounding<decimal32, rounding::TowardNegative>,
+                            exceptions::ReturnStatus>;
+  constexpr std::uint32_t One = 0x32800001, Ten = 0x3280000A, Zero = 0x32800000;
+  constexpr std::uint32_t Inf = 0x78000000, MaxFinite = 0x77F8967F;
+
+  const auto q = div<S>(One, Zero);
+  CHECK(q.bits == Inf);
+  CHECK(q.flags == FlagDivByZero);
+  CHECK(isNan<decimal32>(div<S>(Zero, Zero).bits));
+  CHECK(div<S>(Zero, Zero).flags == FlagInvalid);
+  CHECK(sub<S>(Inf, Inf).flags == FlagInvalid);
+  CHECK(mul<S>(Inf, Zero).flags == FlagInvalid);
+
+  const auto big = mul<S>(MaxFinite, Ten);
+  CHECK(big.bits == Inf);
+  CHECK(big.flags == (FlagOverflow | FlagInexact));
+  CHECK(mul<SZ>(MaxFinite, Ten).bits == MaxFinite);
+  // 1E+90 × 1E+6 prefers exponent 96 > Qmax = 90: the cohort
+  // member 1000000E+90 holds it exactly, with no flag.
+  const auto clamped = mul<S>(0x5F800001, 0x35800001);
+  CHECK(clamped.bits == 0x5F8F4240);
+  CHECK(clamped.flags == FlagNone);
+
+  // 1E−101 / 3 is tiny and inexact; 1E−101 / 1 is tiny but exact.
+  CHECK(div<S>(0x00000001, 0x32800003).flags ==
+        (FlagUnderflow | FlagInexact));
+  CHECK(div<S>(0x00000001, One).flags == FlagNone);
+
+  // x − x is +0, or −0 rounding downward.
+  CHECK(sub<S>(One, One).bits == Zero);
+  CHECK(sub<SD>(One, One).bits == (0x80000000u | Zero));
+}
+
+// -----------------------------------------------------------------
+// 5. Compare and classify
+// -----------------------------------------------------------------
+TEST_CASE("decimal: compare and classify across cohorts") {
+  constexpr std::uint64_t One = 0x31C0000000000001;
+  constexpr std::uint64_t OnePointOO = 0x3180000000000064; // 1.00
+  CHECK(eq<decimal64>(One, OnePointOO));
+  CHECK_FALSE(lt<decimal64>(One, OnePointOO));
+  CHECK(lt<decimal64>(0x3180000000000063, One)); // 0.99 < 1
+  CHECK(eq<decimal64>(0x31C0000000000000, 0xB040000000000000)); // 0 = −0E+..
+  CHECK(isNormal<decimal64>(One));
+  // 1E−398 has one digit below 10^emin: subnormal.
+  CHECK(isSubnormal<decimal64>(0x0000000000000001));
+  CHECK(isNormal<decimal64>(0x00038D7EA4C68000)); // 10^15 E−398
+  CHECK(isZero<decimal64>(0x6C7FFFFFFFFFFFFF));   // non-canonical
+}
+
+// -----------------------------------------------------------------
+// 6. Binary ↔ decimal
+// -----------------------------------------------------------------
+TEST_CASE("decimal: binary64 conversions against strtod and printf") {
+  using D64 = WithExceptions<decimal64, exceptions::ReturnStatus>;
+  using F64 = WithExceptions<float64, exceptions::ReturnStatus>;
+  constexpr Geometry g = geometry(64);
+  std::mt19937_64 rng(0xB2D);
+  failures = 0;
+  for (int i = 0; i < 20000; ++i) {
+    // decimal → binary: strtod rounds the digits to nearest-even.
+    const U128 x = sample<64>(rng);
+    const Ref r = refDecode(g, x);
+    const std::string text = (r.neg ? "-" : "") +
+                             (r.digits.empty() ? std::string("0") : r.digits) +
+                             "e" + std::to_string(r.q);
+    const double want = std::strtod(text.c_str(), nullptr);
+    const auto got = convert<F64, D64>(std::uint64_t(x));
+    check("d64→f64", "convert", x, 0, {got.bits, FlagNone},
+          {std::bit_cast<std::uint64_t>(want), FlagNone});
+
+    // binary → decimal: printf gives the exact expansion, which the
+    // reference rounds with preferred exponent 0.
+    double d = std::bit_cast<double>(rng());
+    if (!(std::abs(d) > 1e-300 && std::abs(d) < 1e300))
+      d = double(std::int64_t(rng() % 2000000) - 1000000) / 64;
+    static char buf[1200];
+    std::snprintf(buf, sizeof buf, "%.1100e", d);
+    const char *e = std::strchr(buf, 'e');
+    Ref v{Ref::Finite, buf[0] == '-', {}, std::atoi(e + 1) - 1100};
+    for (const char *c = buf; c != e; ++c)
+      if (*c >= '0' && *c <= '9')
+        v.digits += *c;
+    v.digits = strip(v.digits);
+    const auto dec = convert<D64, F64>(std::bit_cast<std::uint64_t>(d));
+    check("f64→d64", "convert", std::bit_cast<std::uint64_t>(d), 0,
+          {dec.bits, dec.flags}, refRound(g, v, false, 0, 0, v.neg));
+  }
+  CHECK(failures == 0);
+
+  // 0.1 is not a binary fraction: P correctly rounded digits.
+  const auto tenth = convert<D64, F64>(std::bit_cast<std::uint64_t>(0.1));
+  CHECK(tenth.bits == 0x2FC38D7EA4C68000); // 1000000000000000E−16
+  CHECK(tenth.flags == FlagInexact);
+  // 0.5 is exact: 5E−1.
+  CHECK(convert<D64, F64>(std::bit_cast<std::uint64_t>(0.5)).bits ==
+        0x31A0000000000005);
+}
+
+// The string API reads a binary significand; decimal Types are
+// constrained out of every entry point rather than misparsed.
+template <typename T>
+constexpr bool has_fromString = requires { fromString<T>("1"); };
+template <typename T>
+constexpr bool has_fromChars =
+    requires(const char *p) { fromChars<T>(p, p); };
+template <typename T>
+constexpr bool has_parseMany =
+    requires(std::span<typename T::storage_type> out) {
+      parseMany<T>("1", out);
+    };
+template <typename T>
+constexpr bool has_toString =
+    requires(typename T::storage_type b) { toString<T>(b); };
+template <typename T>
+constexpr bool has_toShortestString =
+    requires(typename T::storage_type b) { toShortestString<T>(b); };
+template <typename T>
+constexpr bool has_toHexString =
+    requires(typename T::storage_type b) { toHexString<T>(b); };
+template <typename T>
+constexpr bool has_toChars = requires(char *p, typename T::storage_type b) {
+  toChars<T>(p, p, b);
+  toChars<T>(p, p, b, std::chars_format::general);
+  toChars<T>(p, p, b, std::chars_format::general, 6);
+};
+template <typename T>
+constexpr bool has_streamDigits = requires(typename T::storage_type b) {
+  streamDigits<T>(b, [](std::string_view) { return true; });
+};
+template <typename T>
+constexpr bool has_any_string_api =
+    has_fromString<T> || has_fromChars<T> || has_parseMany<T> ||
+    has_toString<T> || has_toShortestString<T> || has_toHexString<T> ||
+    has_toChars<T> || has_streamDigits<T>;
+
+TEST_CASE("decimal: the string API is not offered on decimal Types") {
+  static_assert(has_fromString<float64> && has_fromChars<float64> &&
+                has_parseMany<float64> && has_toString<float64> &&
+                has_toShortestString<float64> && has_toHexString<float64> &&
+                has_toChars<float64> && has_streamDigits<float64>);
+  static_assert(!has_any_string_api<decimal32>);
+  static_assert(!has_any_string_api<decimal64>);
+  static_assert(!has_any_string_api<decimal128>);
+  static_assert(!has_any_string_api<decimal64dpd>);
+
+  // Decimal values reach text through a binary Type: "0.1" parsed
+  // into binary64 converts to decimal64's nearest, 1000000000000000E−16.
+  const auto tenth = convert<decimal64, float64>(fromString<float64>("0.1"));
+  CHECK(tenth == 0x2FC38D7EA4C68000);
+}
+
+TEST_CASE("decimal: integer conversion and the native bridges") {
+  using D32 = WithExceptions<decimal32, exceptions::ReturnStatus>;
+  using D64 = WithExceptions<decimal64, exceptions::ReturnStatus>;
+
+  // fromInt: i · 10^0, exact up to P digits.
+  CHECK(fromInt<decimal64>(1) == 0x31C0000000000001);
+  CHECK(fromInt<decimal64>(-7) == 0xB1C0000000000007);
+  CHECK(fromInt<decimal64>(0) == 0x31C0000000000000);
+  CHECK(fromInt<decimal64dpd>(1) == 0x2238000000000001);
+  // 123456789 has 9 digits, decimal32 7: 1234568E2, inexact.
+  const auto r = fromInt<D32>(123456789);
+  CHECK(r.bits == 0x3392D688);
+  CHECK(r.flags == FlagInexact);
+  CHECK(add<decimal64>(fromInt<decimal64>(1), fromNative<decimal64>(1.0)) ==
+        0x31C0000000000002);
+
+  // toInt: the coefficient shifted to 10^0, rounded per Rnd.
+  const auto two_and_half = fromNative<decimal64>(2.5); // 25E−1
+  CHECK(toInt<int, D64>(two_and_half).value == 2);
+  CHECK(toInt<int, D64>(two_and_half).flags == FlagInexact);
+  CHECK(toIntSaturating<int, decimal64, rounding::ToNearestTiesAway>(
+            two_and_half) == 3);
+  CHECK(toIntSaturating<int, decimal64, rounding::TowardNegative>(
+            fromNative<decimal64>(-2.1)) == -3);
+  CHECK(toInt<std::int8_t, D64>(fromInt<decimal64>(-128)).flags == FlagNone);
+  CHECK(toInt<std::int8_t, D64>(fromInt<decimal64>(128)).value == 127);
+  CHECK(toInt<std::int8_t, D64>(fromInt<decimal64>(128)).flags ==
+        FlagInvalid);
+  CHECK(toInt<unsigned, D64>(fromNative<decimal64>(-0.3)).value == 0);
+  CHECK(toInt<unsigned, D64>(fromNative<decimal64>(-0.3)).flags ==
+        FlagInexact);
+  CHECK(toInt<unsigned, D64>(fromNative<decimal64>(-0.7)).flags ==
+        FlagInvalid);
+  CHECK(toInt<long long, D64>(fromNative<decimal64>(1e300)).flags ==
+        FlagInvalid);
+  CHECK(toInt<int, D64>(0x7C00000000000000).flags == FlagInvalid); // NaN
+
+  // Every int64 with at most 16 digits round-trips exactly.
+  std::mt19937_64 rng(0x1D64);
+  failures = 0;
+  for (int i = 0; i < 20000; ++i) {
+    const auto v = std::int64_t(rng() % 19999999999999999) - 9999999999999999;
+    const auto d = fromInt<D64>(v);
+    const auto back = toInt<std::int64_t, D64>(d.bits);
+    if (d.flags != FlagNone || back.value != v || back.flags != FlagNone)
+      ++failures;
+  }
+  CHECK(failures == 0);
+
+  // The batch forms take the same overloads.
+  const std::int32_t ints[] = {1, -7, 123456789};
+  std::uint32_t dec[3];
+  flags_t flags[3];
+  fromIntMany<decimal32, std::int32_t>(ints, dec, flags);
+  CHECK(dec[2] == 0x3392D688);
+  CHECK(flags[2] == FlagInexact);
+  std::int32_t back[3];
+  toIntMany<std::int32_t, decimal32>(dec, back, flags);
+  CHECK(back[0] == 1);
+  CHECK(back[1] == -7);
+  CHECK(back[2] == 123456800);
+  CHECK(flags[2] == FlagNone);
+
+  // The native bridges are convert through binary32/binary64.
+  CHECK(fromNative<decimal64>(0.5) == 0x31A0000000000005);
+  CHECK(toDouble<decimal64>(fromNative<decimal64>(0.1)) == 0.1);
+  CHECK(toFloat<decimal32>(fromNative<decimal32>(2.5f)) == 2.5f);
+  CHECK(toDouble<decimal64>(fromInt<decimal64>(-7)) == -7.0);
+}
+
+// -----------------------------------------------------------------
+// 7. DPD
+// -----------------------------------------------------------------
+TEST_CASE("decimal: DPD encodings and declet tables") {
+  CHECK(convert<decimal32dpd, decimal32>(0x32800001u) == 0x22500001u);
+  CHECK(convert<decimal64dpd, decimal64>(0x31C0000000000001) ==
+        0x2238000000000001);
+  CHECK(convert<decimal128dpd, decimal128>(U128(0x3040000000000000) << 64 |
+                                           1) ==
+        (U128(0x2208000000000000) << 64 | 1));
+  // 9999999999999999 and 1.234567890123456: leading digits 9 and 1.
+  UnpackedFloat<std::uint64_t> u{};
+  u.category = ValueCategory::Finite;
+  u.biased_exp = 398;
+  u.significand = 9999999999999999;
+  CHECK(pack<decimal64dpd>(u) == 0x6E38FF3FCFF3FCFF);
+  u.biased_exp = 398 - 15;
+  u.significand = 1234567890123456;
+  CHECK(pack<decimal64dpd>(u) == 0x25FD34B9C1E28E56);
+  CHECK(unpack<decimal64dpd>(0x25FD34B9C1E28E56).significand ==
+        1234567890123456);
+  CHECK(unpack<decimal64dpd>(0x7800000000000000).category ==
+        ValueCategory::Infinity);
+
+  // The encode table is a bijection onto canonical declets; the 24
+  // others (the 111 row with pq ≠ 00) decode ignoring p and q.
+  std::vector<bool> hit(1024);
+  for (unsigned n = 0; n < 1000; ++n) {
+    const unsigned x = detail::dpdEncodeTable[n];
+    REQUIRE(detail::dpdDecodeTable[x] == n);
+    hit[x] = true;
+  }
+  CHECK(detail::dpdEncodeTable[80] == 0x00A);
+  CHECK(detail::dpdEncodeTable[999] == 0x0FF);
+  int noncanonical = 0;
+  for (unsigned x = 0; x < 1024; ++x) {
+    if (hit[x])
+      continue;
+    ++noncanonical;
+    CHECK((x & 0x6E) == 0x6E);
+    CHECK(detail::dpdDecodeTable[x] == detail::dpdDecodeTable[x & 0xFF]);
+  }
+  CHECK(noncanonical == 24);
+}
+
+TEST_CASE("decimal: BID ↔ DPD transcoding and DPD arithmetic") {
+  using B = WithExceptions<decimal128, exceptions::ReturnStatus>;
+  using D = WithExceptions<decimal128dpd, exceptions::ReturnStatus>;
+  std::mt19937_64 rng(0xD9D);
+  std::vector<U128> bid(4000), dpd(4000), back(4000);
+  for (auto &x : bid)
+    x = sample<128>(rng);
+  std::vector<flags_t> flags(4000);
+  CHECK(convertMany<decimal128dpd, decimal128>(std::span<const U128>(bid),
+                                               std::span<U128>(dpd),
+                                               std::span<flags_t>(flags)) ==
+        4000);
+  convertMany<decimal128, decimal128dpd>(std::span<const U128>(dpd),
+                                         std::span<U128>(back),
+                                         std::span<flags_t>(flags));
+  CHECK(anyFlags(flags) == FlagNone);
+  failures = 0;
+  for (std::size_t i = 0; i < bid.size(); ++i) {
+    check("dpd", "round trip", bid[i], 0, {back[i], FlagNone},
+          {bid[i], FlagNone});
+    check("dpd", "scalar", bid[i], 0,
+          {convert<decimal128dpd, decimal128>(bid[i]), FlagNone},
+          {dpd[i], FlagNone});
+    const std::size_t j = (i * 7 + 1) % bid.size();
+    auto same = [&](const char *op, auto on_dpd, auto on_bid) {
+      check("dpd", op, bid[i], bid[j],
+            {convert<decimal128, decimal128dpd>(on_dpd.bits), on_dpd.flags},
+            {on_bid.bits, on_bid.flags});
+    };
+    same("add", add<D>(dpd[i], dpd[j]), add<B>(bid[i], bid[j]));
+    same("mul", mul<D>(dpd[i], dpd[j]), mul<B>(bid[i], bid[j]));
+    same("div", div<D>(dpd[i], dpd[j]), div<B>(bid[i], bid[j]));
+    CHECK(lt<decimal128dpd>(dpd[i], dpd[j]) == lt<decimal128>(bid[i], bid[j]));
+  }
+  CHECK(failures == 0);
+
+  // decimal32 and decimal64 exhaustively over the declet field of a
+  // fixed exponent: every trailing pattern decodes and re-encodes to
+  // its canonical form.
+  for (std::uint32_t x = 0; x < (1u << 20); ++x) {
+    const std::uint32_t w = 0x22500000u | x;
+    const auto v = unpack<decimal32dpd>(w);
+    REQUIRE(unpack<decimal32dpd>(pack<decimal32dpd>(v)).significand ==
+            v.significand);
+  }
+}
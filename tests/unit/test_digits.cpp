@@ -8,8 +8,9 @@
 //   2. Exhaustive small-limb sweeps (uint8 limbs, 16-bit vectors)
 //      against plain scalar reference arithmetic. Runs everywhere.
 //   3. Structural invariants at 128/256/1024 bits (divmod
-//      reconstruction, shift algebra, carry-chain adversaries).
-//      Runs everywhere — no reference integer needed.
+//      reconstruction, shift algebra, carry-chain adversaries),
+//      and the radix-10^19 short division against 128-bit
+//      division. Runs everywhere.
 //   4. (Clang) Randomized differential tests against unsigned
 //      _BitInt at widths 40–2048 — as far as the compiler's
 //      __BITINT_MAXWIDTH__ reaches (LLVM Clang: all of them; Apple
@@ -26,6 +27,7 @@
 #include <vector>
 
 #include "opine/core/arith_detail.hpp"
+#include "opine/core/decimal_digits.hpp"
 #include "opine/core/digits.hpp"
 
 using namespace opine;
@@ -58,6 +60,14 @@ static_assert(detail::lowUint64(
                       detail::digitsFrom<std::uint8_t, 2>(0x0064),
                       detail::digitsFrom<std::uint8_t, 2>(0x0007))
                       .rem) == 2); // 100 % 7
+static_assert(detail::lowUint64(
+                  detail::divModLongDigits(
+                      detail::digitsFrom<std::uint8_t, 2>(0xFFFF),
+                      detail::digitsFrom<std::uint8_t, 2>(0x0181))
+                      .quot) == 0xAA); // 65535 / 385
+static_assert(detail::lowUint64(detail::mulSmallDigits(kA, std::uint8_t{10})) ==
+              0x13F6); // 511 * 10
+static_assert(detail::divModSmallDigits(kA, std::uint8_t{10}).rem == 1);
 static_assert(detail::lowUint64(
                   detail::sqrtRemDigits(
                       detail::digitsFrom<std::uint8_t, 2>(0x0064))
@@ -146,6 +156,108 @@ TEST_CASE("digits: sqrtRemDigits vs scalar reference, exhaustive 16-bit") {
   CHECK(failed == 0);
 }
 
+TEST_CASE("digits: one-limb mul/divmod, exhaustive 16-bit x all 8-bit") {
+  int failed = 0;
+  for (std::uint32_t x = 0; x <= 0xFFFF; ++x) {
+    const DV8x2 v = fromU16(std::uint16_t(x));
+    for (std::uint32_t m = 0; m <= 0xFF; ++m) {
+      const std::uint8_t a = std::uint8_t(m * 37 + x);
+      if (toU16(detail::mulAddSmallDigits(v, std::uint8_t(m), a)) !=
+          std::uint16_t(x * m + a))
+        ++failed;
+      if (m == 0)
+        continue;
+      auto qr = detail::divModSmallDigits(v, std::uint8_t(m));
+      if (toU16(qr.quot) != x / m || qr.rem != x % m)
+        ++failed;
+    }
+  }
+  CHECK(failed == 0);
+}
+
+// Long division's quotient-limb estimate and its add-back correction
+// only show up with several limbs on each side; uint8 limbs in a
+// 64-bit vector fire the add-back often (probability ~2/256 a step)
+// and uint64_t is the reference.
+TEST_CASE("digits: long division vs uint64_t, uint8 limbs x 8") {
+  std::mt19937_64 rng(0xD1D);
+  int failed = 0;
+  for (int iter = 0; iter < 400000; ++iter) {
+    const std::uint64_t a = rng() >> (rng() % 64);
+    std::uint64_t b = rng() >> (rng() % 64);
+    if (iter % 7 == 0) // divisor top limb just over / under half
+      b = (b >> 8 << 8 >> (rng() % 56)) | 0x80;
+    if (b == 0)
+      continue;
+    auto lm = detail::divModLongDigits(detail::digitsFrom<std::uint8_t, 8>(a),
+                                       detail::digitsFrom<std::uint8_t, 8>(b));
+    if (detail::lowUint64(lm.quot) != a / b ||
+        detail::lowUint64(lm.rem) != a % b)
+      ++failed;
+  }
+  CHECK(failed == 0);
+}
+
+// The in-place forms against uint64_t, the same values as the
+// value forms: carries and borrows out of the top, the truncated
+// product, and a divisor handed back unchanged.
+TEST_CASE("digits: in-place forms vs uint64_t, uint8 limbs x 8") {
+  using DV = DigitVector<std::uint8_t, 8>;
+  std::mt19937_64 rng(0x1A9);
+  int failed = 0;
+  for (int iter = 0; iter < 200000; ++iter) {
+    const std::uint64_t a = rng() >> (rng() % 64);
+    const std::uint64_t b = rng() >> (rng() % 64);
+    const DV va = detail::digitsFrom<std::uint8_t, 8>(a);
+    const DV vb = detail::digitsFrom<std::uint8_t, 8>(b);
+    const int k = int(rng() % 70);
+
+    DV v = va;
+    detail::shiftLeftDigitsInPlace(v, k);
+    failed += !(v == detail::shiftLeftDigits(va, k));
+    v = va;
+    detail::shiftRightDigitsInPlace(v, k);
+    failed += !(v == detail::shiftRightDigits(va, k));
+    v = va;
+    detail::shiftRightStickyDigitsInPlace(v, k);
+    failed += !(v == detail::shiftRightStickyDigits(va, k));
+
+    v = va;
+    failed += detail::addDigitsInPlace(v, vb) != (a + b < a);
+    failed += detail::lowUint64(v) != a + b;
+    v = va;
+    failed += detail::subDigitsInPlace(v, vb) != (a < b);
+    failed += detail::lowUint64(v) != a - b;
+    v = va;
+    const std::uint8_t s = std::uint8_t(rng());
+    failed += detail::addSmallDigitsInPlace(v, s) != (a + s < a);
+    failed += detail::lowUint64(v) != a + s;
+
+    v = va;
+    const std::uint8_t m = std::uint8_t(rng() | 1);
+    const auto ma = detail::mulAddSmallDigits(va, m, s);
+    failed += detail::mulAddSmallDigitsInPlace(v, m, s) !=
+              detail::mulAddSmallDigits(detail::resizeDigits<9>(va), m, s).d[8];
+    failed += !(v == ma);
+    v = va;
+    failed += detail::divModSmallDigitsInPlace(v, m) != a % m;
+    failed += detail::lowUint64(v) != a / m;
+
+    DV r;
+    detail::mulDigitsInto(r, va, vb);
+    failed += detail::lowUint64(r) != a * b;
+
+    if (b != 0) {
+      DV num = va, den = vb, quot;
+      detail::divModLongDigitsInPlace(num, den, quot);
+      failed += detail::lowUint64(quot) != a / b;
+      failed += detail::lowUint64(num) != a % b;
+      failed += !(den == vb);
+    }
+  }
+  CHECK(failed == 0);
+}
+
 TEST_CASE("digits: uint8-limb binary ops, exhaustive x targeted+random") {
   const std::uint16_t targeted[] = {
       0x0000, 0x0001, 0x0002, 0x007F, 0x0080, 0x00FF, 0x0100, 0x0101,
@@ -179,6 +291,9 @@ TEST_CASE("digits: uint8-limb binary ops, exhaustive x targeted+random") {
         auto dm = detail::divModDigits(va, vb);
         if (toU16(dm.quot) != a / b || toU16(dm.rem) != a % b)
           ++failed;
+        auto lm = detail::divModLongDigits(va, vb);
+        if (toU16(lm.quot) != a / b || toU16(lm.rem) != a % b)
+          ++failed;
       }
     };
 
@@ -239,6 +354,10 @@ void checkDivModInvariant(const DigitVector<Limb, Count> &num,
   wide = detail::addDigits(wide, detail::resizeDigits<2 * Count>(dm.rem));
   if (detail::compareDigits(wide, detail::resizeDigits<2 * Count>(num)) != 0)
     ++failed;
+  // Long division agrees with the bit-serial reference exactly.
+  auto lm = detail::divModLongDigits(num, den);
+  if (!(lm.quot == dm.quot) || !(lm.rem == dm.rem))
+    ++failed;
 }
 
 template <typename Limb, int Count>
@@ -337,6 +456,42 @@ TEST_CASE("digits: wide-width invariants (128/256/1024-bit)") {
   wideInvariants<std::uint32_t, 3>(0x44); // odd width, narrow limbs
 }
 
+// decimal_digits.hpp's short division runs each limb through the
+// divisor's Möller–Granlund reciprocal: two radix-10^19 limbs (a
+// value below 10^38) against the 128-bit quotient, with divisors
+// at every shift from 1 up to 10^19 − 1.
+TEST_CASE("digits: radix-10^19 short division vs 128-bit division") {
+  using U128 = bits_t<128>;
+  constexpr std::uint64_t B = detail::DecimalLimbRadix;
+  std::mt19937_64 rng(0xDEC);
+  int failed = 0;
+  for (int iter = 0; iter < 400000; ++iter) {
+    std::uint64_t den = rng() >> (rng() % 64);
+    if (iter % 5 == 0)
+      den = B - 1 - (rng() % 3);
+    den %= B;
+    if (den == 0)
+      den = 1 + iter % 3;
+    detail::DecimalVector<2> v{{rng() % B, rng() % B}};
+    if (iter % 7 == 0)
+      v.d[1] = B - 1;
+    const U128 x = U128(v.d[1]) * B + v.d[0];
+    const std::uint64_t rem = detail::divModSmallDigitsInPlace(v, den);
+    if (U128(v.d[1]) * B + v.d[0] != x / den || rem != x % den)
+      ++failed;
+
+    // The 2-by-1 step itself, for any quotient below 2^64.
+    const std::uint64_t u1 = rng() % den, u0 = rng();
+    std::uint64_t r = 0;
+    const std::uint64_t q =
+        detail::divModLimb(u1, u0, detail::limbReciprocal(den), r);
+    const U128 u = (U128(u1) << 64) | u0;
+    if (q != std::uint64_t(u / den) || r != std::uint64_t(u % den))
+      ++failed;
+  }
+  CHECK(failed == 0);
+}
+
 // -----------------------------------------------------------------
 // 4. Differential vs _BitInt (Clang only)
 // -----------------------------------------------------------------
@@ -404,6 +559,9 @@ template <typename Limb, int Count> void differential(std::uint64_t seed) {
       auto dm = detail::divModDigits(va, vb);
       if (toBits(dm.quot) != B(a / b) || toBits(dm.rem) != B(a % b))
         ++failed;
+      auto lm = detail::divModLongDigits(va, vb);
+      if (toBits(lm.quot) != B(a / b) || toBits(lm.rem) != B(a % b))
+        ++failed;
     }
 
     int k = int(rng() % (DV::total_bits + 8));
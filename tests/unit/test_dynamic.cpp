@@ -0,0 +1,231 @@
+// DynamicFormat / DynamicType verification.
+//
+// The contract is bit-identity with the static Types, so the static
+// kernels are the reference and no oracle is needed:
+//
+//   1. Descriptors — the factories spell the named bundles, of<T>()
+//      round-trips, valid() admits what the carrier covers.
+//   2. Dispatch — a descriptor matching the format list runs the
+//      precompiled kernels, anything else the generic tier.
+//   3. The generic tier (forced with an empty format list) against
+//      the static Type: every FP8 pair of add/sub/mul/div, every
+//      pattern of sqrt and the conversions, fma on a derived addend,
+//      for eight encodings in all six rounding modes — exhaustive in
+//      b under ties-to-even, every fifth b in the other modes.
+//   4. The same, sampled, at 16, 32 and 64 bits, including formats
+//      reaching the carrier's exponent range.
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <doctest/doctest.h>
+
+#include <cstdint>
+#include <cstdio>
+#include <random>
+
+#include "opine/core/dynamic.hpp"
+
+using namespace opine;
+
+namespace {
+
+using GenericOnly = FormatList<>;
+using GPU43 = Type<numbers::GPUStyle<4, 3>, layouts::IEEE<4, 3, true>>;
+
+// -----------------------------------------------------------------
+// 1. Descriptors
+// -----------------------------------------------------------------
+static_assert(DynamicFormat::of<fp8_e4m3>() == DynamicFormat::ieee(4, 3));
+static_assert(DynamicFormat::of<float32>() == DynamicFormat::ieee(8, 23));
+static_assert(DynamicFormat::of<fp8_e4m3fnuz>() == DynamicFormat::fnuz(4, 3));
+static_assert(DynamicFormat::of<RbjType<5, 2>>() == DynamicFormat::rbj(5, 2));
+static_assert(DynamicFormat::of<GPU43>() == DynamicFormat::gpu(4, 3));
+static_assert([] {
+  DynamicFormat f = DynamicFormat::relaxed(5, 2);
+  f.rounding = RoundingMode::TowardZero;
+  return DynamicFormat::of<FastType<5, 2>>() == f;
+}());
+
+static_assert(DynamicFormat::ieee(5, 6).valid());
+static_assert(DynamicFormat::ieee(11, 52).valid());
+static_assert(DynamicFormat::ieee(15, 48).valid());
+static_assert(!DynamicFormat::ieee(15, 62).valid()); // below the carrier
+static_assert(!DynamicFormat::ieee(16, 8).valid());  // beyond it
+static_assert(!DynamicFormat::ieee(11, 53).valid()); // 65 bits
+static_assert([] {
+  DynamicFormat f = DynamicFormat::fnuz(4, 3);
+  f.negative_zero = NegativeZero::Exists; // −0 is the NaN pattern
+  return !f.valid();
+}());
+
+int failures = 0;
+
+void check(const char *label, const char *op, std::uint64_t a,
+           std::uint64_t b, RoundingMode m, DynamicResult dyn,
+           std::uint64_t bits, flags_t flags) {
+  if (dyn.bits == bits && dyn.flags == flags)
+    return;
+  if (++failures <= 10)
+    std::fprintf(stderr,
+                 "  FAIL %s %s mode %d a=0x%llx b=0x%llx: dynamic "
+                 "0x%llx/0x%02x, static 0x%llx/0x%02x\n",
+                 label, op, int(m), (unsigned long long)a,
+                 (unsigned long long)b, (unsigned long long)dyn.bits,
+                 unsigned(dyn.flags), (unsigned long long)bits,
+                 unsigned(flags));
+}
+
+// T's operations on (a, b) through both paths; c is fma's addend.
+template <typename S>
+void compareBinary(const char *label, const DynamicType &g, RoundingMode m,
+                   std::uint64_t a, std::uint64_t b, std::uint64_t c) {
+  using St = typename S::storage_type;
+  auto cmp = [&](const char *op, DynamicResult dyn, WithStatus<S> ref) {
+    check(label, op, a, b, m, dyn, std::uint64_t(ref.bits), ref.flags);
+  };
+  cmp("add", g.add(a, b), add<S>(St(a), St(b)));
+  cmp("sub", g.sub(a, b), sub<S>(St(a), St(b)));
+  cmp("mul", g.mul(a, b), mul<S>(St(a), St(b)));
+  cmp("div", g.div(a, b), div<S>(St(a), St(b)));
+  cmp("fma", g.fma(a, b, c), fma<S>(St(a), St(b), St(c)));
+}
+
+template <typename S>
+void compareUnary(const char *label, const DynamicType &g, RoundingMode m,
+                  std::uint64_t a) {
+  using St = typename S::storage_type;
+  using H = WithExceptions<float16, exceptions::ReturnStatus>;
+  const auto s = sqrt<S>(St(a));
+  check(label, "sqrt", a, 0, m, g.sqrt(a), std::uint64_t(s.bits), s.flags);
+  const auto to = g.convertTo<H>(a);
+  const auto to_ref = convert<H, S>(St(a));
+  check(label, "convertTo", a, 0, m, {std::uint64_t(to.bits), to.flags},
+        std::uint64_t(to_ref.bits), to_ref.flags);
+  const std::uint32_t w = std::uint32_t(a * 2654435761u);
+  const auto from = convert<S, float32>(float32::storage_type(w));
+  check(label, "convertFrom", w, 0, m,
+        g.convertFrom<float32>(float32::storage_type(w)),
+        std::uint64_t(from.bits), from.flags);
+}
+
+// -----------------------------------------------------------------
+// 3. Exhaustive FP8
+// -----------------------------------------------------------------
+template <typename T> void verifyExhaustive(const char *label) {
+  constexpr unsigned N = 1u << T::layout::total_bits;
+  for (int mode = 0; mode < 6; ++mode) {
+    DynamicFormat f = DynamicFormat::of<T>();
+    f.rounding = RoundingMode(mode);
+    const auto g = dynamicType<GenericOnly>(f);
+    REQUIRE(g);
+    CHECK(!g->precompiled);
+    detail::withRoundingMode(f.rounding, [&]<typename R>() {
+      using S = WithExceptions<WithRounding<T, R>, exceptions::ReturnStatus>;
+      const unsigned step = f.rounding == RoundingMode::ToNearestTiesToEven
+                                ? 1
+                                : 5;
+      for (unsigned a = 0; a < N; ++a) {
+        compareUnary<S>(label, *g, f.rounding, a);
+        for (unsigned b = a % step; b < N; b += step)
+          compareBinary<S>(label, *g, f.rounding, a, b,
+                           (a * 31 + b * 17) & (N - 1));
+      }
+    });
+  }
+}
+
+// -----------------------------------------------------------------
+// 4. Sampled wide formats
+// -----------------------------------------------------------------
+template <typename T> void verifySampled(const char *label, int count) {
+  constexpr int Bits = T::layout::total_bits;
+  const std::uint64_t mask =
+      Bits == 64 ? ~std::uint64_t{0} : (std::uint64_t{1} << Bits) - 1;
+  std::mt19937_64 rng(0x0D1A7EULL + Bits);
+  for (int mode = 0; mode < 6; ++mode) {
+    DynamicFormat f = DynamicFormat::of<T>();
+    f.rounding = RoundingMode(mode);
+    const auto g = dynamicType<GenericOnly>(f);
+    REQUIRE(g);
+    detail::withRoundingMode(f.rounding, [&]<typename R>() {
+      using S = WithExceptions<WithRounding<T, R>, exceptions::ReturnStatus>;
+      for (int i = 0; i < count; ++i) {
+        const std::uint64_t a = rng() & mask;
+        std::uint64_t b = rng() & mask, c = rng() & mask;
+        if (i & 1) // a near neighbour: cancellation, ties
+          b = (a & ~std::uint64_t{0xFFFF}) | (b & 0xFFFF);
+        if (i % 3 == 0) // an addend cancelling the product's sign
+          c ^= std::uint64_t{1} << (Bits - 1);
+        compareUnary<S>(label, *g, f.rounding, a);
+        compareBinary<S>(label, *g, f.rounding, a, b, c);
+      }
+    });
+  }
+}
+
+} // namespace
+
+// -----------------------------------------------------------------
+// 2. Dispatch
+// -----------------------------------------------------------------
+TEST_CASE("dynamic: descriptors resolve to precompiled or generic kernels") {
+  const auto f32 = dynamicType(DynamicFormat::ieee(8, 23));
+  REQUIRE(f32);
+  CHECK(f32->precompiled);
+
+  DynamicFormat down = DynamicFormat::fnuz(4, 3);
+  down.rounding = RoundingMode::TowardNegative;
+  const auto fnuz = dynamicType(down);
+  REQUIRE(fnuz);
+  CHECK(fnuz->precompiled);
+
+  const auto e5m6 = dynamicType(DynamicFormat::ieee(5, 6));
+  REQUIRE(e5m6);
+  CHECK(!e5m6->precompiled);
+  const DynamicResult x = e5m6->fromNative(1.1);
+  CHECK(x.bits == 0x3C6); // 1 + 6/64
+  CHECK(x.flags == FlagInexact);
+  CHECK(e5m6->toDouble(x.bits) == 1.09375);
+
+  // A user list: e5m6 precompiled after all.
+  const auto mine =
+      dynamicType<FormatList<IEEE754Type<5, 6>>>(DynamicFormat::ieee(5, 6));
+  REQUIRE(mine);
+  CHECK(mine->precompiled);
+  CHECK(mine->add(0x3C6, 0x3C6).bits == e5m6->add(0x3C6, 0x3C6).bits);
+
+  // Between two runtime formats and back.
+  const DynamicResult h = f32->convertFrom(*e5m6, x.bits);
+  CHECK(h.flags == FlagNone);
+  CHECK(e5m6->convertFrom(*f32, h.bits).bits == x.bits);
+
+  CHECK(!dynamicType(DynamicFormat::ieee(16, 8)));
+}
+
+TEST_CASE("dynamic: generic tier matches the static Types on FP8") {
+  failures = 0;
+  verifyExhaustive<fp8_e5m2>("e5m2");
+  verifyExhaustive<fp8_e4m3>("e4m3");
+  verifyExhaustive<fp8_e4m3fnuz>("e4m3fnuz");
+  verifyExhaustive<RbjType<4, 3>>("rbj43");
+  verifyExhaustive<FastType<4, 3>>("relaxed43");
+  verifyExhaustive<GPU43>("gpu43");
+  verifyExhaustive<IEEE754Type<3, 4>>("e3m4");
+  verifyExhaustive<IEEE754Type<2, 5>>("e2m5");
+  CHECK(failures == 0);
+}
+
+TEST_CASE("dynamic: generic tier matches the static Types, sampled wide") {
+  failures = 0;
+  verifySampled<float16>("f16", 4000);
+  verifySampled<bfloat16>("bf16", 4000);
+  verifySampled<float32>("f32", 4000);
+  verifySampled<float64>("f64", 4000);
+  verifySampled<RbjType<11, 52>>("rbj11_52", 4000);
+  verifySampled<FastType<8, 23>>("relaxed8_23", 4000);
+  verifySampled<IEEE754Type<6, 20>>("e6m20", 4000);
+  // The carrier's own exponent range: overflow past it, subnormals
+  // within it.
+  verifySampled<IEEE754Type<15, 48>>("e15m48", 4000);
+  verifySampled<IEEE754Type<14, 49>>("e14m49", 4000);
+  CHECK(failures == 0);
+}
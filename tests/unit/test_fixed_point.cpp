@@ -0,0 +1,514 @@
+// Fixed-point (Qm.n) Types.
+//
+// The reference is independent of the library's codec and kernels:
+// a word is the integer it holds, read as a two's complement or
+// unsigned W-bit number, and every result is stated on integers —
+// the exact value as n / d, its floor and remainder, the Rounding
+// axis as a rule on the remainder, then the word's range (clamp or
+// wrap modulo 2^W). Floating-point sources are the host's doubles,
+// exact for every source used here.
+//
+//   1. Codec: the predefined Types' words, unpack/pack round trips.
+//   2. Arithmetic: exhaustive Q7 add/sub/mul/div in both overflow
+//      modes and every rounding mode; sampled Q15, Q31, Q63, UQ8.8
+//      and Q15.16.
+//   3. Conversions: Q15 ↔ float32 / float16 / bfloat16 / decimal64,
+//      Q7 ↔ Q15, every rounding mode, against the integer rule.
+//   4. Ordering: compare, nextUp/nextDown, neg.
+//   5. Batch: the blocked kernels against the scalar operations,
+//      with flag arrays, FlagLists and accumulated status flags.
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <doctest/doctest.h>
+
+#include <bit>
+#include <cmath>
+#include <cstdint>
+#include <random>
+#include <span>
+#include <tuple>
+#include <vector>
+
+#include "opine/opine.hpp"
+
+using namespace opine;
+
+namespace {
+
+using i128 = __int128;
+
+template <typename T> using Status = WithExceptions<T, exceptions::ReturnStatus>;
+
+using Roundings =
+    std::tuple<rounding::ToNearestTiesToEven, rounding::ToNearestTiesAway,
+               rounding::TowardZero, rounding::TowardPositive,
+               rounding::TowardNegative, rounding::ToOdd>;
+
+template <typename F> void forEachRounding(F &&f) {
+  std::apply([&](auto... r) { (f(r), ...); }, Roundings{});
+}
+
+template <typename T> constexpr int wordBits() {
+  return T::layout::total_bits;
+}
+template <typename T> constexpr bool isSigned() {
+  return T::number::value_sign == SignMethod::RadixComplement;
+}
+template <typename T> constexpr i128 wordMin() {
+  return isSigned<T>() ? -(i128(1) << (wordBits<T>() - 1)) : 0;
+}
+template <typename T> constexpr i128 wordMax() {
+  return isSigned<T>() ? (i128(1) << (wordBits<T>() - 1)) - 1
+                       : (i128(1) << wordBits<T>()) - 1;
+}
+
+// The integer a word holds.
+template <typename T> i128 value(typename T::storage_type w) {
+  constexpr int W = wordBits<T>();
+  const std::uint64_t mask = ~std::uint64_t{0} >> (64 - W);
+  const std::uint64_t x = std::uint64_t(w) & mask;
+  if (isSigned<T>() && ((x >> (W - 1)) & 1) != 0)
+    return i128(x) - (i128(1) << W);
+  return i128(x);
+}
+
+template <typename T> typename T::storage_type word(i128 v) {
+  constexpr int W = wordBits<T>();
+  const std::uint64_t mask = ~std::uint64_t{0} >> (64 - W);
+  return typename T::storage_type(std::uint64_t(v) & mask);
+}
+
+struct Ref {
+  i128 v;
+  flags_t flags;
+};
+
+// q + r/d with 0 ≤ r < d, rounded to an integer by R.
+template <typename R> i128 roundRef(i128 q, i128 r, i128 d) {
+  if (r == 0)
+    return q;
+  if constexpr (std::is_same_v<R, rounding::TowardNegative>)
+    return q;
+  else if constexpr (std::is_same_v<R, rounding::TowardPositive>)
+    return q + 1;
+  else if constexpr (std::is_same_v<R, rounding::TowardZero>)
+    return q < 0 ? q + 1 : q;
+  else if constexpr (std::is_same_v<R, rounding::ToNearestTiesToEven>)
+    return 2 * r > d || (2 * r == d && (q & 1) != 0) ? q + 1 : q;
+  else if constexpr (std::is_same_v<R, rounding::ToNearestTiesAway>)
+    return 2 * r > d || (2 * r == d && q >= 0) ? q + 1 : q;
+  else
+    return (q & 1) != 0 ? q : q + 1; // ToOdd
+}
+
+// n / d rounded by R, flagged, and brought into T's range by its
+// OverflowMode (or clamped regardless, when saturate is set).
+template <typename T, typename R>
+Ref fromRatio(i128 n, i128 d, bool saturate = false) {
+  if (d < 0) {
+    n = -n;
+    d = -d;
+  }
+  i128 q = n / d, r = n % d;
+  if (r < 0) {
+    q -= 1;
+    r += d;
+  }
+  Ref out{roundRef<R>(q, r, d), FlagNone};
+  if (r != 0) {
+    out.flags |= FlagInexact;
+    if ((n < 0 ? -n : n) < d)
+      out.flags |= FlagUnderflow;
+  }
+  if (out.v < wordMin<T>() || out.v > wordMax<T>()) {
+    out.flags |= FlagOverflow | FlagInexact;
+    if (saturate || T::number::overflow == OverflowMode::Saturate)
+      out.v = out.v < wordMin<T>() ? wordMin<T>() : wordMax<T>();
+  }
+  return out;
+}
+
+enum class Op { Add, Sub, Mul, Div };
+
+template <typename T, typename R> Ref refOp(Op op, i128 x, i128 y) {
+  constexpr int F = T::number::fraction_digits;
+  switch (op) {
+  case Op::Add:
+    return fromRatio<T, R>(x + y, 1);
+  case Op::Sub:
+    return fromRatio<T, R>(x - y, 1);
+  case Op::Mul:
+    return fromRatio<T, R>(x * y, i128(1) << F);
+  case Op::Div:
+    if (y == 0)
+      return x == 0 ? Ref{0, FlagInvalid}
+                    : Ref{x < 0 ? wordMin<T>() : wordMax<T>(), FlagDivByZero};
+    return fromRatio<T, R>(x * (i128(1) << F), y);
+  }
+  return {};
+}
+
+template <typename T>
+WithStatus<Status<T>> runOp(Op op, typename T::storage_type a,
+                            typename T::storage_type b) {
+  using S = Status<T>;
+  switch (op) {
+  case Op::Add:
+    return add<S>(a, b);
+  case Op::Sub:
+    return sub<S>(a, b);
+  case Op::Mul:
+    return mul<S>(a, b);
+  case Op::Div:
+    return div<S>(a, b);
+  }
+  return {};
+}
+
+template <typename T, typename R>
+void checkOp(Op op, typename T::storage_type a, typename T::storage_type b) {
+  using TR = WithRounding<T, R>;
+  const Ref want = refOp<TR, R>(op, value<T>(a), value<T>(b));
+  const auto got = runOp<TR>(op, a, b);
+  if (got.bits != word<T>(want.v) || got.flags != want.flags) {
+    MESSAGE("op " << int(op) << ": " << std::uint64_t(a) << ", "
+                  << std::uint64_t(b));
+    CHECK(std::uint64_t(got.bits) == std::uint64_t(word<T>(want.v)));
+    CHECK(int(got.flags) == int(want.flags));
+  }
+}
+
+template <typename T> std::vector<typename T::storage_type> samples(int n) {
+  std::mt19937_64 rng(0x51515 + wordBits<T>());
+  std::vector<typename T::storage_type> v;
+  // The edges, then random words with random runs of leading bits.
+  for (i128 e : {wordMin<T>(), wordMin<T>() + 1, i128(-1), i128(0), i128(1),
+                 wordMax<T>() - 1, wordMax<T>()})
+    if (e >= wordMin<T>())
+      v.push_back(word<T>(e));
+  for (int i = 0; i < n; ++i)
+    v.push_back(word<T>(i128(rng() >> (rng() % 64))));
+  return v;
+}
+
+template <typename T> void checkSampled(int n) {
+  const auto s = samples<T>(n);
+  for (Op op : {Op::Add, Op::Sub, Op::Mul, Op::Div})
+    forEachRounding([&](auto r) {
+      using R = decltype(r);
+      for (std::size_t i = 0; i < s.size(); ++i)
+        for (std::size_t j = i % 7; j < s.size(); j += 7)
+          checkOp<T, R>(op, s[i], s[j]);
+    });
+}
+
+} // namespace
+
+// -----------------------------------------------------------------
+// 1. Codec
+// -----------------------------------------------------------------
+static_assert(std::is_same_v<q15::storage_type, bits_t<16>>);
+static_assert(std::is_same_v<q31::storage_type, bits_t<32>>);
+static_assert(q15_16::layout::total_bits == 32);
+static_assert(UFixedPointType<8, 8>::layout::total_bits == 16);
+static_assert(exact_conversion<q15, float32>);
+static_assert(exact_conversion<q7, q15>);
+static_assert(exact_conversion<UFixedPointType<8, 8>, FixedPointType<8, 8>>);
+static_assert(!exact_conversion<q15, q7>);
+static_assert(!exact_conversion<q15, UFixedPointType<8, 8>>);
+static_assert(!exact_conversion<float16, q15>);
+static_assert(!exact_conversion<q31, float32>);
+
+TEST_CASE("fixed point: words and the codec") {
+  CHECK(toDouble<q15>(0x4000) == 0.5);
+  CHECK(toDouble<q15>(0x8000) == -1.0);
+  CHECK(toDouble<q15>(0x7FFF) == 32767.0 / 32768);
+  CHECK(toDouble<q15>(0xFFFF) == -1.0 / 32768);
+  CHECK(toDouble<q15_16>(0xFFFE8000) == -1.5);
+  CHECK(toDouble<q31>(0x80000000) == -1.0);
+  CHECK(toDouble<UFixedPointType<8, 8>>(0xFF80) == 255.5);
+  CHECK(std::uint16_t(fromNative<q15>(0.25)) == 0x2000);
+
+  // Every Q7 and UQ4.4 word unpacks and packs back to itself.
+  for (unsigned w = 0; w < 256; ++w) {
+    CHECK(pack<q7>(unpack<q7>(std::uint8_t(w))) == w);
+    using UQ = UFixedPointType<4, 4>;
+    CHECK(pack<UQ>(unpack<UQ>(std::uint8_t(w))) == w);
+  }
+  const auto z = unpack<q15>(0);
+  CHECK(z.category == ValueCategory::Zero);
+  CHECK(isSignMinus<q15>(0x8000));
+  CHECK_FALSE(isSignMinus<UFixedPointType<8, 8>>(0x8000));
+  CHECK(isNormal<q15>(1));
+  CHECK_FALSE(isSubnormal<q15>(1));
+}
+
+// -----------------------------------------------------------------
+// 2. Arithmetic
+// -----------------------------------------------------------------
+TEST_CASE("fixed point: exhaustive Q7 arithmetic") {
+  using QW = FixedPointType<0, 7, OverflowMode::Wrap>;
+  using UQ = UFixedPointType<4, 4>;
+  for (Op op : {Op::Add, Op::Sub, Op::Mul, Op::Div})
+    forEachRounding([&](auto r) {
+      using R = decltype(r);
+      for (unsigned a = 0; a < 256; ++a)
+        for (unsigned b = 0; b < 256; ++b) {
+          checkOp<q7, R>(op, std::uint8_t(a), std::uint8_t(b));
+          checkOp<QW, R>(op, std::uint8_t(a), std::uint8_t(b));
+          checkOp<UQ, R>(op, std::uint8_t(a), std::uint8_t(b));
+        }
+    });
+}
+
+TEST_CASE("fixed point: sampled wider words") {
+  checkSampled<q15>(300);
+  checkSampled<FixedPointType<0, 15, OverflowMode::Wrap>>(300);
+  checkSampled<q31>(300);
+  checkSampled<q15_16>(300);
+  checkSampled<FixedPointType<0, 63>>(300);
+  checkSampled<FixedPointType<20, 43, OverflowMode::Wrap>>(300);
+  checkSampled<UFixedPointType<8, 8>>(300);
+  checkSampled<UFixedPointType<8, 24, OverflowMode::Wrap>>(300);
+}
+
+TEST_CASE("fixed point: the DSP vectors") {
+  using S = Status<q15>;
+  // 0.5 × 0.5, and −1 × −1 saturating (the one Q15 product that
+  // does not fit).
+  CHECK(mul<S>(0x4000, 0x4000).bits == 0x2000);
+  const auto sq = mul<S>(0x8000, 0x8000);
+  CHECK(sq.bits == 0x7FFF);
+  CHECK(sq.flags == (FlagOverflow | FlagInexact));
+  using SW = Status<FixedPointType<0, 15, OverflowMode::Wrap>>;
+  CHECK(mul<SW>(0x8000, 0x8000).bits == 0x8000);
+  CHECK(add<SW>(0x7000, 0x7000).bits == 0xE000);
+  CHECK(add<S>(0x7000, 0x7000).bits == 0x7FFF);
+  CHECK(sub<S>(0x8000, 0x0001).bits == 0x8000);
+  // Truncating Q15 products are the arithmetic shift.
+  using ST = Status<WithRounding<q15, rounding::TowardNegative>>;
+  CHECK(mul<ST>(0xFFFF, 0x0001).bits == 0xFFFF);
+  CHECK(mul<S>(0xFFFF, 0x0001).bits == 0x0000);
+  CHECK(mul<S>(0xFFFF, 0x0001).flags == (FlagInexact | FlagUnderflow));
+  const auto q = div<S>(0x1000, 0);
+  CHECK(q.bits == 0x7FFF);
+  CHECK(q.flags == FlagDivByZero);
+  CHECK(div<S>(0, 0).flags == FlagInvalid);
+}
+
+TEST_CASE("fixed point: fma and sqrt round once and saturate") {
+  using S = Status<q15>;
+  CHECK(sqrt<S>(0x4000).bits == 0x5A82); // √0.5
+  CHECK(sqrt<S>(0x8000).flags == FlagInvalid);
+  // 0.75·0.75 + 0.5 = 1.0625: above the range in either mode.
+  const auto f = fma<S>(0x6000, 0x6000, 0x4000);
+  CHECK(f.bits == 0x7FFF);
+  CHECK(f.flags == (FlagOverflow | FlagInexact));
+  CHECK(fma<S>(0x0001, 0x0001, 0x4000).bits == 0x4000);
+  CHECK(fma<S>(0x0001, 0x0001, 0x4000).flags == FlagInexact);
+}
+
+// -----------------------------------------------------------------
+// 3. Conversions
+// -----------------------------------------------------------------
+namespace {
+
+// A finite double x into T: x · 2^F, exact in long double for the
+// sources used here, rounded by the integer rule and clamped.
+template <typename T, typename R> Ref refFromDouble(double x) {
+  constexpr int F = T::number::fraction_digits;
+  const long double s = std::ldexp((long double)x, F);
+  if (std::fabs(s) >= 0x1p60L)
+    return {s < 0 ? wordMin<T>() : wordMax<T>(), FlagOverflow | FlagInexact};
+  // s as n / 2^64 with n integral. Sources with more fraction bits
+  // below the ulp are all far below half of it, and round as any
+  // such value does.
+  const long double t =
+      s != 0 && std::fabs(s) < 0x1p-60L ? std::copysign(0x1p-60L, s) : s;
+  const long double n = std::ldexp(t, 64);
+  return fromRatio<T, R>(i128(n), i128(1) << 64, /*saturate=*/true);
+}
+
+template <typename T, typename Src, typename R> void checkFrom(unsigned w) {
+  using TR = Status<WithRounding<T, R>>;
+  const auto src = typename Src::storage_type(w);
+  const auto got = convert<TR, Src>(src);
+  if (isNan<Src>(src)) {
+    CHECK(got.bits == 0);
+    CHECK(got.flags == FlagInvalid);
+    return;
+  }
+  const double x = toDouble<Src>(src);
+  const Ref want = std::isinf(x)
+                       ? Ref{x < 0 ? wordMin<T>() : wordMax<T>(),
+                             flags_t(FlagOverflow | FlagInexact)}
+                       : refFromDouble<T, R>(x);
+  if (got.bits != word<T>(want.v) || got.flags != want.flags) {
+    MESSAGE("source word " << w);
+    CHECK(std::uint64_t(got.bits) == std::uint64_t(word<T>(want.v)));
+    CHECK(int(got.flags) == int(want.flags));
+  }
+}
+
+} // namespace
+
+TEST_CASE("fixed point: Q15 from every float16 and bfloat16") {
+  forEachRounding([](auto r) {
+    using R = decltype(r);
+    for (unsigned w = 0; w < 0x10000; ++w) {
+      checkFrom<q15, float16, R>(w);
+      checkFrom<q15, bfloat16, R>(w);
+      checkFrom<q7, float16, R>(w);
+    }
+  });
+}
+
+TEST_CASE("fixed point: Q15 and Q31 from sampled float32 and float64") {
+  std::mt19937_64 rng(1515);
+  forEachRounding([&](auto r) {
+    using R = decltype(r);
+    for (int i = 0; i < 20000; ++i) {
+      // Exponents around the words' ranges, from the ulp's down.
+      const float f = std::ldexp(float(rng() % (1 << 24)) * (rng() & 1 ? -1 : 1),
+                                 int(rng() % 48) - 64);
+      checkFrom<q15, float32, R>(std::bit_cast<std::uint32_t>(f));
+      checkFrom<q31, float32, R>(std::bit_cast<std::uint32_t>(f));
+      checkFrom<q15_16, float32, R>(std::bit_cast<std::uint32_t>(f));
+    }
+  });
+  using S = Status<q15>;
+  CHECK(convert<S, float32>(0x7FC00000).flags == FlagInvalid); // NaN
+  CHECK(convert<S, float32>(0xFF800000).bits == 0x8000);       // −Inf
+}
+
+TEST_CASE("fixed point: Q15 into floats") {
+  // Exactly into float32; into float16 and bfloat16 as a float64 of
+  // the same value rounds.
+  for (unsigned w = 0; w < 0x10000; ++w) {
+    const double x = value<q15>(std::uint16_t(w)) / 32768.0;
+    CHECK(toDouble<q15>(std::uint16_t(w)) == x);
+    CHECK(std::bit_cast<float>(std::uint32_t(
+              convert<float32, q15>(std::uint16_t(w)))) == float(x));
+    const std::uint64_t d = std::bit_cast<std::uint64_t>(x);
+    CHECK(convert<float16, q15>(std::uint16_t(w)) ==
+          convert<float16, float64>(d));
+    CHECK(convert<bfloat16, q15>(std::uint16_t(w)) ==
+          convert<bfloat16, float64>(d));
+  }
+}
+
+TEST_CASE("fixed point: between fixed Types and with decimal") {
+  // Q7 → Q15 is exact; Q15 → Q7 rounds by the integer rule.
+  for (unsigned w = 0; w < 256; ++w)
+    CHECK(convert<q15, q7>(std::uint8_t(w)) == std::uint16_t(w << 8));
+  forEachRounding([](auto r) {
+    using R = decltype(r);
+    using S = Status<WithRounding<q7, R>>;
+    for (unsigned w = 0; w < 0x10000; ++w) {
+      const Ref want = fromRatio<q7, R>(value<q15>(std::uint16_t(w)), 256);
+      const auto got = convert<S, q15>(std::uint16_t(w));
+      CHECK(got.bits == word<q7>(want.v));
+      CHECK(got.flags == want.flags);
+    }
+  });
+  // A signed word into an unsigned one saturates at 0.
+  using SU = Status<UFixedPointType<8, 8>>;
+  CHECK(convert<SU, q15>(0x8000).bits == 0);
+  CHECK(convert<SU, q15>(0x8000).flags == (FlagOverflow | FlagInexact));
+
+  using S = Status<q15>;
+  for (unsigned w : {0x0000u, 0x0001u, 0x4000u, 0x8000u, 0x7FFFu, 0xC001u}) {
+    const auto d = convert<decimal64, q15>(std::uint16_t(w));
+    const auto back = convert<S, decimal64>(d);
+    CHECK(back.bits == w);
+    CHECK(back.flags == FlagNone);
+  }
+  CHECK(std::uint16_t(fromString<q15>("0.5")) == 0x4000);
+  CHECK(std::uint16_t(fromString<q15>("-1")) == 0x8000);
+  CHECK(toString<q15>(0xC000, 6) == "-0.5");
+}
+
+// -----------------------------------------------------------------
+// 4. Ordering
+// -----------------------------------------------------------------
+TEST_CASE("fixed point: ordering, neighbours and sign") {
+  using UQ = UFixedPointType<4, 4>;
+  for (unsigned a = 0; a < 256; ++a) {
+    const i128 x = value<q7>(std::uint8_t(a));
+    for (unsigned b = 0; b < 256; ++b) {
+      const i128 y = value<q7>(std::uint8_t(b));
+      CHECK(lt<q7>(std::uint8_t(a), std::uint8_t(b)) == (x < y));
+      CHECK(lt<UQ>(std::uint8_t(a), std::uint8_t(b)) == (a < b));
+    }
+    CHECK(nextUp<q7>(std::uint8_t(a)) == word<q7>(x == 127 ? x : x + 1));
+    CHECK(nextDown<q7>(std::uint8_t(a)) == word<q7>(x == -128 ? x : x - 1));
+    CHECK(nextUp<UQ>(std::uint8_t(a)) == (a == 255 ? a : a + 1));
+    CHECK(nextDown<UQ>(std::uint8_t(a)) == (a == 0 ? a : a - 1));
+    CHECK(neg<q7>(std::uint8_t(a)) == word<q7>(x == -128 ? x : -x));
+  }
+}
+
+// -----------------------------------------------------------------
+// 5. Batch
+// -----------------------------------------------------------------
+TEST_CASE("fixed point: batch kernels match the scalar operations") {
+  const auto s = samples<q15>(1200);
+  std::vector<std::uint16_t> a(s.begin(), s.end()), b(a.rbegin(), a.rend());
+  const std::size_t n = a.size();
+  std::vector<std::uint16_t> out(n), want(n);
+  std::vector<flags_t> flags(n), want_flags(n);
+
+  auto check = [&](auto many, auto scalar) {
+    many(std::span<const std::uint16_t>(a), std::span<const std::uint16_t>(b),
+         std::span<std::uint16_t>(out), std::span<flags_t>(flags));
+    for (std::size_t i = 0; i < n; ++i) {
+      const auto r = scalar(a[i], b[i]);
+      want[i] = r.bits;
+      want_flags[i] = r.flags;
+    }
+    CHECK(out == want);
+    CHECK(flags == want_flags);
+
+    // The same run into a short FlagList.
+    std::vector<std::size_t> index(5);
+    FlagList list{index, FlagOverflow | FlagUnderflow};
+    many(std::span<const std::uint16_t>(a), std::span<const std::uint16_t>(b),
+         std::span<std::uint16_t>(out), list);
+    std::vector<std::size_t> hits;
+    for (std::size_t i = 0; i < n; ++i)
+      if ((want_flags[i] & list.mask) != 0)
+        hits.push_back(i);
+    CHECK(list.count == hits.size());
+    CHECK(list.any == anyFlags(want_flags));
+    for (std::size_t k = 0; k < index.size() && k < hits.size(); ++k)
+      CHECK(index[k] == hits[k]);
+  };
+  using S = Status<q15>;
+  check([](auto &&...x) { return addMany<q15>(x...); },
+        [](auto x, auto y) { return add<S>(x, y); });
+  check([](auto &&...x) { return subMany<q15>(x...); },
+        [](auto x, auto y) { return sub<S>(x, y); });
+  check([](auto &&...x) { return mulMany<q15>(x...); },
+        [](auto x, auto y) { return mul<S>(x, y); });
+  check([](auto &&...x) { return divMany<q15>(x...); },
+        [](auto x, auto y) { return div<S>(x, y); });
+  using QW = FixedPointType<0, 15, OverflowMode::Wrap>;
+  check([](auto &&...x) { return mulMany<QW>(x...); },
+        [](auto x, auto y) { return mul<Status<QW>>(x, y); });
+
+  // A short flag array keeps what fits, and status flags take the
+  // OR of the whole call.
+  mulMany<q15>(std::span<const std::uint16_t>(a),
+               std::span<const std::uint16_t>(b),
+               std::span<std::uint16_t>(out), std::span<flags_t>(flags));
+  std::vector<flags_t> few(3);
+  using QS = WithExceptions<q15, exceptions::StatusFlags>;
+  clearStatusFlags();
+  CHECK(mulMany<QS>(std::span<const std::uint16_t>(a),
+                    std::span<const std::uint16_t>(b),
+                    std::span<std::uint16_t>(out),
+                    std::span<flags_t>(few)) == n);
+  CHECK(statusFlags() == anyFlags(flags));
+  CHECK(few == std::vector<flags_t>(flags.begin(), flags.begin() + 3));
+  clearStatusFlags();
+}
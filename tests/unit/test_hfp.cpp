@@ -0,0 +1,511 @@
+// IBM hexadecimal floating point Types.
+//
+// The reference is independent of the library's codec and pipeline:
+// words decode to long double by their definition, 0.F × 16^(C − 64),
+// and the HFP rounding rule is stated on hex digits — an integer n
+// times a power of 16 loses digits off the bottom until F remain,
+// then truncates (or rounds to nearest, ties to even), with
+// saturation above 0.FF…F × 16^63 and the true zero below
+// 0.1 × 16^−64. Sums align as the architecture defines, one guard
+// digit kept; products and quotients are exact integers before the
+// rule. Binary results are the host's own conversions under fenv.
+//
+//   1. Codec: published encodings, unnormalized words, the extended
+//      format's low-half fields, pack∘unpack.
+//   2. Arithmetic: sampled hfp32/hfp64 add/sub/mul/div, truncating
+//      and to nearest, against the digit rule; the guard-digit cases.
+//   3. Conversions: HFP ↔ float32/float64 in four modes against the
+//      host, binary → HFP against the digit rule, the one-word fast
+//      path against convertRounded in every mode, convertMany.
+//   4. Ordering: compare, nextUp/nextDown, exact_conversion.
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <doctest/doctest.h>
+
+#include <bit>
+#include <cfenv>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <random>
+#include <span>
+#include <vector>
+
+#include "opine/opine.hpp"
+
+using namespace opine;
+
+namespace {
+
+using u128 = unsigned __int128;
+
+template <typename T> using Status = WithExceptions<T, exceptions::ReturnStatus>;
+
+template <int F> constexpr std::uint64_t fractionMask() {
+  return (std::uint64_t{1} << (4 * F)) - 1;
+}
+
+// 0.F × 16^(C − 64), exactly (56 fraction bits fit long double's 64).
+template <int F> long double refDecode(std::uint64_t w) {
+  const long double v = std::ldexp(
+      (long double)(w & fractionMask<F>()),
+      4 * (int((w >> (4 * F)) & 0x7F) - 64) - 4 * F);
+  return (w >> (4 * F + 7)) & 1 ? -v : v;
+}
+
+struct Ref {
+  std::uint64_t word;
+  flags_t flags;
+};
+
+// The HFP word for (n + sticky·ε) · 16^e, per the digit rule.
+template <int F>
+Ref refRound(bool sign, u128 n, int e, bool sticky, bool nearest) {
+  const u128 top = u128(1) << (4 * F);
+  while (n < (top >> 4)) {
+    n <<= 4;
+    --e;
+  }
+  unsigned last = 0;
+  bool dropped = false;
+  while (n >= top) {
+    if (dropped)
+      sticky = sticky || last != 0;
+    last = unsigned(n & 15);
+    dropped = true;
+    n >>= 4;
+    ++e;
+  }
+  flags_t flags = (last != 0 || sticky) ? FlagInexact : FlagNone;
+  if (nearest && (last & 8) && ((last & 7) || sticky || (n & 1))) {
+    if (++n == top) {
+      n >>= 4;
+      ++e;
+    }
+  }
+  const int c = e + F + 64;
+  const std::uint64_t s = std::uint64_t(sign) << (4 * F + 7);
+  if (c > 127)
+    return {s | (std::uint64_t{127} << (4 * F)) | fractionMask<F>(),
+            flags_t(FlagOverflow | FlagInexact)};
+  if (c < 0)
+    return {0, flags_t(FlagUnderflow | FlagInexact)};
+  return {s | (std::uint64_t(c) << (4 * F)) | std::uint64_t(n), flags};
+}
+
+struct Hex {
+  bool sign;
+  int c;
+  std::uint64_t f;
+};
+template <int F> Hex fields(std::uint64_t w) {
+  return {((w >> (4 * F + 7)) & 1) != 0, int((w >> (4 * F)) & 0x7F),
+          w & fractionMask<F>()};
+}
+
+// Normalized operands only: the architecture's add aligns the raw
+// fraction, the library its normalized value.
+template <int F> Ref refAdd(std::uint64_t a, std::uint64_t b, bool nearest) {
+  Hex x = fields<F>(a), y = fields<F>(b);
+  if (x.f == 0 && y.f == 0)
+    return {0, FlagNone};
+  if (x.f == 0)
+    x = {y.sign, y.c, 0};
+  if (y.f == 0)
+    y = {x.sign, x.c, 0};
+  if (x.c < y.c || (x.c == y.c && x.f < y.f))
+    std::swap(x, y);
+  const int d = x.c - y.c;
+  const u128 A = u128(x.f) << 4, B = u128(y.f) << 4;
+  const u128 Bs = d > F + 1 ? 0 : B >> (4 * d);
+  const bool lost = (Bs << (4 * d)) != B || (d > F + 1 && B != 0);
+  const u128 sum = x.sign == y.sign ? A + Bs : A - Bs;
+  if (sum == 0)
+    return {0, FlagNone};
+  Ref r = refRound<F>(x.sign, sum, x.c - 64 - F - 1, false, nearest);
+  if (lost)
+    r.flags |= FlagInexact;
+  return r;
+}
+
+template <int F> Ref refMul(std::uint64_t a, std::uint64_t b, bool nearest) {
+  const Hex x = fields<F>(a), y = fields<F>(b);
+  const bool sign = x.sign != y.sign;
+  if (x.f == 0 || y.f == 0)
+    return {std::uint64_t(sign) << (4 * F + 7), FlagNone};
+  return refRound<F>(sign, u128(x.f) * y.f, x.c + y.c - 128 - 2 * F, false,
+                     nearest);
+}
+
+template <int F> Ref refDiv(std::uint64_t a, std::uint64_t b, bool nearest) {
+  const Hex x = fields<F>(a), y = fields<F>(b);
+  const bool sign = x.sign != y.sign;
+  if (x.f == 0)
+    return {std::uint64_t(sign) << (4 * F + 7), FlagNone};
+  constexpr int K = F + 2;
+  const u128 num = u128(x.f) << (4 * K);
+  return refRound<F>(sign, num / y.f, x.c - y.c - K, num % y.f != 0, nearest);
+}
+
+// A binary64 value as n · 16^e.
+template <int F> Ref refFromDouble(double v, bool nearest) {
+  const std::uint64_t b = std::bit_cast<std::uint64_t>(v);
+  const bool sign = b >> 63;
+  const int be = int((b >> 52) & 0x7FF);
+  std::uint64_t m = b & ((std::uint64_t{1} << 52) - 1);
+  if (be == 0 && m == 0)
+    return {std::uint64_t(sign) << (4 * F + 7), FlagNone};
+  int k = be == 0 ? -1074 : be - 1075;
+  if (be != 0)
+    m |= std::uint64_t{1} << 52;
+  const int e = k >= 0 ? k / 4 : -((-k + 3) / 4);
+  return refRound<F>(sign, u128(m) << (k - 4 * e), e, false, nearest);
+}
+
+// A normalized word: random fraction with a nonzero lead digit,
+// characteristic spread over [lo, hi].
+template <int F>
+std::uint64_t randomHex(std::mt19937_64 &rng, int lo = 0, int hi = 127) {
+  std::uint64_t f = rng() & fractionMask<F>();
+  if ((f >> (4 * F - 4)) == 0)
+    f |= std::uint64_t(1 + rng() % 15) << (4 * F - 4);
+  const std::uint64_t c = std::uint64_t(lo + int(rng() % unsigned(hi - lo + 1)));
+  return (std::uint64_t(rng() & 1) << (4 * F + 7)) | (c << (4 * F)) | f;
+}
+
+flags_t hostFlags() {
+  flags_t f = FlagNone;
+  if (std::fetestexcept(FE_INEXACT))
+    f |= FlagInexact;
+  if (std::fetestexcept(FE_OVERFLOW))
+    f |= FlagOverflow;
+  if (std::fetestexcept(FE_UNDERFLOW))
+    f |= FlagUnderflow;
+  return f;
+}
+
+template <typename R> int hostMode() {
+  if constexpr (std::is_same_v<R, rounding::TowardZero>)
+    return FE_TOWARDZERO;
+  else if constexpr (std::is_same_v<R, rounding::TowardPositive>)
+    return FE_UPWARD;
+  else if constexpr (std::is_same_v<R, rounding::TowardNegative>)
+    return FE_DOWNWARD;
+  else
+    return FE_TONEAREST;
+}
+
+// HFP → binary under R, against the host's long double → double /
+// float conversion in R's mode.
+template <typename H, typename B, typename R, typename Native>
+void checkToBinary(std::span<const std::uint64_t> words) {
+  using D = Status<WithRounding<B, R>>;
+  constexpr int F = H::number::fraction_digits;
+  int bad = 0;
+  for (std::uint64_t w : words) {
+    volatile long double v = refDecode<F>(w);
+    std::feclearexcept(FE_ALL_EXCEPT);
+    std::fesetround(hostMode<R>());
+    volatile Native n = Native(v);
+    const flags_t hf = hostFlags();
+    std::fesetround(FE_TONEAREST);
+    const auto r = convert<D, H>(typename H::storage_type(w));
+    const auto want = std::bit_cast<typename D::storage_type>(Native(n));
+    if ((r.bits != want || r.flags != hf) && ++bad <= 5)
+      std::printf("to binary %016llx: got %llx/%02x want %llx/%02x\n",
+                  (unsigned long long)w, (unsigned long long)r.bits, r.flags,
+                  (unsigned long long)want, hf);
+  }
+  CHECK(bad == 0);
+}
+
+// The one-word converter against the generic kernel, bits and flags.
+template <typename Dst, typename Src>
+void checkFastPath(std::span<const std::uint64_t> words) {
+  using D = Status<Dst>;
+  int bad = 0;
+  for (std::uint64_t w : words) {
+    const auto x = typename Src::storage_type(w);
+    const auto fast = convert<D, Src>(x);
+    const auto slow = detail::convertRounded<D, Src>(x);
+    if ((fast.bits != slow.bits || fast.flags != slow.flags) && ++bad <= 5)
+      std::printf("fast path %016llx: %llx/%02x vs %llx/%02x\n",
+                  (unsigned long long)w, (unsigned long long)fast.bits,
+                  fast.flags, (unsigned long long)slow.bits, slow.flags);
+  }
+  CHECK(bad == 0);
+}
+
+template <typename Dst, typename Src>
+void checkFastPathAllModes(std::span<const std::uint64_t> words) {
+  checkFastPath<Dst, Src>(words);
+  checkFastPath<WithRounding<Dst, rounding::ToNearestTiesToEven>, Src>(words);
+  checkFastPath<WithRounding<Dst, rounding::ToNearestTiesAway>, Src>(words);
+  checkFastPath<WithRounding<Dst, rounding::TowardZero>, Src>(words);
+  checkFastPath<WithRounding<Dst, rounding::TowardPositive>, Src>(words);
+  checkFastPath<WithRounding<Dst, rounding::TowardNegative>, Src>(words);
+  checkFastPath<WithRounding<Dst, rounding::ToOdd>, Src>(words);
+}
+
+// Random words plus every characteristic at the fraction extremes,
+// unnormalized and zero fractions included.
+template <int F> std::vector<std::uint64_t> hexSamples(int n) {
+  std::mt19937_64 rng(F * 7919);
+  std::vector<std::uint64_t> v;
+  for (int i = 0; i < n; ++i)
+    v.push_back(F == 14 ? rng() : rng() & ((std::uint64_t{1} << (4 * F + 8)) - 1));
+  for (std::uint64_t c = 0; c < 128; ++c)
+    for (std::uint64_t f : {std::uint64_t{0}, std::uint64_t{1},
+                            std::uint64_t{1} << (4 * F - 4),
+                            std::uint64_t{1} << (4 * F - 1),
+                            fractionMask<F>(), fractionMask<F>() >> 3})
+      for (std::uint64_t s : {0, 1})
+        v.push_back((s << (4 * F + 7)) | (c << (4 * F)) | f);
+  return v;
+}
+
+template <int E, int M> std::vector<std::uint64_t> binarySamples(int n) {
+  constexpr int W = 1 + E + M;
+  std::mt19937_64 rng(W * 104729);
+  std::vector<std::uint64_t> v;
+  for (int i = 0; i < n; ++i)
+    v.push_back(W == 64 ? rng() : rng() & ((std::uint64_t{1} << W) - 1));
+  for (std::uint64_t e = 0; e < (std::uint64_t{1} << E); ++e)
+    for (std::uint64_t m : {std::uint64_t{0}, std::uint64_t{1},
+                            (std::uint64_t{1} << M) - 1,
+                            std::uint64_t{7} << (M - 3)})
+      for (std::uint64_t s : {0, 1})
+        v.push_back((s << (E + M)) | (e << M) | m);
+  return v;
+}
+
+} // namespace
+
+TEST_CASE("hfp: published encodings and the codec") {
+  CHECK(fromNative<hfp32>(1.0) == 0x41100000u);
+  CHECK(fromNative<hfp32>(-118.625) == 0xC276A000u);
+  CHECK(fromNative<hfp32>(0.1) == 0x40199999u); // truncated
+  CHECK(fromNative<WithRounding<hfp32, rounding::ToNearestTiesToEven>>(0.1) ==
+        0x4019999Au);
+  CHECK(fromNative<hfp64>(0.1) == 0x401999999999999Aull); // every binary64 fits
+  CHECK(fromNative<hfp64>(3.141592653589793) == 0x413243F6A8885A30ull);
+  CHECK(toDouble<hfp32>(0x7FFFFFFFu) == std::ldexp(1.0 - std::ldexp(1.0, -24), 252));
+  CHECK(toDouble<hfp32>(0x00100000u) == std::ldexp(1.0, -260));
+
+  // Unnormalized words decode to their value and repack normalized;
+  // a zero fraction is zero at any characteristic, keeping its sign.
+  CHECK(toDouble<hfp32>(0x42010000u) == 1.0);
+  CHECK(pack<hfp32>(unpack<hfp32>(0x42010000u)) == 0x41100000u);
+  CHECK(toDouble<hfp32>(0x00000001u) == std::ldexp(1.0, -280));
+  CHECK(pack<hfp32>(unpack<hfp32>(0x00000001u)) == 0x00000001u);
+  CHECK(isZero<hfp32>(0x45000000u));
+  CHECK(isSignMinus<hfp32>(0x80000000u));
+
+  // Extended: the low half carries the sign and characteristic − 14.
+  const auto third = div<hfp128>(fromNative<hfp128>(1.0), fromNative<hfp128>(3.0));
+  CHECK(std::uint64_t(third >> 64) == 0x4055555555555555ull);
+  CHECK(std::uint64_t(third) == 0x3255555555555555ull);
+  const auto neg = fromNative<hfp128>(-0x1p-250);
+  CHECK(std::uint64_t(neg >> 64) == 0x8240000000000000ull);
+  CHECK(std::uint64_t(neg) == 0xF400000000000000ull);
+  CHECK(toDouble<hfp128>(hfp128::storage_type(0x4110000000000000ull) << 64 |
+                         0x7F00000000000001ull) == 1.0);
+
+  // pack∘unpack is the identity on canonical words.
+  std::mt19937_64 rng(1);
+  for (int i = 0; i < 100000; ++i) {
+    const auto w32 = std::uint32_t(randomHex<6>(rng));
+    const auto w64 = randomHex<14>(rng);
+    CHECK(pack<hfp32>(unpack<hfp32>(w32)) == w32);
+    CHECK(pack<hfp64>(unpack<hfp64>(w64)) == w64);
+    const auto w128 = convert<hfp128, hfp64>(w64);
+    CHECK(pack<hfp128>(unpack<hfp128>(w128)) == w128);
+    CHECK(convert<hfp64, hfp128>(w128) == w64);
+  }
+}
+
+TEST_CASE("hfp: the guard digit") {
+  // 1 − 16^−6 borrows through the guard digit and is exact;
+  // 16^−7 lies below the guard digit and is lost, so 1 − 16^−7
+  // truncates back to 1 (binary arithmetic would give 0x40FFFFFF).
+  CHECK(sub<hfp32>(0x41100000u, 0x3B100000u) == 0x40FFFFFFu);
+  CHECK(sub<hfp32>(0x41100000u, 0x3A100000u) == 0x41100000u);
+  CHECK(sub<Status<hfp32>>(0x41100000u, 0x3A100000u).flags == FlagInexact);
+  CHECK(add<hfp32>(0x40FFFFFFu, 0x3AF00000u) == 0x40FFFFFFu);
+  CHECK(add<hfp32>(0x41100000u, 0x41100000u) == 0x41200000u);
+  CHECK(sub<hfp32>(0x41100000u, 0x41100000u) == 0x00000000u);
+  CHECK(mul<hfp32>(fromNative<hfp32>(3.0), fromNative<hfp32>(7.0)) ==
+        0x42150000u);
+  CHECK(sqrt<hfp32>(fromNative<hfp32>(2.0)) == 0x4116A09Eu);
+}
+
+template <int F, typename T>
+void checkArithmetic(bool nearest, int lo, int hi, int n) {
+  using S = Status<T>;
+  std::mt19937_64 rng(F * 31 + nearest);
+  int bad = 0;
+  auto report = [&](const char *op, std::uint64_t a, std::uint64_t b,
+                    auto got, Ref want) {
+    if ((std::uint64_t(got.bits) != want.word || got.flags != want.flags) &&
+        ++bad <= 5)
+      std::printf("%s %016llx %016llx: got %016llx/%02x want %016llx/%02x\n",
+                  op, (unsigned long long)a, (unsigned long long)b,
+                  (unsigned long long)got.bits, got.flags,
+                  (unsigned long long)want.word, want.flags);
+  };
+  using W = typename T::storage_type;
+  for (int i = 0; i < n; ++i) {
+    const std::uint64_t a = randomHex<F>(rng, lo, hi);
+    std::uint64_t b = randomHex<F>(rng, lo, hi);
+    // Close exponents exercise alignment and cancellation.
+    if (i & 1)
+      b = (b & ~(std::uint64_t{0x7F} << (4 * F))) |
+          (((a >> (4 * F)) & 0x7F) << (4 * F));
+    report("add", a, b, add<S>(W(a), W(b)), refAdd<F>(a, b, nearest));
+    report("sub", a, b, sub<S>(W(a), W(b)),
+           refAdd<F>(a, b ^ (std::uint64_t{1} << (4 * F + 7)), nearest));
+    report("mul", a, b, mul<S>(W(a), W(b)), refMul<F>(a, b, nearest));
+    report("div", a, b, div<S>(W(a), W(b)), refDiv<F>(a, b, nearest));
+  }
+  CHECK(bad == 0);
+}
+
+TEST_CASE("hfp: arithmetic against the digit rule") {
+  using N32 = WithRounding<hfp32, rounding::ToNearestTiesToEven>;
+  using N64 = WithRounding<hfp64, rounding::ToNearestTiesToEven>;
+  // Mid-range, then the full range for overflow and underflow.
+  checkArithmetic<6, hfp32>(false, 56, 72, 200000);
+  checkArithmetic<6, hfp32>(false, 0, 127, 200000);
+  checkArithmetic<6, N32>(true, 56, 72, 200000);
+  checkArithmetic<6, N32>(true, 0, 127, 200000);
+  checkArithmetic<14, hfp64>(false, 56, 72, 100000);
+  checkArithmetic<14, hfp64>(false, 0, 127, 100000);
+  checkArithmetic<14, N64>(true, 0, 127, 100000);
+
+  // Overflow saturates, as does division by zero; underflow is the
+  // true zero.
+  const auto o = mul<Status<hfp32>>(0x7F100000u, 0x42100000u);
+  CHECK(o.bits == 0x7FFFFFFFu);
+  CHECK(o.flags == (FlagOverflow | FlagInexact));
+  const auto u = mul<Status<hfp32>>(0x80100000u, 0x00100000u);
+  CHECK(u.bits == 0x00000000u);
+  CHECK(u.flags == (FlagUnderflow | FlagInexact));
+  const auto z = div<Status<hfp32>>(0x41100000u, 0x00000000u);
+  CHECK(z.bits == 0x7FFFFFFFu);
+  CHECK(z.flags == (FlagDivByZero | FlagInexact));
+}
+
+TEST_CASE("hfp: conversions with binary floats") {
+  const auto h32 = hexSamples<6>(100000);
+  const auto h64 = hexSamples<14>(100000);
+  using rounding::ToNearestTiesToEven, rounding::TowardZero,
+      rounding::TowardPositive, rounding::TowardNegative;
+
+  checkToBinary<hfp32, float32, ToNearestTiesToEven, float>(h32);
+  checkToBinary<hfp32, float32, TowardZero, float>(h32);
+  checkToBinary<hfp32, float32, TowardPositive, float>(h32);
+  checkToBinary<hfp32, float32, TowardNegative, float>(h32);
+  checkToBinary<hfp32, float64, ToNearestTiesToEven, double>(h32);
+  checkToBinary<hfp64, float32, ToNearestTiesToEven, float>(h64);
+  checkToBinary<hfp64, float32, TowardNegative, float>(h64);
+  checkToBinary<hfp64, float64, ToNearestTiesToEven, double>(h64);
+  checkToBinary<hfp64, float64, TowardZero, double>(h64);
+  checkToBinary<hfp64, float64, TowardPositive, double>(h64);
+
+  // Binary → HFP against the digit rule, truncating and to nearest.
+  const auto b64 = binarySamples<11, 52>(200000);
+  int bad = 0;
+  for (std::uint64_t w : b64) {
+    const double v = std::bit_cast<double>(w);
+    if (std::isnan(v) || std::isinf(v))
+      continue;
+    const auto t32 = convert<Status<hfp32>, float64>(w);
+    const auto n64 = convert<
+        Status<WithRounding<hfp64, rounding::ToNearestTiesToEven>>, float64>(w);
+    const Ref r32 = refFromDouble<6>(v, false), r64 = refFromDouble<14>(v, true);
+    if ((t32.bits != r32.word || t32.flags != r32.flags ||
+         n64.bits != r64.word || n64.flags != r64.flags) &&
+        ++bad <= 5)
+      std::printf("from binary %016llx\n", (unsigned long long)w);
+  }
+  CHECK(bad == 0);
+
+  // NaN has no HFP encoding; infinities saturate.
+  const auto qn = convert<Status<hfp32>, float32>(0x7FC00000u);
+  CHECK(qn.bits == 0u);
+  CHECK(qn.flags == FlagInvalid);
+  const auto ni = convert<Status<hfp32>, float32>(0xFF800000u);
+  CHECK(ni.bits == 0xFFFFFFFFu);
+  CHECK(ni.flags == (FlagOverflow | FlagInexact));
+  CHECK(convert<hfp32, float32>(0x80000000u) == 0x80000000u);
+}
+
+TEST_CASE("hfp: the one-word converters match convertRounded") {
+  const auto h32 = hexSamples<6>(20000);
+  const auto h64 = hexSamples<14>(20000);
+  const auto b16 = binarySamples<5, 10>(0);
+  const auto b32 = binarySamples<8, 23>(20000);
+  const auto b64 = binarySamples<11, 52>(20000);
+
+  checkFastPathAllModes<float32, hfp32>(h32);
+  checkFastPathAllModes<float64, hfp32>(h32);
+  checkFastPathAllModes<float16, hfp32>(h32);
+  checkFastPathAllModes<float32, hfp64>(h64);
+  checkFastPathAllModes<float64, hfp64>(h64);
+  checkFastPathAllModes<hfp32, float16>(b16);
+  checkFastPathAllModes<hfp32, float32>(b32);
+  checkFastPathAllModes<hfp64, float32>(b32);
+  checkFastPathAllModes<hfp32, float64>(b64);
+  checkFastPathAllModes<hfp64, float64>(b64);
+}
+
+TEST_CASE("hfp: convertMany as a migration pass") {
+  const auto h64 = hexSamples<14>(5000);
+  std::vector<std::uint32_t> f32(h64.size());
+  std::vector<std::size_t> index(h64.size());
+  FlagList report{index, FlagOverflow | FlagUnderflow};
+  const std::size_t n = convertMany<float32, hfp64>(h64, f32, report);
+  CHECK(n == h64.size());
+  std::size_t expected = 0;
+  flags_t any = FlagNone;
+  for (std::size_t i = 0; i < h64.size(); ++i) {
+    const auto s = convert<Status<float32>, hfp64>(h64[i]);
+    CHECK(f32[i] == s.bits);
+    any |= s.flags;
+    if (s.flags & (FlagOverflow | FlagUnderflow))
+      CHECK(index[expected++] == i);
+  }
+  CHECK(report.count == expected);
+  CHECK(report.any == any);
+  CHECK(expected > 0);
+}
+
+TEST_CASE("hfp: ordering and neighbours") {
+  CHECK(lt<hfp32>(0x40FFFFFFu, 0x41100000u));
+  CHECK(lt<hfp32>(0xC1100000u, 0x00000000u));
+  CHECK(eq<hfp32>(0x00000000u, 0x80000000u));
+  CHECK(eq<hfp32>(0x42010000u, 0x41100000u));
+
+  CHECK(nextUp<hfp32>(0x41100000u) == 0x41100001u);
+  CHECK(nextDown<hfp32>(0x41100000u) == 0x40FFFFFFu);
+  CHECK(nextUp<hfp32>(0x00000000u) == 0x00000001u);
+  CHECK(nextDown<hfp32>(0x00000000u) == 0x80000001u);
+  CHECK(nextUp<hfp32>(0x7FFFFFFFu) == 0x7FFFFFFFu);
+  CHECK(nextUp<hfp32>(0xC1100000u) == 0xC0FFFFFFu);
+  CHECK(nextUp<hfp32>(0x80000001u) == 0x80000000u);
+
+  // Walking up from the smallest magnitude visits every value in order.
+  std::uint32_t w = 0x00000001u;
+  for (int i = 0; i < 1 << 20; ++i) {
+    const std::uint32_t up = nextUp<hfp32>(w);
+    CHECK(lt<hfp32>(w, up));
+    CHECK(nextDown<hfp32>(up) == w);
+    w = up;
+  }
+
+  // Every float32 fits hfp64; hfp32's 24 fraction bits lose up to three.
+  static_assert(exact_conversion<float32, hfp64>);
+  static_assert(!exact_conversion<float32, hfp32>);
+  static_assert(exact_conversion<hfp32, float64>);
+  static_assert(!exact_conversion<float64, hfp64>);
+}
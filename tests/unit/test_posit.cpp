@@ -0,0 +1,346 @@
+// Posit Types and the quire.
+//
+// The reference is independent of the library's codec: a bit-loop
+// decoder (one regime bit at a time) to long double, and the posit
+// rounding rule stated on values — the nearest posit, with the tie
+// point between neighbours lo and lo+1 being the value of the
+// (N+1)-bit posit between them, ties to the even pattern, and
+// saturation at minpos / maxpos.
+//
+//   1. Codec: every posit16 pattern decodes as the bit loop does and
+//      round-trips through unpack/pack.
+//   2. Arithmetic: every posit8 pair (ES 0, 1, 2; ties-to-even and
+//      truncating) for add/sub/mul/div/lt, every pattern for sqrt
+//      and the widening conversion; posit16/32 sampled, fma and
+//      float32 → posit included.
+//   3. Specials and flags: NaR, x ÷ 0, ∞ → NaR, saturation.
+//   4. Quire: random posit8 dot products against an exact 128-bit
+//      fixed-point sum; cancellation across the full range at 32
+//      and 64 bits.
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <doctest/doctest.h>
+
+#include <bit>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <random>
+#include <span>
+#include <vector>
+
+#include "opine/opine.hpp"
+
+using namespace opine;
+
+namespace {
+
+template <int N> constexpr std::uint64_t wordMask() {
+  return N == 64 ? ~std::uint64_t{0} : (std::uint64_t{1} << N) - 1;
+}
+
+template <int N, int ES> long double refDecode(std::uint64_t x) {
+  x &= wordMask<N>();
+  if (x == 0)
+    return 0;
+  if (x == std::uint64_t{1} << (N - 1))
+    return NAN;
+  const bool neg = (x >> (N - 1)) != 0;
+  if (neg)
+    x = (~x + 1) & wordMask<N>();
+  int i = N - 2;
+  const int first = int((x >> i) & 1);
+  int run = 0;
+  while (i >= 0 && int((x >> i) & 1) == first) {
+    ++run;
+    --i;
+  }
+  --i; // the terminator
+  const int k = first ? run - 1 : -run;
+  int e = 0;
+  for (int j = 0; j < ES; ++j) {
+    e <<= 1;
+    if (i >= 0)
+      e |= int((x >> i--) & 1);
+  }
+  long double f = 1, w = 0.5;
+  for (; i >= 0; --i, w /= 2)
+    if ((x >> i) & 1)
+      f += w;
+  const long double v = std::ldexp(f, k * (1 << ES) + e);
+  return neg ? -v : v;
+}
+
+// The posit nearest to x (ties-to-even, or truncating).
+template <int N, int ES>
+std::uint64_t refRound(long double x, bool truncate = false) {
+  if (x == 0)
+    return 0;
+  if (std::isnan(x))
+    return std::uint64_t{1} << (N - 1);
+  const bool neg = x < 0;
+  if (neg)
+    x = -x;
+  const std::uint64_t maxpos = (std::uint64_t{1} << (N - 1)) - 1;
+  std::uint64_t r;
+  if (x >= refDecode<N, ES>(maxpos)) {
+    r = maxpos;
+  } else if (x <= refDecode<N, ES>(1)) {
+    r = 1;
+  } else {
+    std::uint64_t lo = 1, hi = maxpos;
+    while (lo < hi) {
+      const std::uint64_t mid = lo + (hi - lo + 1) / 2;
+      if (refDecode<N, ES>(mid) <= x)
+        lo = mid;
+      else
+        hi = mid - 1;
+    }
+    r = lo;
+    if (refDecode<N, ES>(lo) != x && !truncate) {
+      const long double tie = refDecode<N + 1, ES>((lo << 1) | 1);
+      if (x > tie || (x == tie && (lo & 1)))
+        r = lo + 1;
+    }
+  }
+  return neg ? (~r + 1) & wordMask<N>() : r;
+}
+
+int failures = 0;
+
+void check(const char *label, const char *op, std::uint64_t a,
+           std::uint64_t b, std::uint64_t got, std::uint64_t want) {
+  if (got == want)
+    return;
+  if (++failures <= 10)
+    std::fprintf(stderr, "  FAIL %s %s a=0x%llx b=0x%llx: 0x%llx, want 0x%llx\n",
+                 label, op, (unsigned long long)a, (unsigned long long)b,
+                 (unsigned long long)got, (unsigned long long)want);
+}
+
+template <typename T, int N, int ES>
+void verifyExhaustive(const char *label, bool truncate) {
+  using S = WithExceptions<T, exceptions::ReturnStatus>;
+  using St = typename T::storage_type;
+  using F64 = WithExceptions<float64, exceptions::ReturnStatus>;
+  constexpr std::uint64_t Count = std::uint64_t{1} << N;
+  for (std::uint64_t a = 0; a < Count; ++a) {
+    const long double da = refDecode<N, ES>(a);
+    check(label, "sqrt", a, 0, sqrt<S>(St(a)).bits,
+          refRound<N, ES>(da < 0 ? NAN : std::sqrt(da), truncate));
+    const double wide = std::bit_cast<double>(convert<F64, T>(St(a)).bits);
+    CHECK((wide == double(da) || (std::isnan(wide) && std::isnan(da))));
+    for (std::uint64_t b = 0; b < Count; ++b) {
+      const long double db = refDecode<N, ES>(b);
+      check(label, "add", a, b, add<S>(St(a), St(b)).bits,
+            refRound<N, ES>(da + db, truncate));
+      check(label, "sub", a, b, sub<S>(St(a), St(b)).bits,
+            refRound<N, ES>(da - db, truncate));
+      check(label, "mul", a, b, mul<S>(St(a), St(b)).bits,
+            refRound<N, ES>(da * db, truncate));
+      check(label, "div", a, b, div<S>(St(a), St(b)).bits,
+            refRound<N, ES>(db == 0 ? NAN : da / db, truncate));
+      check(label, "lt", a, b, lt<T>(St(a), St(b)), da < db);
+    }
+  }
+}
+
+// Long double holds every posit16 sum and product and posit32
+// product exactly; where it rounds (a far-apart sum, a quotient) the
+// exact value is too far from any posit tie point to cross it.
+template <typename T, int N, int ES> void verifySampled(const char *label) {
+  using S = WithExceptions<T, exceptions::ReturnStatus>;
+  using St = typename T::storage_type;
+  std::mt19937_64 rng(0x9051 + N + ES);
+  for (int i = 0; i < 20000; ++i) {
+    const std::uint64_t a = rng() & wordMask<N>();
+    std::uint64_t b = rng() & wordMask<N>();
+    const std::uint64_t c = rng() & wordMask<N>();
+    if (i & 1) // a near neighbour: cancellation, ties
+      b = (a & ~std::uint64_t{0xFF}) | (b & 0xFF);
+    const long double da = refDecode<N, ES>(a), db = refDecode<N, ES>(b),
+                      dc = refDecode<N, ES>(c);
+    check(label, "add", a, b, add<S>(St(a), St(b)).bits,
+          refRound<N, ES>(da + db));
+    check(label, "mul", a, b, mul<S>(St(a), St(b)).bits,
+          refRound<N, ES>(da * db));
+    check(label, "div", a, b, div<S>(St(a), St(b)).bits,
+          refRound<N, ES>(db == 0 ? NAN : da / db));
+    check(label, "sqrt", a, 0, sqrt<S>(St(a)).bits,
+          refRound<N, ES>(da < 0 ? NAN : std::sqrt(da)));
+    if constexpr (N <= 16)
+      check(label, "fma", a, b, fma<S>(St(a), St(b), St(c)).bits,
+            refRound<N, ES>(da * db + dc));
+    const std::uint32_t w = std::uint32_t(rng());
+    const float f = std::bit_cast<float>(w);
+    if (!std::isinf(f))
+      check(label, "from f32", w, 0, convert<S, float32>(w).bits,
+            refRound<N, ES>(f));
+  }
+}
+
+} // namespace
+
+// -----------------------------------------------------------------
+// 1. Codec
+// -----------------------------------------------------------------
+TEST_CASE("posit: the regime scan decodes as the bit loop does") {
+  using F64 = WithExceptions<float64, exceptions::ReturnStatus>;
+  for (std::uint32_t x = 0; x < 0x10000; ++x) {
+    const double want = double(refDecode<16, 2>(x));
+    const double got = std::bit_cast<double>(convert<F64, posit16>(
+        posit16::storage_type(x)).bits);
+    REQUIRE((got == want || (std::isnan(got) && std::isnan(want))));
+  }
+  CHECK(unpack<posit8>(0x40).biased_exp == posit8::number::exponent_bias);
+  CHECK(refDecode<8, 2>(0x01) == std::ldexp(1.0L, -24)); // minpos
+  CHECK(refDecode<8, 2>(0x7F) == std::ldexp(1.0L, 24));  // maxpos
+  CHECK(unpack<posit32>(0x80000000u).category == ValueCategory::NaN);
+  CHECK(unpack<posit64>(0).category == ValueCategory::Zero);
+  // Every value round-trips through unpack/pack.
+  for (std::uint32_t x = 0; x < 0x10000; ++x)
+    REQUIRE(pack<posit16>(unpack<posit16>(posit16::storage_type(x))) == x);
+}
+
+// -----------------------------------------------------------------
+// 2. Arithmetic
+// -----------------------------------------------------------------
+TEST_CASE("posit: exhaustive posit8 against the value-level reference") {
+  failures = 0;
+  verifyExhaustive<posit8, 8, 2>("posit8", false);
+  verifyExhaustive<PositType<8, 0>, 8, 0>("posit<8,0>", false);
+  verifyExhaustive<PositType<8, 1>, 8, 1>("posit<8,1>", false);
+  verifyExhaustive<WithRounding<posit8, rounding::TowardZero>, 8, 2>(
+      "posit8 rz", true);
+  CHECK(failures == 0);
+}
+
+TEST_CASE("posit: sampled posit16 and posit32") {
+  failures = 0;
+  verifySampled<posit16, 16, 2>("posit16");
+  verifySampled<PositType<16, 1>, 16, 1>("posit<16,1>");
+  verifySampled<posit32, 32, 2>("posit32");
+  verifySampled<PositType<32, 3>, 32, 3>("posit<32,3>");
+  CHECK(failures == 0);
+}
+
+// -----------------------------------------------------------------
+// 3. Specials and flags
+// -----------------------------------------------------------------
+TEST_CASE("posit: NaR, saturation and flags") {
+  using S = WithExceptions<posit16, exceptions::ReturnStatus>;
+  constexpr std::uint16_t One = 0x4000, MaxPos = 0x7FFF, MinPos = 0x0001;
+  constexpr std::uint16_t NaR = 0x8000;
+
+  const auto q = div<S>(One, 0);
+  CHECK(q.bits == NaR);
+  CHECK(q.flags == FlagDivByZero);
+  CHECK(div<S>(0, 0).bits == NaR);
+  CHECK(sqrt<S>(0xC000).bits == NaR); // √−1
+  CHECK(add<S>(NaR, One).bits == NaR);
+  const auto inf = convert<S, float32>(0x7F800000u);
+  CHECK(inf.bits == NaR);
+  CHECK(inf.flags == FlagInvalid);
+
+  // Neither end rounds off the posits: maxpos² is maxpos and
+  // minpos² is minpos, both flagged.
+  const auto big = mul<S>(MaxPos, MaxPos);
+  CHECK(big.bits == MaxPos);
+  CHECK(big.flags == (FlagOverflow | FlagInexact));
+  const auto tiny = mul<S>(MinPos, MinPos);
+  CHECK(tiny.bits == MinPos);
+  CHECK(tiny.flags == (FlagUnderflow | FlagInexact));
+  CHECK(mul<S>(One, One).flags == FlagNone);
+
+  CHECK(neg<posit16>(One) == 0xC000);
+  CHECK(neg<posit16>(NaR) == NaR);
+  CHECK(nextUp<posit16>(MaxPos) == MaxPos);
+  CHECK(nextUp<posit16>(0) == MinPos);
+  CHECK(nextDown<posit16>(0) == 0xFFFF);
+  CHECK(nextDown<posit16>(0x8001) == 0x8001);
+  CHECK(nextUp<posit16>(One) == One + 1);
+}
+
+// -----------------------------------------------------------------
+// 4. Quire
+// -----------------------------------------------------------------
+TEST_CASE("posit: the quire sums products exactly") {
+  static_assert(Quire<posit8>::total_bits == 128);
+  static_assert(Quire<posit16>::total_bits == 256);
+  static_assert(Quire<posit32>::total_bits == 512);
+  static_assert(Quire<posit64>::total_bits == 1024);
+
+  // posit8 products are integer multiples of 2^-48 below 2^48: a
+  // 128-bit integer holds the exact sum, and the rounding compares
+  // it against posit values and posit9 tie points scaled by 2^56.
+  using S = WithExceptions<posit8, exceptions::ReturnStatus>;
+  auto fixed = [](long double v) { return __int128(std::ldexp(v, 56)); };
+  std::mt19937_64 rng(0x0017);
+  failures = 0;
+  for (int t = 0; t < 5000; ++t) {
+    const int n = 1 + int(rng() % 40);
+    std::vector<std::uint8_t> a(n), b(n);
+    __int128 sum = 0;
+    bool nar = false;
+    for (int i = 0; i < n; ++i) {
+      a[i] = std::uint8_t(rng());
+      b[i] = std::uint8_t(rng());
+      if (t % 3 == 0 && (i & 1)) { // cancel the previous product
+        b[i] = b[i - 1];
+        a[i] = std::uint8_t(-a[i - 1]);
+      }
+      const long double p = refDecode<8, 2>(a[i]) * refDecode<8, 2>(b[i]);
+      if (std::isnan(p))
+        nar = true;
+      else
+        sum += fixed(p);
+    }
+    std::uint64_t want = 0x80;
+    if (!nar && sum != 0) {
+      const bool negative = sum < 0;
+      const __int128 m = negative ? -sum : sum;
+      std::uint64_t p = 1;
+      while (p < 0x7F && fixed(refDecode<8, 2>(p + 1)) <= m)
+        ++p;
+      if (p < 0x7F && fixed(refDecode<8, 2>(p)) != m && m > fixed(refDecode<8, 2>(1))) {
+        const __int128 tie = fixed(refDecode<9, 2>((p << 1) | 1));
+        if (m > tie || (m == tie && (p & 1)))
+          ++p;
+      }
+      want = negative ? (~p + 1) & 0xFF : p;
+    } else if (!nar) {
+      want = 0;
+    }
+    check("quire8", "dot", std::uint64_t(t), std::uint64_t(n),
+          dotProduct<S>(std::span<const std::uint8_t>(a),
+                        std::span<const std::uint8_t>(b))
+              .bits,
+          want);
+  }
+  CHECK(failures == 0);
+
+  // maxpos² + minpos² − maxpos²: both ends of the register at once.
+  Quire<posit32> q32;
+  q32.addProduct(0x7FFFFFFFu, 0x7FFFFFFFu);
+  q32.addProduct(0x00000001u, 0x00000001u);
+  q32.subProduct(0x7FFFFFFFu, 0x7FFFFFFFu);
+  CHECK(q32.round() == 0x00000001u);
+
+  Quire<posit64> q64;
+  q64.addProduct(0x7FFFFFFFFFFFFFFFull, 0x7FFFFFFFFFFFFFFFull);
+  q64.add(0x4000000000000000ull); // 1
+  q64.subProduct(0x7FFFFFFFFFFFFFFFull, 0x7FFFFFFFFFFFFFFFull);
+  CHECK(q64.round() == 0x4000000000000000ull);
+
+  // A thousand ones, and NaR poisoning until clear().
+  Quire<posit16> q16;
+  for (int i = 0; i < 1000; ++i)
+    q16.add(0x4000);
+  CHECK(refDecode<16, 2>(q16.round()) == 1000);
+  q16.sub(0x8000);
+  CHECK(q16.isNaR());
+  CHECK(q16.round() == 0x8000);
+  q16.clear();
+  CHECK(q16.isZero());
+}